@@ -0,0 +1,70 @@
+/*
+ * Construction time and allocations of igraph_adjlist_t against the flat,
+ * single-block igraph_flat_adjlist_t on a random directed graph. Bytes are
+ * the requested sizes; the per-vector adjacency list additionally pays the
+ * malloc overhead of one block per vertex.
+ *
+ *   cmake --build <build> --target bench-adjlist-layout
+ *   <build>/bench/bench-adjlist-layout-bin [vertices] [edges]
+ */
+
+#include <igraph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void report(const char *name, double seconds, const igraph_arena_stats_t *stats) {
+    printf("%-8s %8.3f %12zu %10.1f\n", name, seconds, stats->allocations, stats->live / 1e6);
+}
+
+int main(int argc, char **argv) {
+    igraph_integer_t n = argc > 1 ? atol(argv[1]) : 5000000;
+    igraph_integer_t m = argc > 2 ? atol(argv[2]) : 20000000;
+    igraph_vector_int_t edges;
+    igraph_t graph;
+    igraph_arena_stats_t stats;
+    double start, seconds;
+
+    igraph_rng_seed(igraph_rng_default(), 42);
+    igraph_vector_int_init(&edges, 2 * m);
+    for (igraph_integer_t i = 0; i < 2 * m; i++) {
+        VECTOR(edges)[i] = RNG_INTEGER(0, n - 1);
+    }
+    igraph_create(&graph, &edges, n, IGRAPH_DIRECTED);
+    igraph_vector_int_destroy(&edges);
+
+    printf("%-8s %8s %12s %10s\n", "layout", "seconds", "allocations", "MB");
+    for (int rep = 0; rep < 3; rep++) {
+        igraph_adjlist_t al;
+        igraph_flat_adjlist_t fl;
+
+        igraph_arena_begin();
+        start = now();
+        igraph_adjlist_init(&graph, &al, IGRAPH_ALL, IGRAPH_LOOPS_TWICE, IGRAPH_MULTIPLE);
+        seconds = now() - start;
+        igraph_arena_stats(&stats);
+        igraph_adjlist_destroy(&al);
+        igraph_arena_end(NULL);
+        report("vectors", seconds, &stats);
+
+        igraph_arena_begin();
+        start = now();
+        igraph_flat_adjlist_init(&graph, &fl, IGRAPH_ALL, IGRAPH_LOOPS_TWICE, IGRAPH_MULTIPLE);
+        seconds = now() - start;
+        igraph_arena_stats(&stats);
+        igraph_flat_adjlist_destroy(&fl);
+        igraph_arena_end(NULL);
+        report("flat", seconds, &stats);
+    }
+
+    igraph_destroy(&graph);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Time per draw of weighted sampling from a fixed power-law distribution
+ * with a cumulative sum and binary search, as the static fitness game did,
+ * with a prefix sum tree one search at a time and in bulk, and with an
+ * alias table one draw at a time and in bulk. The last rows time the
+ * static fitness game and a weighted random walk, which use alias tables.
+ *
+ *   cmake --build <build> --target bench-alias-sampling
+ *   <build>/bench/bench-alias-sampling-bin [draws]
+ */
+
+#include <igraph.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static double checksum(const igraph_vector_int_t *res) {
+    double sum = 0;
+    for (igraph_integer_t i = 0; i < igraph_vector_int_size(res); i++) {
+        sum += VECTOR(*res)[i];
+    }
+    return sum;
+}
+
+static void report(const char *label, igraph_integer_t n, double time, igraph_integer_t draws,
+                   const igraph_vector_int_t *res) {
+    printf("%-18s %9" IGRAPH_PRId " %10.1f %14.0f\n",
+           label, n, 1e9 * time / draws, res ? checksum(res) : 0);
+}
+
+static void run(igraph_integer_t n, igraph_integer_t draws) {
+    igraph_rng_t *rng = igraph_rng_default();
+    igraph_vector_t weights, cum;
+    igraph_vector_int_t res;
+    igraph_psumtree_t tree;
+    igraph_alias_t alias;
+    double start;
+
+    igraph_vector_init(&weights, n);
+    for (igraph_integer_t i = 0; i < n; i++) {
+        VECTOR(weights)[i] = pow(i + 1, -1.5);
+    }
+    igraph_vector_init(&cum, n);
+    igraph_vector_cumsum(&cum, &weights);
+    igraph_psumtree_init(&tree, n);
+    for (igraph_integer_t i = 0; i < n; i++) {
+        igraph_psumtree_update(&tree, i, VECTOR(weights)[i]);
+    }
+    igraph_vector_int_init(&res, draws);
+
+    start = now();
+    for (igraph_integer_t i = 0; i < draws; i++) {
+        igraph_vector_binsearch(&cum, RNG_UNIF(0, igraph_vector_tail(&cum)), &VECTOR(res)[i]);
+    }
+    report("binary search", n, now() - start, draws, &res);
+
+    start = now();
+    for (igraph_integer_t i = 0; i < draws; i++) {
+        igraph_psumtree_search(&tree, &VECTOR(res)[i], RNG_UNIF(0, igraph_psumtree_sum(&tree)));
+    }
+    report("psumtree search", n, now() - start, draws, &res);
+
+    start = now();
+    igraph_psumtree_sample(&tree, rng, &res, draws);
+    report("psumtree sample", n, now() - start, draws, &res);
+
+    start = now();
+    igraph_alias_init(&alias, &weights);
+    report("alias init", n, now() - start, n, NULL);
+
+    start = now();
+    for (igraph_integer_t i = 0; i < draws; i++) {
+        VECTOR(res)[i] = igraph_alias_draw(&alias, rng);
+    }
+    report("alias draw", n, now() - start, draws, &res);
+
+    start = now();
+    igraph_alias_sample(&alias, rng, &res, draws);
+    report("alias sample", n, now() - start, draws, &res);
+
+    igraph_alias_destroy(&alias);
+    igraph_vector_int_destroy(&res);
+    igraph_psumtree_destroy(&tree);
+    igraph_vector_destroy(&cum);
+    igraph_vector_destroy(&weights);
+}
+
+int main(int argc, char **argv) {
+    igraph_integer_t draws = argc > 1 ? atol(argv[1]) : 10000000;
+    igraph_vector_t fitness, weights;
+    igraph_vector_int_t walk;
+    igraph_t graph;
+    double start;
+
+    igraph_rng_seed(igraph_rng_default(), 42);
+
+    printf("%-18s %9s %10s %14s\n", "case", "items", "ns/draw", "checksum");
+    for (igraph_integer_t n = 100; n <= 10000000; n *= 100) {
+        run(n, draws);
+    }
+
+    igraph_vector_init(&fitness, 1000000);
+    for (igraph_integer_t i = 0; i < 1000000; i++) {
+        VECTOR(fitness)[i] = pow(i + 1, -0.5);
+    }
+    start = now();
+    igraph_static_fitness_game(&graph, draws / 2, &fitness, NULL, true, true);
+    report("static fitness", 1000000, now() - start, draws, NULL);
+
+    igraph_vector_init(&weights, igraph_ecount(&graph));
+    for (igraph_integer_t i = 0; i < igraph_ecount(&graph); i++) {
+        VECTOR(weights)[i] = RNG_UNIF(0.5, 2);
+    }
+    igraph_vector_int_init(&walk, 0);
+    start = now();
+    igraph_random_walk(&graph, &weights, &walk, NULL, 0, IGRAPH_ALL, draws,
+                       IGRAPH_RANDOM_WALK_STUCK_RETURN);
+    report("weighted walk", 1000000, now() - start, draws, NULL);
+
+    igraph_vector_int_destroy(&walk);
+    igraph_vector_destroy(&weights);
+    igraph_destroy(&graph);
+    igraph_vector_destroy(&fitness);
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Time to query every row of a lazy adjacency and incidence list on one
+ * thread, against the concurrent lists shared by all OpenMP threads. Each
+ * thread walks all vertices from its own offset, so threads race to build
+ * the same rows; the second walk only reads built rows. Afterwards every
+ * concurrent row must equal the lazy one and the checksums must agree.
+ *
+ *   cmake --build <build> --target bench-concurrent-adjlist
+ *   <build>/bench/bench-concurrent-adjlist-bin [vertices] [edges]
+ */
+
+#include <igraph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* Accumulated in doubles, which stay exact and do not overflow in 32-bit builds */
+static double row_sum(const igraph_vector_int_t *row) {
+    return row ? (double) igraph_vector_int_size(row) + igraph_vector_int_sum(row) : -1;
+}
+
+/* Sum over all rows, queried by every thread */
+static double walk_adjlist(igraph_concurrent_adjlist_t *al, int threads) {
+    igraph_integer_t n = igraph_concurrent_adjlist_size(al);
+    double sum = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads) reduction(+:sum)
+#endif
+    {
+#ifdef _OPENMP
+        igraph_integer_t offset = n / omp_get_num_threads() * omp_get_thread_num();
+#else
+        igraph_integer_t offset = 0;
+#endif
+        for (igraph_integer_t i = 0; i < n; i++) {
+            sum += row_sum(igraph_concurrent_adjlist_get(al, (offset + i) % n));
+        }
+    }
+
+    return sum;
+}
+
+static double walk_inclist(igraph_concurrent_inclist_t *il, int threads) {
+    igraph_integer_t n = igraph_concurrent_inclist_size(il);
+    double sum = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads) reduction(+:sum)
+#endif
+    {
+#ifdef _OPENMP
+        igraph_integer_t offset = n / omp_get_num_threads() * omp_get_thread_num();
+#else
+        igraph_integer_t offset = 0;
+#endif
+        for (igraph_integer_t i = 0; i < n; i++) {
+            sum += row_sum(igraph_concurrent_inclist_get(il, (offset + i) % n));
+        }
+    }
+
+    return sum;
+}
+
+static void report(const char *name, int threads, double first, double second,
+                   double checksum) {
+    printf("%-15s %7d %8.3f %8.3f %20.0f\n", name, threads, first, second, checksum);
+}
+
+int main(int argc, char **argv) {
+    igraph_integer_t n = argc > 1 ? atol(argv[1]) : 1000000;
+    igraph_integer_t m = argc > 2 ? atol(argv[2]) : 10000000;
+    igraph_vector_int_t edges;
+    igraph_t graph;
+    igraph_lazy_adjlist_t lazy_al;
+    igraph_lazy_inclist_t lazy_il;
+    double adj_sum = 0, inc_sum = 0, sum;
+    int max_threads = 1, failed = 0;
+    double start, first, second;
+
+#ifdef _OPENMP
+    max_threads = omp_get_max_threads();
+#endif
+
+    igraph_rng_seed(igraph_rng_default(), 42);
+    igraph_vector_int_init(&edges, 2 * m);
+    for (igraph_integer_t i = 0; i < 2 * m; i++) {
+        VECTOR(edges)[i] = RNG_INTEGER(0, n - 1);
+    }
+    igraph_create(&graph, &edges, n, IGRAPH_DIRECTED);
+    igraph_vector_int_destroy(&edges);
+
+    printf("%-15s %7s %8s %8s %20s\n", "list", "threads", "build", "read", "checksum");
+
+    igraph_lazy_adjlist_init(&graph, &lazy_al, IGRAPH_ALL, IGRAPH_LOOPS_TWICE, IGRAPH_MULTIPLE);
+    igraph_lazy_inclist_init(&graph, &lazy_il, IGRAPH_ALL, IGRAPH_LOOPS_TWICE);
+    start = now();
+    for (igraph_integer_t v = 0; v < n; v++) {
+        adj_sum += row_sum(igraph_lazy_adjlist_get(&lazy_al, v));
+    }
+    first = now() - start;
+    start = now();
+    for (igraph_integer_t v = 0; v < n; v++) {
+        row_sum(igraph_lazy_adjlist_get(&lazy_al, v));
+    }
+    report("lazy adj", 1, first, now() - start, adj_sum);
+    start = now();
+    for (igraph_integer_t v = 0; v < n; v++) {
+        inc_sum += row_sum(igraph_lazy_inclist_get(&lazy_il, v));
+    }
+    first = now() - start;
+    start = now();
+    for (igraph_integer_t v = 0; v < n; v++) {
+        row_sum(igraph_lazy_inclist_get(&lazy_il, v));
+    }
+    report("lazy inc", 1, first, now() - start, inc_sum);
+
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        igraph_concurrent_adjlist_t al;
+        igraph_concurrent_inclist_t il;
+
+        igraph_concurrent_adjlist_init(&graph, &al, IGRAPH_ALL, IGRAPH_LOOPS_TWICE, IGRAPH_MULTIPLE);
+        start = now();
+        sum = walk_adjlist(&al, threads);
+        first = now() - start;
+        start = now();
+        walk_adjlist(&al, threads);
+        second = now() - start;
+        report("concurrent adj", threads, first, second, sum);
+        failed |= sum != threads * adj_sum;
+        for (igraph_integer_t v = 0; v < n; v++) {
+            failed |= !igraph_vector_int_all_e(igraph_concurrent_adjlist_get(&al, v),
+                                               igraph_lazy_adjlist_get(&lazy_al, v));
+        }
+        igraph_concurrent_adjlist_destroy(&al);
+
+        igraph_concurrent_inclist_init(&graph, &il, IGRAPH_ALL, IGRAPH_LOOPS_TWICE);
+        start = now();
+        sum = walk_inclist(&il, threads);
+        first = now() - start;
+        start = now();
+        walk_inclist(&il, threads);
+        second = now() - start;
+        report("concurrent inc", threads, first, second, sum);
+        failed |= sum != threads * inc_sum;
+        for (igraph_integer_t v = 0; v < n; v++) {
+            failed |= !igraph_vector_int_all_e(igraph_concurrent_inclist_get(&il, v),
+                                               igraph_lazy_inclist_get(&lazy_il, v));
+        }
+        igraph_concurrent_inclist_destroy(&il);
+    }
+
+    if (failed) {
+        printf("Concurrent rows differ from the lazy lists.\n");
+    }
+
+    igraph_lazy_inclist_destroy(&lazy_il);
+    igraph_lazy_adjlist_destroy(&lazy_al);
+    igraph_destroy(&graph);
+
+    return failed;
+}
@@ -0,0 +1,96 @@
+/*
+ * Time of weighted single-source distances with each priority queue, on a
+ * square lattice with random weights, resembling a road network, and on a
+ * preferential attachment graph with a power-law degree distribution, once
+ * with real and once with integer weights. The last column checks that all
+ * queues find the same distances. Times are the best of three runs.
+ *
+ *   cmake --build <build> --target bench-dijkstra-heaps
+ *   <build>/bench/bench-dijkstra-heaps-bin [vertices] [sources]
+ */
+
+#include <igraph.h>
+
+#include "paths/paths_internal.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void run(const char *name, const igraph_t *graph, igraph_integer_t sources,
+                igraph_bool_t integer) {
+    const char *heaps[] = { "auto", "2-ary", "4-ary", "8-ary", "radix" };
+    igraph_integer_t n = igraph_vcount(graph);
+    igraph_vector_t weights;
+    igraph_vector_int_t from;
+    igraph_matrix_t res, ref;
+
+    igraph_vector_init(&weights, igraph_ecount(graph));
+    for (igraph_integer_t i = 0; i < igraph_ecount(graph); i++) {
+        VECTOR(weights)[i] = integer ? RNG_INTEGER(1, 100) : RNG_UNIF(1, 100);
+    }
+    igraph_vector_int_init(&from, sources);
+    for (igraph_integer_t i = 0; i < sources; i++) {
+        VECTOR(from)[i] = RNG_INTEGER(0, n - 1);
+    }
+    igraph_matrix_init(&res, 0, 0);
+    igraph_matrix_init(&ref, 0, 0);
+
+    for (int heap = IGRAPH_I_HEAP_AUTO; heap <= IGRAPH_I_HEAP_RADIX; heap++) {
+        double seconds = INFINITY;
+        for (int rep = 0; rep < 3; rep++) {
+            double start = now();
+            igraph_i_distances_dijkstra_cutoff(graph, &res, igraph_vss_vector(&from),
+                                               igraph_vss_all(), &weights, IGRAPH_OUT,
+                                               -1, (igraph_i_heap_type_t) heap);
+            if (now() - start < seconds) {
+                seconds = now() - start;
+            }
+        }
+        if (heap == IGRAPH_I_HEAP_AUTO) {
+            igraph_matrix_update(&ref, &res);
+        }
+        printf("%-10s %-8s %-6s %10.3f %s\n", name, integer ? "integer" : "real", heaps[heap],
+               seconds * 1e3 / sources, igraph_matrix_all_e(&res, &ref) ? "same" : "DIFFERENT");
+    }
+
+    igraph_matrix_destroy(&ref);
+    igraph_matrix_destroy(&res);
+    igraph_vector_int_destroy(&from);
+    igraph_vector_destroy(&weights);
+}
+
+int main(int argc, char **argv) {
+    igraph_integer_t n = argc > 1 ? atol(argv[1]) : 1000000;
+    igraph_integer_t sources = argc > 2 ? atol(argv[2]) : 5;
+    igraph_integer_t side = (igraph_integer_t) sqrt((double) n);
+    igraph_vector_int_t dims;
+    igraph_t graph;
+
+    igraph_rng_seed(igraph_rng_default(), 42);
+    printf("%-10s %-8s %-6s %10s\n", "graph", "weights", "heap", "ms/source");
+
+    igraph_vector_int_init(&dims, 2);
+    VECTOR(dims)[0] = side;
+    VECTOR(dims)[1] = side;
+    igraph_square_lattice(&graph, &dims, 1, IGRAPH_UNDIRECTED, false, NULL);
+    run("lattice", &graph, sources, false);
+    run("lattice", &graph, sources, true);
+    igraph_destroy(&graph);
+    igraph_vector_int_destroy(&dims);
+
+    igraph_barabasi_game(&graph, n, 1, 4, NULL, true, 1, IGRAPH_UNDIRECTED,
+                         IGRAPH_BARABASI_PSUMTREE, NULL);
+    run("power-law", &graph, sources, false);
+    run("power-law", &graph, sources, true);
+    igraph_destroy(&graph);
+
+    return 0;
+}
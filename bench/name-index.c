@@ -0,0 +1,115 @@
+/*
+ * Time and peak memory of mapping vertex names to ids with the character
+ * trie and with the hash name index, and of reading the same names as an
+ * NCOL file, which uses the name index. Each case runs in a child process
+ * so that its peak resident size can be reported separately. Names are
+ * drawn from 'distinct' values; the default file is about 100 MB, pass
+ * more names for a multi-gigabyte one:
+ *
+ *   cmake --build <build> --target bench-name-index
+ *   <build>/bench/bench-name-index-bin [names] [distinct]
+ */
+
+#include <igraph.h>
+
+#include "core/name_index.h"
+#include "core/trie.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static long names, distinct;
+
+/* The i-th name, the same sequence in every case */
+static const char *name(long i, char *buf) {
+    unsigned long x = (unsigned long) i * 2654435761u + 12345;
+    snprintf(buf, 32, "user-%09lu", (x ^ (x >> 13)) % (unsigned long) distinct);
+    return buf;
+}
+
+static void nothing(void *arg) {
+    (void) arg;
+}
+
+static void map_trie(void *arg) {
+    igraph_trie_t trie;
+    igraph_integer_t id;
+    char buf[32];
+
+    (void) arg;
+    igraph_trie_init(&trie, true);
+    for (long i = 0; i < names; i++) {
+        igraph_trie_get(&trie, name(i, buf), &id);
+    }
+}
+
+static void map_index(void *arg) {
+    igraph_i_name_index_t index;
+    igraph_integer_t id;
+    char buf[32];
+
+    (void) arg;
+    igraph_i_name_index_init(&index);
+    for (long i = 0; i < names; i++) {
+        igraph_i_name_index_get(&index, name(i, buf), &id);
+    }
+}
+
+static void read_ncol(void *arg) {
+    igraph_t graph;
+    FILE *file = (FILE *) arg;
+    rewind(file);
+    igraph_read_graph_ncol(&graph, file, NULL, true, IGRAPH_ADD_WEIGHTS_NO, IGRAPH_UNDIRECTED);
+}
+
+/* Runs one case in a child, without freeing, and reports its time and peak size */
+static void run(const char *label, void (*fun)(void *), void *arg) {
+    struct rusage usage;
+    double start = now();
+    int status;
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        fun(arg);
+        _exit(0);
+    }
+    wait4(pid, &status, 0, &usage);
+    printf("%-12s %8.3f %10.1f\n", label, now() - start, usage.ru_maxrss / 1024.0);
+}
+
+int main(int argc, char **argv) {
+    FILE *file = tmpfile();
+    char buf1[32], buf2[32];
+
+    names = argc > 1 ? atol(argv[1]) : 4000000;
+    distinct = argc > 2 ? atol(argv[2]) : names / 4;
+    if (file == NULL || distinct < 1) {
+        return 1;
+    }
+
+    for (long i = 0; i + 1 < names; i += 2) {
+        fprintf(file, "%s %s\n", name(i, buf1), name(i + 1, buf2));
+    }
+
+    printf("%ld names, %ld distinct, %.1f MB file\n", names, distinct, ftell(file) / 1e6);
+    printf("%-12s %8s %10s\n", "case", "seconds", "peak MiB");
+    run("baseline", nothing, NULL);
+    run("trie", map_trie, NULL);
+    run("name index", map_index, NULL);
+    run("read ncol", read_ncol, file);
+
+    fclose(file);
+
+    return 0;
+}
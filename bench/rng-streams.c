@@ -0,0 +1,98 @@
+/*
+ * Time per number of uniform sampling with igraph_rng_get_unif() one call
+ * at a time and with igraph_rng_get_unif_vector(), for each RNG type, and
+ * a Monte-Carlo estimate of pi split into tasks with one PCG32 stream per
+ * task. The estimate must not change with the number of threads.
+ *
+ *   cmake --build <build> --target bench-rng-streams
+ *   <build>/bench/bench-rng-streams-bin [draws]
+ */
+
+#include <igraph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static void run(const igraph_rng_type_t *type, igraph_integer_t draws) {
+    igraph_rng_t rng;
+    igraph_vector_t res;
+    double start, single, bulk, sum = 0;
+
+    if (igraph_rng_init(&rng, type) != IGRAPH_SUCCESS) {
+        return;
+    }
+    igraph_rng_seed(&rng, 42);
+    igraph_vector_init(&res, draws);
+
+    start = now();
+    for (igraph_integer_t i = 0; i < draws; i++) {
+        VECTOR(res)[i] = igraph_rng_get_unif(&rng, 0, 1);
+    }
+    single = now() - start;
+    sum += igraph_vector_sum(&res);
+
+    start = now();
+    igraph_rng_get_unif_vector(&rng, 0, 1, draws, &res);
+    bulk = now() - start;
+    sum += igraph_vector_sum(&res);
+
+    printf("%-8s %10.2f %10.2f %14.3f\n", igraph_rng_name(&rng),
+           1e9 * single / draws, 1e9 * bulk / draws, sum);
+
+    igraph_vector_destroy(&res);
+    igraph_rng_destroy(&rng);
+}
+
+/* Points of task 'task' that fall inside the unit circle */
+static igraph_integer_t hits(igraph_integer_t task, igraph_integer_t per_task) {
+    igraph_rng_t rng;
+    igraph_vector_t xy;
+    igraph_integer_t count = 0;
+
+    igraph_rng_init_stream(&rng, &igraph_rngtype_pcg32, 42, task);
+    igraph_vector_init(&xy, 0);
+    igraph_rng_get_unif_vector(&rng, 0, 1, 2 * per_task, &xy);
+    for (igraph_integer_t i = 0; i < per_task; i++) {
+        igraph_real_t x = VECTOR(xy)[2 * i], y = VECTOR(xy)[2 * i + 1];
+        count += x * x + y * y < 1;
+    }
+    igraph_vector_destroy(&xy);
+    igraph_rng_destroy(&rng);
+
+    return count;
+}
+
+int main(int argc, char **argv) {
+    igraph_integer_t draws = argc > 1 ? atol(argv[1]) : 10000000;
+    const igraph_integer_t tasks = 64;
+    igraph_integer_t count = 0;
+    double start;
+
+    /* PCG64 is unavailable in 32-bit builds */
+    igraph_set_error_handler(igraph_error_handler_printignore);
+
+    printf("%-8s %10s %10s %14s\n", "rng", "ns single", "ns bulk", "checksum");
+    run(&igraph_rngtype_pcg32, draws);
+    run(&igraph_rngtype_pcg64, draws);
+    run(&igraph_rngtype_mt19937, draws);
+    run(&igraph_rngtype_glibc2, draws);
+
+    start = now();
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:count) schedule(dynamic)
+#endif
+    for (igraph_integer_t task = 0; task < tasks; task++) {
+        count += hits(task, draws / 2 / tasks);
+    }
+    printf("pi ~ %.6f from %" IGRAPH_PRId " streams in %.3f s\n",
+           4.0 * count / (tasks * (draws / 2 / tasks)), tasks, now() - start);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * Time of sparse matrix-vector and sparse-dense matrix products with the
+ * column-compressed matrix and with its row-compressed copy, on the
+ * Laplacian of a preferential attachment graph. Set OMP_NUM_THREADS to
+ * compare thread counts. The last column checks that both give the same
+ * result. Times are the best of three runs.
+ *
+ *   cmake --build <build> --target bench-sparsemat-products
+ *   <build>/bench/bench-sparsemat-products-bin [vertices] [columns]
+ */
+
+#include <igraph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+#define BEST_OF_3(var, ...) do { \
+        var = 1e300; \
+        for (int r = 0; r < 3; r++) { \
+            double start = now(); \
+            __VA_ARGS__; \
+            if (now() - start < var) var = now() - start; \
+        } \
+    } while (0)
+
+int main(int argc, char **argv) {
+    igraph_integer_t n = argc > 1 ? atol(argv[1]) : 1000000;
+    igraph_integer_t p = argc > 2 ? atol(argv[2]) : 8;
+    igraph_t graph;
+    igraph_sparsemat_t triplet, L;
+    igraph_sparsemat_csr_t csr;
+    igraph_vector_t x, y1, y2;
+    igraph_matrix_t B, R1, R2;
+    double t_cc, t_csr, t_init;
+    int repeats = 10;
+
+    igraph_rng_seed(igraph_rng_default(), 42);
+    igraph_barabasi_game(&graph, n, 1.0, 5, NULL, true, 1.0, false,
+                         IGRAPH_BARABASI_PSUMTREE, NULL);
+    igraph_sparsemat_init(&triplet, 0, 0, 0);
+    igraph_get_laplacian_sparse(&graph, &triplet, IGRAPH_ALL,
+                                IGRAPH_LAPLACIAN_SYMMETRIC, NULL);
+    igraph_sparsemat_compress(&triplet, &L);
+    igraph_sparsemat_destroy(&triplet);
+
+    BEST_OF_3(t_init, igraph_sparsemat_csr_init(&csr, &L);
+              if (r < 2) igraph_sparsemat_csr_destroy(&csr));
+    printf("%ld rows, %ld non-zeros, %ld row blocks, row copy %.1f ms\n",
+           (long) n, (long) igraph_sparsemat_count_nonzero(&L),
+           (long) igraph_vector_int_size(&csr.blocks) - 1, t_init * 1e3);
+
+    igraph_vector_init(&x, n);
+    igraph_vector_init(&y1, n);
+    igraph_vector_init(&y2, n);
+    for (igraph_integer_t i = 0; i < n; i++) {
+        VECTOR(x)[i] = RNG_UNIF01();
+    }
+
+    printf("%-10s %12s %12s %8s %s\n", "product", "columns ms", "rows ms",
+           "speedup", "same");
+
+    BEST_OF_3(t_cc, for (int k = 0; k < repeats; k++) {
+        igraph_vector_null(&y1);
+        igraph_sparsemat_gaxpy(&L, &x, &y1);
+    });
+    BEST_OF_3(t_csr, for (int k = 0; k < repeats; k++) {
+        igraph_vector_null(&y2);
+        igraph_sparsemat_csr_gaxpy(&csr, &x, &y2);
+    });
+    printf("%-10s %12.2f %12.2f %8.2f %s\n", "gaxpy",
+           t_cc * 1e3 / repeats, t_csr * 1e3 / repeats, t_cc / t_csr,
+           memcmp(VECTOR(y1), VECTOR(y2), n * sizeof(igraph_real_t)) ? "no" : "yes");
+
+    igraph_matrix_init(&B, n, p);
+    igraph_matrix_init(&R1, n, p);
+    igraph_matrix_init(&R2, 0, 0);
+    for (igraph_integer_t i = 0; i < n * p; i++) {
+        VECTOR(B.data)[i] = RNG_UNIF01();
+    }
+
+    /* One cs_gaxpy() per column, as before the row-compressed copy */
+    BEST_OF_3(t_cc, {
+        igraph_matrix_null(&R1);
+        for (igraph_integer_t c = 0; c < p; c++) {
+            igraph_vector_t bc, rc;
+            igraph_vector_view(&bc, &MATRIX(B, 0, c), n);
+            igraph_vector_view(&rc, &MATRIX(R1, 0, c), n);
+            igraph_sparsemat_gaxpy(&L, &bc, &rc);
+        }
+    });
+    BEST_OF_3(t_csr, igraph_sparsemat_csr_multiply_by_dense(&csr, &B, &R2));
+    printf("%-10s %12.2f %12.2f %8.2f %s\n", "by_dense",
+           t_cc * 1e3, t_csr * 1e3, t_cc / t_csr,
+           memcmp(VECTOR(R1.data), VECTOR(R2.data),
+                  n * p * sizeof(igraph_real_t)) ? "no" : "yes");
+
+    igraph_matrix_destroy(&B);
+    igraph_matrix_destroy(&R1);
+    igraph_matrix_destroy(&R2);
+    igraph_vector_destroy(&x);
+    igraph_vector_destroy(&y1);
+    igraph_vector_destroy(&y2);
+    igraph_sparsemat_csr_destroy(&csr);
+    igraph_sparsemat_destroy(&L);
+    igraph_destroy(&graph);
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+ * Time and peak memory of storing vertex names with heavy duplication in
+ * a plain and in an interned igraph_strvector_t, and of reading the same
+ * names as an NCOL file. Each case runs in a child process so that its
+ * peak resident size can be reported separately. The request that added
+ * interned vectors used 20 million names:
+ *
+ *   cmake --build <build> --target bench-strvector-intern
+ *   <build>/bench/bench-strvector-intern-bin [names] [distinct]
+ */
+
+#include <igraph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static long names, distinct;
+
+/* The i-th name, the same sequence in every case */
+static const char *name(long i, char *buf) {
+    unsigned long x = (unsigned long) i * 2654435761u + 12345;
+    snprintf(buf, 32, "user-%09lu", (x ^ (x >> 13)) % (unsigned long) distinct);
+    return buf;
+}
+
+static void store(igraph_bool_t interned) {
+    igraph_strvector_t sv;
+    char buf[32];
+    long same = 0;
+
+    if (interned) {
+        igraph_strvector_init_interned(&sv, 0);
+    } else {
+        igraph_strvector_init(&sv, 0);
+    }
+    for (long i = 0; i < names; i++) {
+        igraph_strvector_push_back(&sv, name(i, buf));
+    }
+    /* Compare neighbouring names, as an edge list reader would */
+    for (long i = 0; i + 1 < names; i += 2) {
+        same += igraph_strvector_equal_elements(&sv, i, i + 1);
+    }
+    if (same < 0) {
+        abort();
+    }
+}
+
+static void import(FILE *file) {
+    igraph_t graph;
+    rewind(file);
+    igraph_read_graph_ncol(&graph, file, NULL, true, IGRAPH_ADD_WEIGHTS_NO, IGRAPH_UNDIRECTED);
+}
+
+/* Runs one case in a child, without freeing, and reports its time and peak size */
+static void run(const char *label, void (*fun)(void *), void *arg) {
+    struct rusage usage;
+    double start = now();
+    int status;
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        fun(arg);
+        _exit(0);
+    }
+    wait4(pid, &status, 0, &usage);
+    printf("%-18s %8.3f %10.1f\n", label, now() - start, usage.ru_maxrss / 1024.0);
+}
+
+static void nothing(void *arg) { (void) arg; }
+static void store_plain(void *arg) { (void) arg; store(false); }
+static void store_interned(void *arg) { (void) arg; store(true); }
+static void import_ncol(void *arg) { import((FILE *) arg); }
+
+int main(int argc, char **argv) {
+    FILE *file = tmpfile();
+    char buf1[32], buf2[32];
+
+    names = argc > 1 ? atol(argv[1]) : 2000000;
+    distinct = argc > 2 ? atol(argv[2]) : names / 20;
+    if (file == NULL || distinct < 1) {
+        return 1;
+    }
+
+    for (long i = 0; i + 1 < names; i += 2) {
+        fprintf(file, "%s %s\n", name(i, buf1), name(i + 1, buf2));
+    }
+
+    printf("%ld names, %ld distinct\n", names, distinct);
+    printf("%-18s %8s %10s\n", "case", "seconds", "peak MiB");
+    run("baseline", nothing, NULL);
+    run("strvector", store_plain, NULL);
+    run("strvector interned", store_interned, NULL);
+    run("read ncol", import_ncol, file);
+
+    fclose(file);
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Time of the vectorized igraph_vector_t and igraph_vector_int_t operations
+ * at each instruction set level the CPU supports, in nanoseconds per
+ * element.
+ *
+ *   cmake --build <build> --target bench-vector-kernels
+ *   <build>/bench/bench-vector-kernels-bin [size] [repeats]
+ */
+
+#include <igraph.h>
+
+#include "core/vector_simd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/* Keeps the compiler from dropping the calls */
+static volatile double sink;
+
+#define TIME(name, expr) do { \
+        double start = now(); \
+        for (int r = 0; r < repeats; r++) { \
+            expr; \
+        } \
+        printf("%-18s %-7s %8.3f\n", name, levels[level], \
+               (now() - start) * 1e9 / repeats / n); \
+    } while (0)
+
+int main(int argc, char **argv) {
+    const char *levels[] = { "scalar", "sse2", "avx2" };
+    igraph_integer_t n = argc > 1 ? atol(argv[1]) : 1000000;
+    int repeats = argc > 2 ? atoi(argv[2]) : 100;
+    igraph_i_simd_level_t best = igraph_i_simd_level();
+    igraph_vector_t x, y;
+    igraph_vector_int_t ix, iy;
+
+    igraph_vector_init(&x, n);
+    igraph_vector_init(&y, n);
+    igraph_vector_int_init(&ix, n);
+    igraph_vector_int_init(&iy, n);
+    for (igraph_integer_t i = 0; i < n; i++) {
+        VECTOR(x)[i] = 1.0 + (double) rand() / RAND_MAX * 1e-6;
+        VECTOR(y)[i] = 1.0 + (double) rand() / RAND_MAX * 1e-6;
+        VECTOR(ix)[i] = rand() % 1000;
+        VECTOR(iy)[i] = rand() % 1000;
+    }
+
+    printf("%-18s %-7s %8s\n", "kernel", "level", "ns/elem");
+    for (int level = IGRAPH_I_SIMD_SCALAR; level <= (int) best; level++) {
+        igraph_i_simd_set_level((igraph_i_simd_level_t) level);
+        TIME("sum", sink = igraph_vector_sum(&x));
+        TIME("prod", sink = igraph_vector_prod(&x));
+        TIME("max", sink = igraph_vector_max(&x));
+        TIME("which_min", sink = igraph_vector_which_min(&x));
+        TIME("maxdifference", sink = igraph_vector_maxdifference(&x, &y));
+        TIME("scale", igraph_vector_scale(&x, 1.0));
+        TIME("add", igraph_vector_add(&x, &y));
+        TIME("mul", igraph_vector_mul(&x, &y));
+        TIME("div", igraph_vector_div(&x, &y));
+        TIME("int_sum", sink = igraph_vector_int_sum(&ix));
+        TIME("int_max", sink = igraph_vector_int_max(&ix));
+        TIME("int_which_max", sink = igraph_vector_int_which_max(&ix));
+        TIME("int_add", igraph_vector_int_add(&ix, &iy));
+        TIME("int_sub", igraph_vector_int_sub(&ix, &iy));
+    }
+    igraph_i_simd_set_level(best);
+
+    igraph_vector_destroy(&x);
+    igraph_vector_destroy(&y);
+    igraph_vector_int_destroy(&ix);
+    igraph_vector_int_destroy(&iy);
+
+    return 0;
+}
@@ -243,7 +243,8 @@ static igraph_error_t igraph_i_sspf_weighted(
 
     /* TODO: this is an O|V| step here. We could save some time by pre-allocating
      * the two-way heap in the caller and re-using it here */
-    IGRAPH_CHECK(igraph_2wheap_init(&queue, igraph_vcount(graph)));
+    IGRAPH_CHECK(igraph_2wheap_init_arity(&queue, igraph_vcount(graph),
+                                          igraph_2wheap_auto_arity(igraph_vcount(graph))));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &queue);
 
     igraph_2wheap_push_with_index(&queue, source, -1.0);
@@ -352,7 +353,8 @@ static igraph_error_t igraph_i_sspf_weighted_edge(
 
     /* TODO: this is an O|V| step here. We could save some time by pre-allocating
      * the two-way heap in the caller and re-using it here */
-    IGRAPH_CHECK(igraph_2wheap_init(&queue, igraph_vcount(graph)));
+    IGRAPH_CHECK(igraph_2wheap_init_arity(&queue, igraph_vcount(graph),
+                                          igraph_2wheap_auto_arity(igraph_vcount(graph))));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &queue);
 
     igraph_2wheap_push_with_index(&queue, source, -1.0);
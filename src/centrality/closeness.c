@@ -178,7 +178,7 @@ static igraph_error_t igraph_i_closeness_cutoff_weighted(const igraph_t *graph,
         *all_reachable = 1; /* be optimistic */
     }
 
-    IGRAPH_CHECK(igraph_2wheap_init(&Q, no_of_nodes));
+    IGRAPH_CHECK(igraph_2wheap_init_arity(&Q, no_of_nodes, igraph_2wheap_auto_arity(no_of_nodes)));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &Q);
     IGRAPH_CHECK(igraph_lazy_inclist_init(graph, &inclist, mode, IGRAPH_LOOPS));
     IGRAPH_FINALLY(igraph_lazy_inclist_destroy, &inclist);
@@ -334,10 +334,10 @@ igraph_error_t igraph_closeness_cutoff(const igraph_t *graph, igraph_vector_t *r
 
     igraph_integer_t no_of_nodes = igraph_vcount(graph);
     igraph_vector_int_t already_counted;
-    igraph_vector_int_t *neis;
+    const igraph_vector_int_t *neis;
     igraph_integer_t i, j;
     igraph_integer_t nodes_reached;
-    igraph_adjlist_t allneis;
+    igraph_flat_adjlist_t allneis;
 
     igraph_integer_t actdist = 0;
 
@@ -371,8 +371,8 @@ igraph_error_t igraph_closeness_cutoff(const igraph_t *graph, igraph_vector_t *r
     IGRAPH_VECTOR_INT_INIT_FINALLY(&already_counted, no_of_nodes);
     IGRAPH_DQUEUE_INT_INIT_FINALLY(&q, 100);
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &allneis, mode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &allneis);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &allneis, mode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &allneis);
 
     IGRAPH_CHECK(igraph_vector_resize(res, nodes_to_calc));
     igraph_vector_null(res);
@@ -402,7 +402,7 @@ igraph_error_t igraph_closeness_cutoff(const igraph_t *graph, igraph_vector_t *r
             nodes_reached++;
 
             /* check the neighbors */
-            neis = igraph_adjlist_get(&allneis, act);
+            neis = igraph_flat_adjlist_get(&allneis, act);
             igraph_integer_t nei_count = igraph_vector_int_size(neis);
             for (j = 0; j < nei_count; j++) {
                 igraph_integer_t neighbor = VECTOR(*neis)[j];
@@ -440,7 +440,7 @@ igraph_error_t igraph_closeness_cutoff(const igraph_t *graph, igraph_vector_t *r
     igraph_dqueue_int_destroy(&q);
     igraph_vector_int_destroy(&already_counted);
     igraph_vit_destroy(&vit);
-    igraph_adjlist_destroy(&allneis);
+    igraph_flat_adjlist_destroy(&allneis);
     IGRAPH_FINALLY_CLEAN(4);
 
     return IGRAPH_SUCCESS;
@@ -456,9 +456,9 @@ static igraph_error_t igraph_i_harmonic_centrality_unweighted(const igraph_t *gr
 
     igraph_integer_t no_of_nodes = igraph_vcount(graph);
     igraph_vector_t already_counted;
-    igraph_vector_int_t *neis;
+    const igraph_vector_int_t *neis;
     igraph_integer_t i, j;
-    igraph_adjlist_t allneis;
+    igraph_flat_adjlist_t allneis;
 
     igraph_integer_t actdist = 0;
 
@@ -480,8 +480,8 @@ static igraph_error_t igraph_i_harmonic_centrality_unweighted(const igraph_t *gr
     IGRAPH_VECTOR_INIT_FINALLY(&already_counted, no_of_nodes);
     IGRAPH_DQUEUE_INT_INIT_FINALLY(&q, 100);
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &allneis, mode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &allneis);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &allneis, mode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &allneis);
 
     IGRAPH_CHECK(igraph_vector_resize(res, nodes_to_calc));
     igraph_vector_null(res);
@@ -514,7 +514,7 @@ static igraph_error_t igraph_i_harmonic_centrality_unweighted(const igraph_t *gr
             }
 
             /* check the neighbors */
-            neis = igraph_adjlist_get(&allneis, act);
+            neis = igraph_flat_adjlist_get(&allneis, act);
             igraph_integer_t nei_count = igraph_vector_int_size(neis);
             for (j = 0; j < nei_count; j++) {
                 igraph_integer_t neighbor = VECTOR(*neis)[j];
@@ -538,7 +538,7 @@ static igraph_error_t igraph_i_harmonic_centrality_unweighted(const igraph_t *gr
     igraph_dqueue_int_destroy(&q);
     igraph_vector_destroy(&already_counted);
     igraph_vit_destroy(&vit);
-    igraph_adjlist_destroy(&allneis);
+    igraph_flat_adjlist_destroy(&allneis);
     IGRAPH_FINALLY_CLEAN(4);
 
     return IGRAPH_SUCCESS;
@@ -589,7 +589,7 @@ static igraph_error_t igraph_i_harmonic_centrality_weighted(const igraph_t *grap
 
     nodes_to_calc = IGRAPH_VIT_SIZE(vit);
 
-    IGRAPH_CHECK(igraph_2wheap_init(&Q, no_of_nodes));
+    IGRAPH_CHECK(igraph_2wheap_init_arity(&Q, no_of_nodes, igraph_2wheap_auto_arity(no_of_nodes)));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &Q);
     IGRAPH_CHECK(igraph_lazy_inclist_init(graph, &inclist, mode, IGRAPH_LOOPS));
     IGRAPH_FINALLY(igraph_lazy_inclist_destroy, &inclist);
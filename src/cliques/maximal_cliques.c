@@ -369,6 +369,40 @@ igraph_error_t igraph_maximal_cliques(
 #include "maximal_cliques_template.h"
 #undef IGRAPH_MC_ORIG
 
+/**
+ * \function igraph_maximal_cliques_ragged
+ * \brief Finds all maximal cliques in a graph, into a ragged array.
+ *
+ * </para><para>
+ * The same as \ref igraph_maximal_cliques(), but the cliques are stored in
+ * a single \ref igraph_ragged_int_t instead of a vector for each clique.
+ * This is much faster for graphs with many small maximal cliques.
+ *
+ * \param graph The input graph.
+ * \param res Initialized ragged array, its contents are replaced by the
+ *   cliques, one item for each. Vertices of a clique may be in arbitrary
+ *   order.
+ * \param min_size Integer giving the minimum size of the cliques to be
+ *   returned. If negative or zero, no lower bound will be used.
+ * \param max_size Integer giving the maximum size of the cliques to be
+ *   returned. If negative or zero, no upper bound will be used.
+ * \return Error code.
+ *
+ * \sa \ref igraph_maximal_cliques().
+ *
+ * Time complexity: O(d(n-d)3^(d/3)) worst case, d is the degeneracy
+ * of the graph, this is typically small for sparse graphs.
+ */
+
+igraph_error_t igraph_maximal_cliques_ragged(
+    const igraph_t *graph, igraph_ragged_int_t *res,
+    igraph_integer_t min_size, igraph_integer_t max_size
+);
+
+#define IGRAPH_MC_RAGGED
+#include "maximal_cliques_template.h"
+#undef IGRAPH_MC_RAGGED
+
 /**
  * \function igraph_maximal_cliques_count
  * Count the number of maximal cliques in a graph
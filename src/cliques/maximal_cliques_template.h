@@ -36,6 +36,21 @@
 #define FOR_LOOP_OVER_VERTICES_PREPARE
 #endif
 
+#ifdef IGRAPH_MC_RAGGED
+#define RESTYPE igraph_ragged_int_t *res
+#define RESNAME res
+#define SUFFIX _ragged
+#define RECORD do {                         \
+        IGRAPH_CHECK(igraph_ragged_int_push_back(res, R));     \
+    } while (0)
+#define PREPARE do {                    \
+        igraph_ragged_int_clear(res);           \
+    } while (0)
+#define CLEANUP
+#define FOR_LOOP_OVER_VERTICES for (i=0; i<no_of_nodes; i++)
+#define FOR_LOOP_OVER_VERTICES_PREPARE
+#endif
+
 #ifdef IGRAPH_MC_COUNT
     #define RESTYPE igraph_integer_t *res
     #define RESNAME res
@@ -33,6 +33,7 @@
 #include "igraph_vector.h"
 
 #include "core/interruption.h"
+#include "graph/caching.h"
 #include "operators/subgraph.h"
 
 static igraph_error_t igraph_i_connected_components_weak(
@@ -86,7 +87,9 @@ igraph_error_t igraph_clusters(const igraph_t *graph, igraph_vector_int_t *membe
  * Time complexity: O(|V|+|E|),
  * |V| and
  * |E| are the number of vertices and
- * edges in the graph.
+ * edges in the graph. Weakly connected components are cached with the
+ * graph if the budget set with \ref igraph_set_property_cache_budget()
+ * allows; later calls are then O(|V|).
  */
 
 igraph_error_t igraph_connected_components(
@@ -116,6 +119,24 @@ static igraph_error_t igraph_i_connected_components_weak(
     igraph_integer_t i;
     igraph_vector_int_t neis = IGRAPH_VECTOR_NULL;
 
+    const igraph_vector_int_t *cached = igraph_i_property_cache_get_membership(graph, &no_of_clusters);
+    if (cached) {
+        if (membership) {
+            IGRAPH_CHECK(igraph_vector_int_update(membership, cached));
+        }
+        if (csize) {
+            IGRAPH_CHECK(igraph_vector_int_resize(csize, no_of_clusters));
+            igraph_vector_int_null(csize);
+            for (i = 0; i < no_of_nodes; i++) {
+                VECTOR(*csize)[ VECTOR(*cached)[i] ]++;
+            }
+        }
+        if (no) {
+            *no = no_of_clusters;
+        }
+        return IGRAPH_SUCCESS;
+    }
+
     already_added = IGRAPH_CALLOC(no_of_nodes, char);
     if (already_added == 0) {
         IGRAPH_ERROR("Cannot calculate weakly connected components.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
@@ -186,6 +207,9 @@ static igraph_error_t igraph_i_connected_components_weak(
 
     /* Update cache */
     igraph_i_property_cache_set_bool(graph, IGRAPH_PROP_IS_WEAKLY_CONNECTED, no_of_clusters == 1);
+    if (membership) {
+        igraph_i_property_cache_set_membership(graph, membership, no_of_clusters);
+    }
 
     return IGRAPH_SUCCESS;
 }
@@ -206,7 +230,7 @@ static igraph_error_t igraph_i_connected_components_strong(
     igraph_vector_int_t out = IGRAPH_VECTOR_NULL;
     const igraph_vector_int_t* tmp;
 
-    igraph_adjlist_t adjlist;
+    igraph_flat_adjlist_t adjlist;
 
     /* The result */
 
@@ -224,14 +248,14 @@ static igraph_error_t igraph_i_connected_components_strong(
         igraph_vector_int_clear(csize);
     }
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &adjlist, IGRAPH_OUT, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &adjlist);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &adjlist, IGRAPH_OUT, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &adjlist);
 
     num_seen = 0;
     for (i = 0; i < no_of_nodes; i++) {
         IGRAPH_ALLOW_INTERRUPTION();
 
-        tmp = igraph_adjlist_get(&adjlist, i);
+        tmp = igraph_flat_adjlist_get(&adjlist, i);
         if (VECTOR(next_nei)[i] > igraph_vector_int_size(tmp)) {
             continue;
         }
@@ -239,7 +263,7 @@ static igraph_error_t igraph_i_connected_components_strong(
         IGRAPH_CHECK(igraph_dqueue_int_push(&q, i));
         while (!igraph_dqueue_int_empty(&q)) {
             igraph_integer_t act_node = igraph_dqueue_int_back(&q);
-            tmp = igraph_adjlist_get(&adjlist, act_node);
+            tmp = igraph_flat_adjlist_get(&adjlist, act_node);
             if (VECTOR(next_nei)[act_node] == 0) {
                 /* this is the first time we've met this vertex */
                 VECTOR(next_nei)[act_node]++;
@@ -268,11 +292,11 @@ static igraph_error_t igraph_i_connected_components_strong(
 
     IGRAPH_PROGRESS("Strongly connected components: ", 50.0, NULL);
 
-    igraph_adjlist_destroy(&adjlist);
+    igraph_flat_adjlist_destroy(&adjlist);
     IGRAPH_FINALLY_CLEAN(1);
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &adjlist, IGRAPH_IN, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &adjlist);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &adjlist, IGRAPH_IN, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &adjlist);
 
     /* OK, we've the 'out' values for the nodes, let's use them in
        decreasing order with the help of a heap */
@@ -303,7 +327,7 @@ static igraph_error_t igraph_i_connected_components_strong(
 
         while (!igraph_dqueue_int_empty(&q)) {
             igraph_integer_t act_node = igraph_dqueue_int_pop_back(&q);
-            tmp = igraph_adjlist_get(&adjlist, act_node);
+            tmp = igraph_flat_adjlist_get(&adjlist, act_node);
             n = igraph_vector_int_size(tmp);
             for (i = 0; i < n; i++) {
                 igraph_integer_t neighbor = VECTOR(*tmp)[i];
@@ -340,7 +364,7 @@ static igraph_error_t igraph_i_connected_components_strong(
     }
 
     /* Clean up */
-    igraph_adjlist_destroy(&adjlist);
+    igraph_flat_adjlist_destroy(&adjlist);
     igraph_vector_int_destroy(&out);
     igraph_dqueue_int_destroy(&q);
     igraph_vector_int_destroy(&next_nei);
@@ -735,7 +759,7 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
     igraph_vector_int_t out = IGRAPH_VECTOR_NULL;
     const igraph_vector_int_t* tmp;
 
-    igraph_adjlist_t adjlist;
+    igraph_flat_adjlist_t adjlist;
     igraph_vector_int_t verts;
     igraph_vector_int_t vids_old2new;
     igraph_t newg;
@@ -758,8 +782,8 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
 
     igraph_vector_int_null(&out);
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &adjlist, IGRAPH_OUT, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &adjlist);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &adjlist, IGRAPH_OUT, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &adjlist);
 
     /* vids_old2new would have been created internally in igraph_induced_subgraph(),
        but it is slow if the graph is large and consists of many small components,
@@ -775,7 +799,7 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
 
         /* get all the 'out' neighbors of this node
          * NOTE: next_nei is initialized [0, 0, ...] */
-        tmp = igraph_adjlist_get(&adjlist, i);
+        tmp = igraph_flat_adjlist_get(&adjlist, i);
         if (VECTOR(next_nei)[i] > igraph_vector_int_size(tmp)) {
             continue;
         }
@@ -790,7 +814,7 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
             igraph_integer_t act_node = igraph_dqueue_int_back(&q);
 
             /* get all neighbors of this node */
-            tmp = igraph_adjlist_get(&adjlist, act_node);
+            tmp = igraph_flat_adjlist_get(&adjlist, act_node);
             if (VECTOR(next_nei)[act_node] == 0) {
                 /* this is the first time we've met this vertex,
                      * because next_nei is initialized [0, 0, ...] */
@@ -824,11 +848,11 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
 
     IGRAPH_PROGRESS("Strongly connected components: ", 50.0, NULL);
 
-    igraph_adjlist_destroy(&adjlist);
+    igraph_flat_adjlist_destroy(&adjlist);
     IGRAPH_FINALLY_CLEAN(1);
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &adjlist, IGRAPH_IN, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &adjlist);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &adjlist, IGRAPH_IN, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &adjlist);
 
     /* OK, we've the 'out' values for the nodes, let's use them in
      * decreasing order with the help of the next_nei heap */
@@ -868,7 +892,7 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
         while (!igraph_dqueue_int_empty(&q)) {
             /* consume the queue from this node */
             igraph_integer_t act_node = igraph_dqueue_int_pop_back(&q);
-            tmp = igraph_adjlist_get(&adjlist, act_node);
+            tmp = igraph_flat_adjlist_get(&adjlist, act_node);
             n = igraph_vector_int_size(tmp);
             for (i = 0; i < n; i++) {
                 igraph_integer_t neighbor = VECTOR(*tmp)[i];
@@ -924,7 +948,7 @@ static igraph_error_t igraph_i_decompose_strong(const igraph_t *graph,
 
     igraph_vector_int_destroy(&vids_old2new);
     igraph_vector_int_destroy(&verts);
-    igraph_adjlist_destroy(&adjlist);
+    igraph_flat_adjlist_destroy(&adjlist);
     igraph_vector_int_destroy(&out);
     igraph_dqueue_int_destroy(&q);
     igraph_vector_int_destroy(&next_nei);
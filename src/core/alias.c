@@ -0,0 +1,202 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#include "igraph_alias.h"
+
+#include "igraph_memory.h"
+
+#include <math.h>  /* isfinite */
+
+/**
+ * \section about_alias
+ *
+ * <para>\type igraph_alias_t is a Walker alias table, which draws samples
+ * from a discrete probability distribution in constant time. Building the
+ * table takes linear time, and the probabilities cannot be changed
+ * afterwards. Use \ref igraph_psumtree_t when they are updated between
+ * draws, as in preferential attachment.</para>
+ *
+ * <para>The table has one column for each item. Each column holds its
+ * own item with some probability and one other item, its alias, with the
+ * rest; every column has the same total weight. A draw picks a column
+ * uniformly, then one of its two items.</para>
+ */
+
+/**
+ * \function igraph_alias_init
+ * \brief Builds an alias table from a vector of weights.
+ *
+ * Uses Vose's method. Item i will be drawn with probability proportional
+ * to the i-th weight.
+ *
+ * \param a Pointer to an uninitialized alias table.
+ * \param weights The weights of the items. They must be non-negative and
+ *    finite, and at least one of them must be positive.
+ * \return Error code, \c IGRAPH_EINVAL if the weights are invalid.
+ *
+ * Time complexity: O(n), the number of weights.
+ */
+
+igraph_error_t igraph_alias_init(igraph_alias_t *a, const igraph_vector_t *weights) {
+    igraph_integer_t n = igraph_vector_size(weights);
+    igraph_vector_int_t work;
+    igraph_integer_t small = 0, large = n; /* stacks at both ends of 'work' */
+    igraph_real_t sum = 0;
+    igraph_alias_column_t *col;
+
+    for (igraph_integer_t i = 0; i < n; i++) {
+        igraph_real_t w = VECTOR(*weights)[i];
+        if (!(w >= 0 && isfinite(w))) {
+            IGRAPH_ERRORF("Weights of an alias table must be non-negative and finite, got %g.",
+                          IGRAPH_EINVAL, w);
+        }
+        sum += w;
+    }
+    if (!(sum > 0)) {
+        IGRAPH_ERROR("Weights of an alias table must not all be zero.", IGRAPH_EINVAL);
+    }
+
+    col = IGRAPH_CALLOC(n, igraph_alias_column_t);
+    IGRAPH_CHECK_OOM(col, "Cannot build alias table.");
+    IGRAPH_FINALLY(igraph_free, col);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&work, n);
+
+    /* Scale the weights so that their mean is one, and sort the columns
+     * into those below and those above the mean. */
+    for (igraph_integer_t i = 0; i < n; i++) {
+        col[i].prob = VECTOR(*weights)[i] / sum * n;
+        col[i].alias = i;
+        if (col[i].prob < 1) {
+            VECTOR(work)[small++] = i;
+        } else {
+            VECTOR(work)[--large] = i;
+        }
+    }
+
+    /* Fill up each small column from a large one, which may become small. */
+    while (small > 0 && large < n) {
+        igraph_integer_t s = VECTOR(work)[--small];
+        igraph_integer_t l = VECTOR(work)[large];
+        col[s].alias = l;
+        col[l].prob = (col[l].prob + col[s].prob) - 1;
+        if (col[l].prob < 1) {
+            large++;
+            VECTOR(work)[small++] = l;
+        }
+    }
+
+    /* Whatever is left is one up to rounding errors. */
+    while (small > 0) {
+        col[VECTOR(work)[--small]].prob = 1;
+    }
+    while (large < n) {
+        col[VECTOR(work)[large++]].prob = 1;
+    }
+
+    igraph_vector_int_destroy(&work);
+    IGRAPH_FINALLY_CLEAN(2);
+
+    a->columns = col;
+    a->size = n;
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_alias_destroy
+ * \brief Deallocates an alias table.
+ *
+ * \param a The alias table.
+ *
+ * Time complexity: O(1).
+ */
+
+void igraph_alias_destroy(igraph_alias_t *a) {
+    IGRAPH_FREE(a->columns);
+}
+
+/**
+ * \function igraph_alias_size
+ * \brief The number of items in an alias table.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_alias_size(const igraph_alias_t *a) {
+    return a->size;
+}
+
+/**
+ * \function igraph_alias_draw
+ * \brief Draws one item from an alias table.
+ *
+ * \param a The alias table.
+ * \param rng The random number generator to use, e.g.
+ *    \ref igraph_rng_default().
+ * \return The index of the drawn item.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_alias_draw(const igraph_alias_t *a, igraph_rng_t *rng) {
+    const igraph_alias_column_t *col = a->columns + igraph_rng_get_integer(rng, 0, a->size - 1);
+    /* Full columns need no second random number */
+    return col->prob >= 1 || igraph_rng_get_unif01(rng) < col->prob ? col - a->columns : col->alias;
+}
+
+/**
+ * \function igraph_alias_sample
+ * \brief Draws several items from an alias table.
+ *
+ * The items are drawn independently, with replacement.
+ *
+ * \param a The alias table.
+ * \param rng The random number generator to use, e.g.
+ *    \ref igraph_rng_default().
+ * \param res An initialized vector, the indices of the drawn items are
+ *    stored here. It will be resized as needed.
+ * \param k The number of items to draw.
+ * \return Error code.
+ *
+ * Time complexity: O(k).
+ */
+
+igraph_error_t igraph_alias_sample(const igraph_alias_t *a, igraph_rng_t *rng,
+                                   igraph_vector_int_t *res, igraph_integer_t k) {
+    igraph_integer_t last = a->size - 1;
+
+    if (k < 0) {
+        IGRAPH_ERRORF("Number of samples must not be negative, got %" IGRAPH_PRId ".",
+                      IGRAPH_EINVAL, k);
+    }
+
+    IGRAPH_CHECK(igraph_vector_int_resize(res, k));
+
+    for (igraph_integer_t j = 0; j < k; j++) {
+        igraph_integer_t c = igraph_rng_get_integer(rng, 0, last);
+        const igraph_alias_column_t *col = a->columns + c;
+        VECTOR(*res)[j] = col->prob >= 1 || igraph_rng_get_unif01(rng) < col->prob ? c : col->alias;
+    }
+
+    return IGRAPH_SUCCESS;
+}
@@ -26,7 +26,9 @@
 
 #include "core/indheap.h"
 
+#include <math.h>
 #include <string.h>         /* memcpy & co. */
+#include <stdint.h>
 #include <stdlib.h>
 
 /* -------------------------------------------------- */
@@ -740,17 +742,16 @@ static void igraph_d_indheap_i_switch(igraph_d_indheap_t* h, igraph_integer_t e1
 /* Two-way indexed heap                               */
 /* -------------------------------------------------- */
 
-#undef PARENT
-#undef LEFTCHILD
-#undef RIGHTCHILD
-#define PARENT(x)     (((x)+1)/2-1)
-#define LEFTCHILD(x)  (((x)+1)*2-1)
-#define RIGHTCHILD(x) (((x)+1)*2)
-
 /* This is a smart indexed heap. In addition to the "normal" indexed heap
    it allows to access every element through its index in O(1) time.
    In other words, for this heap the indexing operation is O(1), the
-   normal heap does this in O(n) time.... */
+   normal heap does this in O(n) time....
+
+   Each node has 'arity' children. The default is two; four or eight
+   children make the heap shallower, which pays off for large heaps
+   where most of the time goes into cache misses while sinking. With
+   two children, the layout and tie breaking are the same as those of
+   the classic binary heap. */
 
 static void igraph_i_2wheap_switch(igraph_2wheap_t *h,
                                    igraph_integer_t e1, igraph_integer_t e2) {
@@ -771,35 +772,83 @@ static void igraph_i_2wheap_switch(igraph_2wheap_t *h,
     }
 }
 
+/* Heaps that may hold at least this many items get four children per
+   node from igraph_2wheap_auto_arity(), and Dijkstra queues this large may
+   use a radix heap instead, see bench/dijkstra-heaps.c */
+#define IGRAPH_I_2WHEAP_DARY_MIN_SIZE 100000
+
+/* Both functions below move a hole instead of swapping at each level;
+   the item is written once, to its final position. */
+
 static void igraph_i_2wheap_shift_up(igraph_2wheap_t *h,
                                      igraph_integer_t elem) {
-    if (elem == 0 || VECTOR(h->data)[elem] < VECTOR(h->data)[PARENT(elem)]) {
-        /* at the top */
-    } else {
-        igraph_i_2wheap_switch(h, elem, PARENT(elem));
-        igraph_i_2wheap_shift_up(h, PARENT(elem));
+    igraph_real_t *data = VECTOR(h->data);
+    igraph_integer_t *index = VECTOR(h->index);
+    igraph_integer_t *index2 = VECTOR(h->index2);
+    igraph_real_t value = data[elem];
+    igraph_integer_t idx = index[elem];
+
+    while (elem > 0) {
+        igraph_integer_t parent = (elem - 1) / h->arity;
+        if (value < data[parent]) {
+            break;
+        }
+        data[elem] = data[parent];
+        index[elem] = index[parent];
+        index2[index[elem]] = elem + 2;
+        elem = parent;
     }
+
+    data[elem] = value;
+    index[elem] = idx;
+    index2[idx] = elem + 2;
 }
 
 static void igraph_i_2wheap_sink(igraph_2wheap_t *h,
                                  igraph_integer_t head) {
     igraph_integer_t size = igraph_2wheap_size(h);
-    if (LEFTCHILD(head) >= size) {
-        /* no subtrees */
-    } else if (RIGHTCHILD(head) == size ||
-               VECTOR(h->data)[LEFTCHILD(head)] >= VECTOR(h->data)[RIGHTCHILD(head)]) {
-        /* sink to the left if needed */
-        if (VECTOR(h->data)[head] < VECTOR(h->data)[LEFTCHILD(head)]) {
-            igraph_i_2wheap_switch(h, head, LEFTCHILD(head));
-            igraph_i_2wheap_sink(h, LEFTCHILD(head));
+    igraph_real_t *data = VECTOR(h->data);
+    igraph_integer_t *index = VECTOR(h->index);
+    igraph_integer_t *index2 = VECTOR(h->index2);
+    igraph_real_t value;
+    igraph_integer_t idx;
+
+    if (head >= size) {
+        return;
+    }
+
+    value = data[head];
+    idx = index[head];
+
+    while (true) {
+        igraph_integer_t first = head * h->arity + 1;
+        igraph_integer_t last, best;
+
+        if (first >= size) {
+            break;
         }
-    } else {
-        /* sink to the right */
-        if (VECTOR(h->data)[head] < VECTOR(h->data)[RIGHTCHILD(head)]) {
-            igraph_i_2wheap_switch(h, head, RIGHTCHILD(head));
-            igraph_i_2wheap_sink(h, RIGHTCHILD(head));
+        last = size - first > h->arity ? first + h->arity : size;
+
+        /* Largest child, the leftmost one among equals */
+        best = first;
+        for (igraph_integer_t child = first + 1; child < last; child++) {
+            if (! (data[best] >= data[child])) {
+                best = child;
+            }
+        }
+
+        if (! (value < data[best])) {
+            break;
         }
+        data[head] = data[best];
+        index[head] = index[best];
+        index2[index[head]] = head + 2;
+        head = best;
     }
+
+    data[head] = value;
+    index[head] = idx;
+    index2[idx] = head + 2;
 }
 
 /* ------------------ */
@@ -811,7 +860,18 @@ static void igraph_i_2wheap_sink(igraph_2wheap_t *h,
  * number of items that the heap can hold.
  */
 igraph_error_t igraph_2wheap_init(igraph_2wheap_t *h, igraph_integer_t size) {
+    return igraph_2wheap_init_arity(h, size, 2);
+}
+
+/**
+ * Initializes a new two-way heap in which each node has \p arity children.
+ * Use \ref igraph_2wheap_auto_arity() to pick the arity from the size.
+ */
+igraph_error_t igraph_2wheap_init_arity(igraph_2wheap_t *h, igraph_integer_t size,
+                                        igraph_integer_t arity) {
+    IGRAPH_ASSERT(arity >= 2);
     h->size = size;
+    h->arity = arity;
     /* We start with the biggest */
     IGRAPH_VECTOR_INT_INIT_FINALLY(&h->index2, size);
     IGRAPH_VECTOR_INIT_FINALLY(&h->data, 0);
@@ -1006,6 +1066,17 @@ void igraph_2wheap_modify(igraph_2wheap_t *h, igraph_integer_t idx, igraph_real_
     igraph_i_2wheap_shift_up(h, pos);
 }
 
+/**
+ * Returns the number of children per node that suits a heap holding at most
+ * \p size items. Small heaps stay in cache, where the binary heap does the
+ * fewest comparisons; larger ones are quicker with four children per node.
+ * Items with equal values are removed in a different order with each arity,
+ * so searches that return one of several equal paths keep the binary heap.
+ */
+igraph_integer_t igraph_2wheap_auto_arity(igraph_integer_t size) {
+    return size < IGRAPH_I_2WHEAP_DARY_MIN_SIZE ? 2 : 4;
+}
+
 /**
  * Checks that the heap is in a consistent state
  */
@@ -1015,17 +1086,8 @@ igraph_error_t igraph_2wheap_check(const igraph_2wheap_t *h) {
     igraph_bool_t error = false;
 
     /* Check the heap property */
-    for (i = 0; i < size; i++) {
-        if (LEFTCHILD(i) >= size) {
-            break;
-        }
-        if (VECTOR(h->data)[LEFTCHILD(i)] > VECTOR(h->data)[i]) {
-            error = true; break;
-        }
-        if (RIGHTCHILD(i) >= size) {
-            break;
-        }
-        if (VECTOR(h->data)[RIGHTCHILD(i)] > VECTOR(h->data)[i]) {
+    for (i = 1; i < size; i++) {
+        if (VECTOR(h->data)[i] > VECTOR(h->data)[(i - 1) / h->arity]) {
             error = true; break;
         }
     }
@@ -1036,3 +1098,365 @@ igraph_error_t igraph_2wheap_check(const igraph_2wheap_t *h) {
 
     return IGRAPH_SUCCESS;
 }
+
+/* -------------------------------------------------- */
+/* Radix heap                                         */
+/* -------------------------------------------------- */
+
+/* A monotone minimum heap for non-negative keys, after Ahuja, Mehlhorn,
+   Orlin and Tarjan. Non-negative doubles compare the same way as their
+   bit patterns read as unsigned 64-bit integers, so the key of an item is
+   its bit pattern. Bucket 0 holds the items whose key equals that of the
+   last removed minimum, bucket b > 0 those whose key first differs from it
+   in bit b-1, counting from the least significant bit. Removing the
+   minimum redistributes the first non-empty bucket into lower ones, and
+   each item can only move down 64 times in total.
+
+   Buckets are plain arrays of indices, which are scanned sequentially.
+   Lowering a value that moves an item to another bucket appends it there,
+   and leaves a stale entry behind in the old bucket. An entry is stale if
+   its item is no longer active, or if the value of its item now belongs
+   to a lower bucket; stale entries are dropped when their bucket is
+   redistributed or popped. Since items can only move down, and an index
+   is never added again once deactivated, a stale entry can never look
+   valid again. */
+
+static uint64_t igraph_i_radixheap_key(igraph_real_t value) {
+    uint64_t key;
+    if (value == 0) {
+        return 0; /* also for -0.0 */
+    }
+    memcpy(&key, &value, sizeof(key));
+    return key;
+}
+
+static int igraph_i_radixheap_bucket(uint64_t key, uint64_t last) {
+    uint64_t diff = key ^ last;
+    if (diff == 0) {
+        return 0;
+    }
+#if defined(__GNUC__) || defined(__clang__)
+    return 64 - __builtin_clzll(diff);
+#else
+    {
+        int b = 0;
+        while (diff) {
+            diff >>= 1;
+            b++;
+        }
+        return b;
+    }
+#endif
+}
+
+/* The bucket the item with the given index belongs to */
+#define BUCKET(h, idx) \
+    igraph_i_radixheap_bucket(igraph_i_radixheap_key(VECTOR((h)->value)[idx]), (h)->last)
+
+/**
+ * Initializes a radix heap. Indices of the items must be between 0 and
+ * \p size - 1.
+ */
+igraph_error_t igraph_radixheap_init(igraph_radixheap_t *h, igraph_integer_t size) {
+    h->size = size;
+    IGRAPH_VECTOR_INIT_FINALLY(&h->value, size);
+    IGRAPH_CHECK(igraph_vector_char_init(&h->state, size));
+    IGRAPH_FINALLY(igraph_vector_char_destroy, &h->state);
+    IGRAPH_CHECK(igraph_vector_int_list_init(&h->buckets, IGRAPH_I_RADIXHEAP_BUCKETS));
+    IGRAPH_FINALLY_CLEAN(2);
+    for (int b = 0; b < IGRAPH_I_RADIXHEAP_BUCKETS; b++) {
+        h->bucket[b] = igraph_vector_int_list_get_ptr(&h->buckets, b);
+    }
+    igraph_radixheap_clear(h);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * Destroys a radix heap.
+ */
+void igraph_radixheap_destroy(igraph_radixheap_t *h) {
+    igraph_vector_destroy(&h->value);
+    igraph_vector_char_destroy(&h->state);
+    igraph_vector_int_list_destroy(&h->buckets);
+}
+
+/**
+ * Removes all items from a radix heap, and forgets the last minimum.
+ */
+void igraph_radixheap_clear(igraph_radixheap_t *h) {
+    for (int b = 0; b < IGRAPH_I_RADIXHEAP_BUCKETS; b++) {
+        igraph_vector_int_clear(h->bucket[b]);
+    }
+    igraph_vector_char_null(&h->state);
+    h->count = 0;
+    h->last = 0;
+}
+
+/**
+ * Returns whether the radix heap is empty.
+ */
+igraph_bool_t igraph_radixheap_empty(const igraph_radixheap_t *h) {
+    return h->count == 0;
+}
+
+/**
+ * Returns the number of items in the radix heap.
+ */
+igraph_integer_t igraph_radixheap_size(const igraph_radixheap_t *h) {
+    return h->count;
+}
+
+/**
+ * Adds an item with the given index. \p elem must not be NaN, and must not be
+ * smaller than the last removed minimum. The heap must not have had an item
+ * with the same index since it was last cleared.
+ */
+igraph_error_t igraph_radixheap_push_with_index(igraph_radixheap_t *h,
+                                                igraph_integer_t idx, igraph_real_t elem) {
+    IGRAPH_ASSERT(igraph_i_radixheap_key(elem) >= h->last);
+    VECTOR(h->value)[idx] = elem;
+    IGRAPH_CHECK(igraph_vector_int_push_back(h->bucket[BUCKET(h, idx)], idx));
+    VECTOR(h->state)[idx] = 2;
+    h->count++;
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * Returns whether the heap contains an item with the given index, even if
+ * it was deactivated earlier.
+ */
+igraph_bool_t igraph_radixheap_has_elem(const igraph_radixheap_t *h, igraph_integer_t idx) {
+    return VECTOR(h->state)[idx] != 0;
+}
+
+/**
+ * Returns whether the heap contains an item with the given index \em and it
+ * has not been deactivated yet.
+ */
+igraph_bool_t igraph_radixheap_has_active(const igraph_radixheap_t *h, igraph_integer_t idx) {
+    return VECTOR(h->state)[idx] == 2;
+}
+
+/**
+ * Returns the value of the item with the given index. For deactivated items,
+ * this is the value they had when they were removed.
+ */
+igraph_real_t igraph_radixheap_get(const igraph_radixheap_t *h, igraph_integer_t idx) {
+    return VECTOR(h->value)[idx];
+}
+
+/**
+ * Lowers the value of the active item with the given index. The new value
+ * must not be smaller than the last removed minimum.
+ */
+igraph_error_t igraph_radixheap_decrease(igraph_radixheap_t *h, igraph_integer_t idx,
+                                         igraph_real_t elem) {
+    int old = BUCKET(h, idx), new;
+    IGRAPH_ASSERT(igraph_i_radixheap_key(elem) >= h->last);
+    VECTOR(h->value)[idx] = elem;
+    new = BUCKET(h, idx);
+    if (new != old) {
+        IGRAPH_CHECK(igraph_vector_int_push_back(h->bucket[new], idx));
+    }
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * Deactivates a minimal item of the radix heap, and returns its index and
+ * value in \p idx and \p value . The heap must not be empty. Deactivated
+ * items are no longer in the heap, but \ref igraph_radixheap_has_elem() and
+ * \ref igraph_radixheap_get() still know about them.
+ */
+igraph_error_t igraph_radixheap_deactivate_min(igraph_radixheap_t *h,
+                                               igraph_integer_t *idx, igraph_real_t *value) {
+    igraph_vector_int_t *bucket0 = h->bucket[0];
+
+    while (true) {
+        igraph_integer_t i, n;
+        int b;
+        uint64_t min = UINT64_MAX;
+        igraph_vector_int_t *from;
+
+        while (!igraph_vector_int_empty(bucket0)) {
+            i = igraph_vector_int_pop_back(bucket0);
+            if (VECTOR(h->state)[i] == 2) {
+                /* Items in bucket 0 are never stale while active */
+                VECTOR(h->state)[i] = 1;
+                h->count--;
+                *idx = i;
+                *value = VECTOR(h->value)[i];
+                return IGRAPH_SUCCESS;
+            }
+        }
+
+        for (b = 1; igraph_vector_int_empty(h->bucket[b]); b++) ;
+        from = h->bucket[b];
+        n = igraph_vector_int_size(from);
+
+        /* Find the smallest valid key; the bucket may hold stale entries only */
+        for (igraph_integer_t j = 0; j < n; j++) {
+            i = VECTOR(*from)[j];
+            if (VECTOR(h->state)[i] == 2 && BUCKET(h, i) == b) {
+                uint64_t key = igraph_i_radixheap_key(VECTOR(h->value)[i]);
+                if (key < min) {
+                    min = key;
+                }
+            }
+        }
+
+        if (min != UINT64_MAX) {
+            for (igraph_integer_t j = 0; j < n; j++) {
+                i = VECTOR(*from)[j];
+                if (VECTOR(h->state)[i] == 2 && BUCKET(h, i) == b) {
+                    uint64_t key = igraph_i_radixheap_key(VECTOR(h->value)[i]);
+                    IGRAPH_CHECK(igraph_vector_int_push_back(
+                                     h->bucket[igraph_i_radixheap_bucket(key, min)], i));
+                }
+            }
+            h->last = min;
+        }
+        igraph_vector_int_clear(from);
+    }
+}
+
+#undef BUCKET
+
+/* -------------------------------------------------- */
+/* Queue for Dijkstra's algorithm                     */
+/* -------------------------------------------------- */
+
+/**
+ * Whether a search over a graph with \p no_of_nodes vertices needs to know
+ * if all weights are integers to choose its queue. Callers check that while
+ * validating the weights, and only if this returns true.
+ */
+igraph_bool_t igraph_i_dijkstra_heap_needs_integer_check(igraph_integer_t no_of_nodes) {
+    return no_of_nodes >= IGRAPH_I_2WHEAP_DARY_MIN_SIZE;
+}
+
+/**
+ * Chooses the queue for a search over a graph with \p no_of_nodes vertices.
+ * Small graphs fit in cache, where the binary heap does the fewest
+ * comparisons. For larger ones, the radix heap is fastest when all weights
+ * are integers, as many vertices then share the same distance and are
+ * removed without redistributing any bucket. Otherwise a heap with more
+ * children per node wins.
+ */
+igraph_i_heap_type_t igraph_i_dijkstra_heap_type(igraph_integer_t no_of_nodes,
+                                                 igraph_bool_t integer_weights) {
+    if (no_of_nodes < IGRAPH_I_2WHEAP_DARY_MIN_SIZE) {
+        return IGRAPH_I_HEAP_2ARY;
+    }
+    return integer_weights ? IGRAPH_I_HEAP_RADIX : IGRAPH_I_HEAP_4ARY;
+}
+
+/**
+ * Initializes a queue of vertices by distance, for at most \p size vertices.
+ * \p type must not be \c IGRAPH_I_HEAP_AUTO, see
+ * \ref igraph_i_dijkstra_heap_type(). The distances added to the queue must
+ * never be smaller than the last removed one.
+ */
+igraph_error_t igraph_i_dijkstra_queue_init(igraph_i_dijkstra_queue_t *q,
+                                            igraph_integer_t size,
+                                            igraph_i_heap_type_t type) {
+    IGRAPH_ASSERT(type != IGRAPH_I_HEAP_AUTO);
+    q->radix = type == IGRAPH_I_HEAP_RADIX;
+    if (q->radix) {
+        return igraph_radixheap_init(&q->rheap, size);
+    } else {
+        igraph_integer_t arity =
+            type == IGRAPH_I_HEAP_8ARY ? 8 :
+            type == IGRAPH_I_HEAP_4ARY ? 4 : 2;
+        return igraph_2wheap_init_arity(&q->heap, size, arity);
+    }
+}
+
+void igraph_i_dijkstra_queue_destroy(igraph_i_dijkstra_queue_t *q) {
+    if (q->radix) {
+        igraph_radixheap_destroy(&q->rheap);
+    } else {
+        igraph_2wheap_destroy(&q->heap);
+    }
+}
+
+void igraph_i_dijkstra_queue_clear(igraph_i_dijkstra_queue_t *q) {
+    if (q->radix) {
+        igraph_radixheap_clear(&q->rheap);
+    } else {
+        igraph_2wheap_clear(&q->heap);
+    }
+}
+
+igraph_bool_t igraph_i_dijkstra_queue_empty(const igraph_i_dijkstra_queue_t *q) {
+    return q->radix ? igraph_radixheap_empty(&q->rheap) : igraph_2wheap_empty(&q->heap);
+}
+
+/**
+ * Returns whether the vertex was ever added to the queue since it was last
+ * cleared, including vertices that were already removed.
+ */
+igraph_bool_t igraph_i_dijkstra_queue_has_elem(const igraph_i_dijkstra_queue_t *q,
+                                               igraph_integer_t idx) {
+    return q->radix ? igraph_radixheap_has_elem(&q->rheap, idx) : igraph_2wheap_has_elem(&q->heap, idx);
+}
+
+/**
+ * Returns whether the vertex is in the queue.
+ */
+igraph_bool_t igraph_i_dijkstra_queue_has_active(const igraph_i_dijkstra_queue_t *q,
+                                                 igraph_integer_t idx) {
+    return q->radix ? igraph_radixheap_has_active(&q->rheap, idx) : igraph_2wheap_has_active(&q->heap, idx);
+}
+
+/**
+ * Returns the current distance of a vertex in the queue.
+ */
+igraph_real_t igraph_i_dijkstra_queue_get(const igraph_i_dijkstra_queue_t *q,
+                                          igraph_integer_t idx) {
+    return q->radix ? igraph_radixheap_get(&q->rheap, idx) : -igraph_2wheap_get(&q->heap, idx);
+}
+
+/**
+ * Adds a vertex that was never in the queue.
+ */
+igraph_error_t igraph_i_dijkstra_queue_push(igraph_i_dijkstra_queue_t *q,
+                                            igraph_integer_t idx, igraph_real_t dist) {
+    if (q->radix) {
+        return igraph_radixheap_push_with_index(&q->rheap, idx, dist);
+    } else {
+        /* Many systems distinguish between +0.0 and -0.0. Since we store
+         * negative distances in the two-way heap, we insert -0.0 for 0.0
+         * in order to get +0.0 as the final distance result. */
+        return igraph_2wheap_push_with_index(&q->heap, idx, -dist);
+    }
+}
+
+/**
+ * Lowers the distance of a vertex in the queue.
+ */
+igraph_error_t igraph_i_dijkstra_queue_decrease(igraph_i_dijkstra_queue_t *q,
+                                                igraph_integer_t idx, igraph_real_t dist) {
+    if (q->radix) {
+        return igraph_radixheap_decrease(&q->rheap, idx, dist);
+    } else {
+        igraph_2wheap_modify(&q->heap, idx, -dist);
+        return IGRAPH_SUCCESS;
+    }
+}
+
+/**
+ * Removes the closest vertex from the queue, which must not be empty, and
+ * returns it with its distance. The vertex stays known to
+ * \ref igraph_i_dijkstra_queue_has_elem().
+ */
+igraph_error_t igraph_i_dijkstra_queue_deactivate_min(igraph_i_dijkstra_queue_t *q,
+                                                      igraph_integer_t *idx,
+                                                      igraph_real_t *dist) {
+    if (q->radix) {
+        return igraph_radixheap_deactivate_min(&q->rheap, idx, dist);
+    } else {
+        *idx = igraph_2wheap_max_index(&q->heap);
+        *dist = -igraph_2wheap_deactivate_max(&q->heap);
+        return IGRAPH_SUCCESS;
+    }
+}
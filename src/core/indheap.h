@@ -26,6 +26,9 @@
 #include "igraph_decls.h"
 #include "igraph_types.h"
 #include "igraph_vector.h"
+#include "igraph_vector_list.h"
+
+#include <stdint.h>
 
 __BEGIN_DECLS
 
@@ -131,9 +134,15 @@ typedef struct igraph_2wheap_t {
      * that index[j-2] == i and data[j-2] is the corresponding item in the heap
      */
     igraph_vector_int_t index2;
+
+    /** Number of children of each node, at least 2 */
+    igraph_integer_t arity;
 } igraph_2wheap_t;
 
 IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_2wheap_init(igraph_2wheap_t *h, igraph_integer_t size);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_2wheap_init_arity(igraph_2wheap_t *h, igraph_integer_t size,
+                                                   igraph_integer_t arity);
+IGRAPH_PRIVATE_EXPORT igraph_integer_t igraph_2wheap_auto_arity(igraph_integer_t size);
 IGRAPH_PRIVATE_EXPORT void igraph_2wheap_destroy(igraph_2wheap_t *h);
 IGRAPH_PRIVATE_EXPORT void igraph_2wheap_clear(igraph_2wheap_t *h);
 IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_2wheap_push_with_index(igraph_2wheap_t *h,
@@ -152,6 +161,99 @@ IGRAPH_PRIVATE_EXPORT igraph_real_t igraph_2wheap_delete_max_index(igraph_2wheap
 IGRAPH_PRIVATE_EXPORT void igraph_2wheap_modify(igraph_2wheap_t *h, igraph_integer_t idx, igraph_real_t elem);
 IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_2wheap_check(const igraph_2wheap_t *h);
 
+/* -------------------------------------------------- */
+/* Radix heap                                         */
+/* -------------------------------------------------- */
+
+/* A minimum heap for non-negative real values, for algorithms that never add
+   an item smaller than the last removed minimum, such as Dijkstra's. Items
+   are indexed like in the two-way heap, and removed items stay known as
+   deactivated. Amortized, removing the minimum takes O(log C) time where C
+   bounds the bit patterns of the values, and everything else takes O(1)
+   time. */
+
+#define IGRAPH_I_RADIXHEAP_BUCKETS 65
+
+typedef struct igraph_radixheap_t {
+    /** Maximum number of items, and one more than the largest index */
+    igraph_integer_t size;
+
+    /** Current number of items */
+    igraph_integer_t count;
+
+    /** Bit pattern of the last removed minimum */
+    uint64_t last;
+
+    /** The value of the item with each index */
+    igraph_vector_t value;
+
+    /** 0 if an index is not in the heap, 1 if it was deactivated, 2 if
+     * it is in the heap */
+    igraph_vector_char_t state;
+
+    /** Indices of the items in each bucket, possibly with stale entries */
+    igraph_vector_int_list_t buckets;
+    igraph_vector_int_t *bucket[IGRAPH_I_RADIXHEAP_BUCKETS];
+} igraph_radixheap_t;
+
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_radixheap_init(igraph_radixheap_t *h, igraph_integer_t size);
+IGRAPH_PRIVATE_EXPORT void igraph_radixheap_destroy(igraph_radixheap_t *h);
+IGRAPH_PRIVATE_EXPORT void igraph_radixheap_clear(igraph_radixheap_t *h);
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_radixheap_empty(const igraph_radixheap_t *h);
+IGRAPH_PRIVATE_EXPORT igraph_integer_t igraph_radixheap_size(const igraph_radixheap_t *h);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_radixheap_push_with_index(igraph_radixheap_t *h,
+                                                           igraph_integer_t idx, igraph_real_t elem);
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_radixheap_has_elem(const igraph_radixheap_t *h, igraph_integer_t idx);
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_radixheap_has_active(const igraph_radixheap_t *h, igraph_integer_t idx);
+IGRAPH_PRIVATE_EXPORT igraph_real_t igraph_radixheap_get(const igraph_radixheap_t *h, igraph_integer_t idx);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_radixheap_decrease(igraph_radixheap_t *h, igraph_integer_t idx,
+                                                    igraph_real_t elem);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_radixheap_deactivate_min(igraph_radixheap_t *h,
+                                                          igraph_integer_t *idx, igraph_real_t *value);
+
+/* -------------------------------------------------- */
+/* Queue for Dijkstra's algorithm                     */
+/* -------------------------------------------------- */
+
+/* A minimum queue of vertices by distance, on top of one of the heaps above */
+
+typedef enum {
+    IGRAPH_I_HEAP_AUTO = 0,
+    IGRAPH_I_HEAP_2ARY,
+    IGRAPH_I_HEAP_4ARY,
+    IGRAPH_I_HEAP_8ARY,
+    IGRAPH_I_HEAP_RADIX
+} igraph_i_heap_type_t;
+
+typedef struct igraph_i_dijkstra_queue_t {
+    igraph_bool_t radix;
+    igraph_2wheap_t heap;     /* negated distances */
+    igraph_radixheap_t rheap;
+} igraph_i_dijkstra_queue_t;
+
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_i_dijkstra_heap_needs_integer_check(igraph_integer_t no_of_nodes);
+IGRAPH_PRIVATE_EXPORT igraph_i_heap_type_t igraph_i_dijkstra_heap_type(igraph_integer_t no_of_nodes,
+                                                            igraph_bool_t integer_weights);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_dijkstra_queue_init(igraph_i_dijkstra_queue_t *q,
+                                                       igraph_integer_t size,
+                                                       igraph_i_heap_type_t type);
+IGRAPH_PRIVATE_EXPORT void igraph_i_dijkstra_queue_destroy(igraph_i_dijkstra_queue_t *q);
+IGRAPH_PRIVATE_EXPORT void igraph_i_dijkstra_queue_clear(igraph_i_dijkstra_queue_t *q);
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_i_dijkstra_queue_empty(const igraph_i_dijkstra_queue_t *q);
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_i_dijkstra_queue_has_elem(const igraph_i_dijkstra_queue_t *q,
+                                                          igraph_integer_t idx);
+IGRAPH_PRIVATE_EXPORT igraph_bool_t igraph_i_dijkstra_queue_has_active(const igraph_i_dijkstra_queue_t *q,
+                                                            igraph_integer_t idx);
+IGRAPH_PRIVATE_EXPORT igraph_real_t igraph_i_dijkstra_queue_get(const igraph_i_dijkstra_queue_t *q,
+                                                     igraph_integer_t idx);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_dijkstra_queue_push(igraph_i_dijkstra_queue_t *q,
+                                                       igraph_integer_t idx, igraph_real_t dist);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_dijkstra_queue_decrease(igraph_i_dijkstra_queue_t *q,
+                                                           igraph_integer_t idx, igraph_real_t dist);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_dijkstra_queue_deactivate_min(igraph_i_dijkstra_queue_t *q,
+                                                                 igraph_integer_t *idx,
+                                                                 igraph_real_t *dist);
+
 __END_DECLS
 
 #endif
@@ -23,6 +23,12 @@
 
 #include "igraph_memory.h"
 
+#include "config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
 /**
  * \section about-alloc-funcs About allocation functions
  *
@@ -45,8 +51,318 @@
  * quirk of classical \c malloc(), \c realloc() and \c calloc() implementations
  * where the behaviour of allocating zero bytes is undefined. igraph allocator
  * functions will always allocate at least one byte.
+ *
+ * </para><para>
+ * The allocation functions can be backed by an arena for the duration of a
+ * computation, see \ref igraph_arena_begin().
  */
 
+/* Arena blocks start with a header and belong to a power-of-two size class.
+ * Freed blocks are kept on per-class lists while their arena is active, so
+ * scratch memory allocated and freed in a loop is reused without going to
+ * the system allocator. Blocks of up to IGRAPH_I_ARENA_SMALL bytes share
+ * chunks of IGRAPH_I_ARENA_CHUNK bytes, larger ones get a chunk of their own.
+ * Chunks outlive their arena while they hold live blocks, results allocated
+ * in an arena stay valid after it ends.
+ *
+ * The address ranges of all chunks are kept sorted, which tells arena blocks
+ * apart from memory of the system allocator when freeing. The state is
+ * thread-local, also where IGRAPH_THREAD_LOCAL is defined empty as in the R
+ * package: other threads, such as OpenMP workers running while the calling
+ * thread has an arena, allocate from the system and never see its chunks.
+ * Memory allocated in an arena must therefore be freed on the same thread. */
+
+#if defined(_MSC_VER)
+#define IGRAPH_I_ARENA_THREAD_LOCAL __declspec(thread)
+#else
+#define IGRAPH_I_ARENA_THREAD_LOCAL __thread
+#endif
+
+#define IGRAPH_I_ARENA_CHUNK (1 << 20)
+#define IGRAPH_I_ARENA_SMALL (1 << 16)
+#define IGRAPH_I_ARENA_MIN_CLASS 5 /* 32 bytes */
+#define IGRAPH_I_ARENA_CLASSES (sizeof(size_t) * 8)
+#define IGRAPH_I_ARENA_HEADER 16
+#define IGRAPH_I_ARENA_CHUNK_HEADER 32
+
+typedef struct igraph_i_arena_t igraph_i_arena_t;
+
+typedef struct igraph_i_arena_chunk_t {
+    igraph_i_arena_t *owner; /* NULL once the arena has ended */
+    size_t live;             /* number of blocks in use */
+    size_t size;             /* including this header */
+} igraph_i_arena_chunk_t;
+
+typedef struct igraph_i_arena_block_t {
+    igraph_i_arena_chunk_t *chunk;
+    size_t size;             /* requested size */
+} igraph_i_arena_block_t;
+
+typedef struct igraph_i_arena_range_t {
+    char *begin;
+    char *end;
+} igraph_i_arena_range_t;
+
+struct igraph_i_arena_t {
+    igraph_i_arena_t *parent;
+    igraph_i_arena_chunk_t *bump_chunk;
+    char *bump;
+    char *bump_end;
+    void *free_list[IGRAPH_I_ARENA_CLASSES];
+    igraph_arena_stats_t stats;
+};
+
+static IGRAPH_I_ARENA_THREAD_LOCAL igraph_i_arena_t *igraph_i_arena_top = NULL;
+static IGRAPH_I_ARENA_THREAD_LOCAL igraph_i_arena_range_t *igraph_i_arena_ranges = NULL;
+static IGRAPH_I_ARENA_THREAD_LOCAL size_t igraph_i_arena_range_count = 0;
+static IGRAPH_I_ARENA_THREAD_LOCAL size_t igraph_i_arena_range_capacity = 0;
+
+static unsigned int igraph_i_arena_class(size_t size) {
+    unsigned int cls = IGRAPH_I_ARENA_MIN_CLASS;
+    while (((size_t) 1 << cls) < size + IGRAPH_I_ARENA_HEADER) {
+        cls++;
+    }
+    return cls;
+}
+
+/* Index of the last range starting at or before ptr, or -1 */
+static ptrdiff_t igraph_i_arena_range_search(const char *ptr) {
+    ptrdiff_t lo = 0, hi = (ptrdiff_t) igraph_i_arena_range_count - 1;
+    while (lo <= hi) {
+        ptrdiff_t mid = lo + (hi - lo) / 2;
+        if (igraph_i_arena_ranges[mid].begin <= ptr) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return hi;
+}
+
+static igraph_i_arena_chunk_t *igraph_i_arena_find(const void *ptr) {
+    ptrdiff_t i;
+    if (igraph_i_arena_range_count == 0) {
+        return NULL;
+    }
+    i = igraph_i_arena_range_search(ptr);
+    if (i < 0 || (const char *) ptr >= igraph_i_arena_ranges[i].end) {
+        return NULL;
+    }
+    return (igraph_i_arena_chunk_t *) igraph_i_arena_ranges[i].begin;
+}
+
+static igraph_i_arena_chunk_t *igraph_i_arena_new_chunk(igraph_i_arena_t *arena, size_t size) {
+    igraph_i_arena_chunk_t *chunk;
+    ptrdiff_t pos;
+
+    if (igraph_i_arena_range_count == igraph_i_arena_range_capacity) {
+        size_t capacity = igraph_i_arena_range_capacity ? 2 * igraph_i_arena_range_capacity : 64;
+        igraph_i_arena_range_t *ranges =
+            realloc(igraph_i_arena_ranges, capacity * sizeof(igraph_i_arena_range_t));
+        if (ranges == NULL) {
+            return NULL;
+        }
+        igraph_i_arena_ranges = ranges;
+        igraph_i_arena_range_capacity = capacity;
+    }
+
+    chunk = malloc(size);
+    if (chunk == NULL) {
+        return NULL;
+    }
+    chunk->owner = arena;
+    chunk->live = 0;
+    chunk->size = size;
+
+    pos = igraph_i_arena_range_search((char *) chunk) + 1;
+    memmove(igraph_i_arena_ranges + pos + 1, igraph_i_arena_ranges + pos,
+            (igraph_i_arena_range_count - pos) * sizeof(igraph_i_arena_range_t));
+    igraph_i_arena_ranges[pos].begin = (char *) chunk;
+    igraph_i_arena_ranges[pos].end = (char *) chunk + size;
+    igraph_i_arena_range_count++;
+
+    return chunk;
+}
+
+static void igraph_i_arena_release_chunk(igraph_i_arena_chunk_t *chunk) {
+    ptrdiff_t pos = igraph_i_arena_range_search((char *) chunk);
+    memmove(igraph_i_arena_ranges + pos, igraph_i_arena_ranges + pos + 1,
+            (igraph_i_arena_range_count - pos - 1) * sizeof(igraph_i_arena_range_t));
+    igraph_i_arena_range_count--;
+    free(chunk);
+
+    if (igraph_i_arena_range_count == 0) {
+        free(igraph_i_arena_ranges);
+        igraph_i_arena_ranges = NULL;
+        igraph_i_arena_range_capacity = 0;
+    }
+}
+
+static void igraph_i_arena_update_peak(igraph_i_arena_t *arena) {
+    if (arena->stats.live > arena->stats.peak) {
+        arena->stats.peak = arena->stats.live;
+    }
+}
+
+static void *igraph_i_arena_malloc(igraph_i_arena_t *arena, size_t size) {
+    igraph_i_arena_chunk_t *chunk;
+    igraph_i_arena_block_t *block;
+    unsigned int cls;
+    size_t bytes;
+
+    if (size > (SIZE_MAX >> 2)) {
+        return NULL;
+    }
+
+    cls = igraph_i_arena_class(size);
+    bytes = (size_t) 1 << cls;
+
+    if (arena->free_list[cls]) {
+        block = arena->free_list[cls];
+        arena->free_list[cls] = *(void **) ((char *) block + IGRAPH_I_ARENA_HEADER);
+        chunk = block->chunk;
+    } else if (bytes <= IGRAPH_I_ARENA_SMALL) {
+        if ((size_t) (arena->bump_end - arena->bump) < bytes) {
+            chunk = igraph_i_arena_new_chunk(arena, IGRAPH_I_ARENA_CHUNK);
+            if (chunk == NULL) {
+                return NULL;
+            }
+            arena->bump_chunk = chunk;
+            arena->bump = (char *) chunk + IGRAPH_I_ARENA_CHUNK_HEADER;
+            arena->bump_end = (char *) chunk + IGRAPH_I_ARENA_CHUNK;
+        }
+        chunk = arena->bump_chunk;
+        block = (igraph_i_arena_block_t *) arena->bump;
+        arena->bump += bytes;
+    } else {
+        chunk = igraph_i_arena_new_chunk(arena, IGRAPH_I_ARENA_CHUNK_HEADER + bytes);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        block = (igraph_i_arena_block_t *) ((char *) chunk + IGRAPH_I_ARENA_CHUNK_HEADER);
+    }
+
+    block->chunk = chunk;
+    block->size = size;
+    chunk->live++;
+
+    arena->stats.allocations++;
+    arena->stats.bytes += size;
+    arena->stats.live += size;
+    igraph_i_arena_update_peak(arena);
+
+    return (char *) block + IGRAPH_I_ARENA_HEADER;
+}
+
+static void igraph_i_arena_free(igraph_i_arena_chunk_t *chunk, void *ptr) {
+    igraph_i_arena_block_t *block = (igraph_i_arena_block_t *) ((char *) ptr - IGRAPH_I_ARENA_HEADER);
+    igraph_i_arena_t *arena = chunk->owner;
+
+    chunk->live--;
+    if (arena) {
+        unsigned int cls = igraph_i_arena_class(block->size);
+        arena->stats.frees++;
+        arena->stats.live -= block->size;
+        *(void **) ptr = arena->free_list[cls];
+        arena->free_list[cls] = block;
+    } else if (chunk->live == 0) {
+        igraph_i_arena_release_chunk(chunk);
+    }
+}
+
+/**
+ * \function igraph_arena_begin
+ * \brief Serves igraph allocations from a new arena.
+ *
+ * Until the matching \ref igraph_arena_end() call, memory allocated with
+ * \ref igraph_malloc(), \ref igraph_calloc() and \ref igraph_realloc() on the
+ * calling thread, and thus by igraph functions, comes from an arena. Memory
+ * freed meanwhile is kept for reuse instead of being returned to the system,
+ * which saves the cost of repeatedly allocating the same temporary vectors.
+ * The arena also keeps allocation statistics.
+ *
+ * </para><para>
+ * Arenas nest; allocations are served by the innermost one. Memory
+ * allocated in an arena remains valid after it ends and may be freed
+ * later, but it must be freed on the thread that allocated it.
+ *
+ * \return Error code: \c IGRAPH_ENOMEM if there is not enough memory.
+ *
+ * Time complexity: O(1).
+ *
+ * \sa \ref igraph_arena_stats()
+ */
+
+igraph_error_t igraph_arena_begin(void) {
+    igraph_i_arena_t *arena = calloc(1, sizeof(igraph_i_arena_t));
+    IGRAPH_CHECK_OOM(arena, "Cannot create allocation arena.");
+    arena->parent = igraph_i_arena_top;
+    igraph_i_arena_top = arena;
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_arena_end
+ * \brief Ends the innermost arena.
+ *
+ * Memory kept for reuse by the arena is returned to the system. Chunks that
+ * still hold memory in use are returned once it is freed.
+ *
+ * \param stats If not \c NULL, the allocation statistics of the arena are
+ *        stored here, see \ref igraph_arena_stats().
+ *
+ * Time complexity: O(c), the number of chunks in use by arenas.
+ */
+
+void igraph_arena_end(igraph_arena_stats_t *stats) {
+    igraph_i_arena_t *arena = igraph_i_arena_top;
+    size_t i;
+
+    igraph_arena_stats(stats);
+    if (arena == NULL) {
+        return;
+    }
+
+    igraph_i_arena_top = arena->parent;
+    for (i = igraph_i_arena_range_count; i > 0; i--) {
+        igraph_i_arena_chunk_t *chunk = (igraph_i_arena_chunk_t *) igraph_i_arena_ranges[i - 1].begin;
+        if (chunk->owner == arena) {
+            if (chunk->live == 0) {
+                igraph_i_arena_release_chunk(chunk);
+            } else {
+                chunk->owner = NULL;
+            }
+        }
+    }
+    free(arena);
+}
+
+/**
+ * \function igraph_arena_stats
+ * \brief Allocation statistics of the innermost arena.
+ *
+ * The statistics count the allocations and frees served by the arena, the
+ * total number of bytes requested, and the number of bytes in use, both
+ * currently and at the peak. Growing memory allocated before the arena
+ * began counts as an allocation, but not towards the bytes in use.
+ *
+ * \param stats The statistics are stored here; all zero when no arena is
+ *        active.
+ *
+ * Time complexity: O(1).
+ */
+
+void igraph_arena_stats(igraph_arena_stats_t *stats) {
+    if (stats == NULL) {
+        return;
+    }
+    if (igraph_i_arena_top) {
+        *stats = igraph_i_arena_top->stats;
+    } else {
+        memset(stats, 0, sizeof(igraph_arena_stats_t));
+    }
+}
+
 /**
  * \function igraph_free
  * \brief Deallocate memory that was allocated by igraph functions.
@@ -61,7 +377,17 @@
  */
 
 void igraph_free(void *ptr) {
-    IGRAPH_FREE(ptr);
+    igraph_i_arena_chunk_t *chunk;
+
+    if (ptr == NULL) {
+        return;
+    }
+    chunk = igraph_i_arena_find(ptr);
+    if (chunk) {
+        igraph_i_arena_free(chunk, ptr);
+    } else {
+        free(ptr);
+    }
 }
 
 
@@ -81,7 +407,19 @@ void igraph_free(void *ptr) {
  */
 
 void *igraph_calloc(size_t count, size_t size) {
-    return IGRAPH_MALLOC(count * size);
+    void *ptr;
+
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    if (igraph_i_arena_top == NULL) {
+        return calloc(count * size > 0 ? count * size : 1, 1);
+    }
+    ptr = igraph_i_arena_malloc(igraph_i_arena_top, count * size > 0 ? count * size : 1);
+    if (ptr) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
 }
 
 
@@ -100,7 +438,13 @@ void *igraph_calloc(size_t count, size_t size) {
  */
 
 void *igraph_malloc(size_t size) {
-    return IGRAPH_MALLOC(size);
+    if (size == 0) {
+        size = 1;
+    }
+    if (igraph_i_arena_top == NULL) {
+        return malloc(size);
+    }
+    return igraph_i_arena_malloc(igraph_i_arena_top, size);
 }
 
 
@@ -120,5 +464,44 @@ void *igraph_malloc(size_t size) {
  */
 
 void *igraph_realloc(void* ptr, size_t size) {
-    return (void*) IGRAPH_REALLOC(ptr, size, char);
+    igraph_i_arena_chunk_t *chunk;
+    igraph_i_arena_block_t *block;
+    void *result;
+
+    if (size == 0) {
+        size = 1;
+    }
+    if (ptr == NULL) {
+        return igraph_malloc(size);
+    }
+
+    chunk = igraph_i_arena_find(ptr);
+    if (chunk == NULL) {
+        /* The size of system blocks is unknown, they cannot be moved to the
+         * arena */
+        if (igraph_i_arena_top) {
+            igraph_i_arena_top->stats.allocations++;
+            igraph_i_arena_top->stats.bytes += size;
+        }
+        return realloc(ptr, size);
+    }
+
+    block = (igraph_i_arena_block_t *) ((char *) ptr - IGRAPH_I_ARENA_HEADER);
+    if (chunk->owner && size <= (SIZE_MAX >> 2) &&
+        igraph_i_arena_class(size) == igraph_i_arena_class(block->size)) {
+        igraph_i_arena_t *arena = chunk->owner;
+        arena->stats.allocations++;
+        arena->stats.bytes += size;
+        arena->stats.live = arena->stats.live - block->size + size;
+        igraph_i_arena_update_peak(arena);
+        block->size = size;
+        return ptr;
+    }
+
+    result = igraph_malloc(size);
+    if (result) {
+        memcpy(result, ptr, block->size < size ? block->size : size);
+        igraph_i_arena_free(chunk, ptr);
+    }
+    return result;
 }
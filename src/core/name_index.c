@@ -0,0 +1,258 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#include "core/name_index.h"
+
+#include "igraph_memory.h"
+
+#include "core/strpool.h"
+
+#include <string.h>  /* strlen, strncmp */
+
+/* Initial number of hash slots, must be a power of two */
+#define IGRAPH_I_NAME_INDEX_MIN_SLOTS 16
+
+/**
+ * \ingroup internal
+ * \brief Initializes an empty name index.
+ *
+ * \param idx Pointer to an uninitialized name index.
+ * \return Error code.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_error_t igraph_i_name_index_init(igraph_i_name_index_t *idx) {
+    IGRAPH_CHECK(igraph_strvector_init(&idx->names, 0));
+    IGRAPH_FINALLY(igraph_strvector_destroy, &idx->names);
+    idx->slots = IGRAPH_CALLOC(IGRAPH_I_NAME_INDEX_MIN_SLOTS, igraph_i_name_index_slot_t);
+    IGRAPH_CHECK_OOM(idx->slots, "Cannot initialize name index.");
+    idx->mask = IGRAPH_I_NAME_INDEX_MIN_SLOTS - 1;
+    IGRAPH_FINALLY_CLEAN(1);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \ingroup internal
+ * \brief Destroys a name index.
+ *
+ * \param idx The name index.
+ *
+ * Time complexity: O(1), maybe more depending on the memory manager.
+ */
+
+void igraph_i_name_index_destroy(igraph_i_name_index_t *idx) {
+    igraph_strvector_destroy(&idx->names);
+    IGRAPH_FREE(idx->slots);
+}
+
+/* Rebuilds the hash table with the given number of slots, a power of two
+ * that is larger than the number of names. */
+static igraph_error_t igraph_i_name_index_rehash(igraph_i_name_index_t *idx, size_t size) {
+    size_t old_size = idx->mask + 1, mask = size - 1, i, j;
+    igraph_i_name_index_slot_t *slots;
+
+    slots = IGRAPH_CALLOC(size, igraph_i_name_index_slot_t);
+    IGRAPH_CHECK_OOM(slots, "Cannot grow name index.");
+
+    for (i = 0; i < old_size; i++) {
+        if (idx->slots[i].ref != 0) {
+            j = idx->slots[i].hash & mask;
+            while (slots[j].ref != 0) {
+                j = (j + 1) & mask;
+            }
+            slots[j] = idx->slots[i];
+        }
+    }
+
+    IGRAPH_FREE(idx->slots);
+    idx->slots = slots;
+    idx->mask = mask;
+
+    return IGRAPH_SUCCESS;
+}
+
+/* The number of slots needed to hold 'size' names at a load factor of
+ * at most 3/4. */
+static igraph_error_t igraph_i_name_index_slots_for(igraph_integer_t size, size_t *slots) {
+    size_t n = IGRAPH_I_NAME_INDEX_MIN_SLOTS;
+    while ((size_t) size > n / 4 * 3) {
+        if (n > SIZE_MAX / 2 / sizeof(igraph_i_name_index_slot_t)) {
+            IGRAPH_ERROR("Name index is too large.", IGRAPH_EOVERFLOW); /* LCOV_EXCL_LINE */
+        }
+        n *= 2;
+    }
+    *slots = n;
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \ingroup internal
+ * \brief Reserves memory for a number of names.
+ *
+ * \param idx The name index.
+ * \param size The total number of names to make room for.
+ * \return Error code.
+ *
+ * Time complexity: O(n), the number of names in the index, at most.
+ */
+
+igraph_error_t igraph_i_name_index_reserve(igraph_i_name_index_t *idx, igraph_integer_t size) {
+    size_t slots;
+    IGRAPH_CHECK(igraph_strvector_reserve(&idx->names, size));
+    IGRAPH_CHECK(igraph_i_name_index_slots_for(size, &slots));
+    if (slots > idx->mask + 1) {
+        IGRAPH_CHECK(igraph_i_name_index_rehash(idx, slots));
+    }
+    return IGRAPH_SUCCESS;
+}
+
+/* Returns the slot of the name, or the free slot where it would go. */
+static size_t igraph_i_name_index_slot(const igraph_i_name_index_t *idx,
+                                       const char *name, size_t len, uint32_t hash) {
+    size_t i = hash & idx->mask;
+    const igraph_i_name_index_slot_t *slot;
+
+    while ((slot = idx->slots + i)->ref != 0) {
+        if (slot->hash == hash) {
+            const char *str = STR(idx->names, slot->ref - 1);
+            if (strncmp(str, name, len) == 0 && str[len] == '\0') {
+                break;
+            }
+        }
+        i = (i + 1) & idx->mask;
+    }
+
+    return i;
+}
+
+/**
+ * \ingroup internal
+ * \brief The id of a name given by its length, adding it if needed.
+ *
+ * \param idx The name index.
+ * \param name The name, it does not need to be null-terminated. It must not
+ *    contain null characters.
+ * \param len The length of the name.
+ * \param id The id of the name is stored here. New names get the next
+ *    unused id, which is the number of names before adding them.
+ * \return Error code.
+ *
+ * Time complexity: O(l) expected, the length of the name.
+ */
+
+igraph_error_t igraph_i_name_index_get_len(igraph_i_name_index_t *idx,
+                                           const char *name, igraph_integer_t len,
+                                           igraph_integer_t *id) {
+    uint32_t hash = igraph_i_strpool_hash(name, (size_t) len);
+    size_t i = igraph_i_name_index_slot(idx, name, (size_t) len, hash);
+    igraph_integer_t size;
+
+    if (idx->slots[i].ref != 0) {
+        *id = idx->slots[i].ref - 1;
+        return IGRAPH_SUCCESS;
+    }
+
+    size = igraph_strvector_size(&idx->names);
+    if ((size_t) size + 1 > (idx->mask + 1) / 4 * 3) {
+        IGRAPH_CHECK(igraph_i_name_index_rehash(idx, (idx->mask + 1) * 2));
+        i = igraph_i_name_index_slot(idx, name, (size_t) len, hash);
+    }
+
+    IGRAPH_CHECK(igraph_strvector_push_back_len(&idx->names, name, len));
+    idx->slots[i].ref = size + 1;
+    idx->slots[i].hash = hash;
+    *id = size;
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \ingroup internal
+ * \brief The id of a name, adding it if needed.
+ *
+ * \param idx The name index.
+ * \param name The null-terminated name.
+ * \param id The id of the name is stored here.
+ * \return Error code.
+ *
+ * Time complexity: O(l) expected, the length of the name.
+ */
+
+igraph_error_t igraph_i_name_index_get(igraph_i_name_index_t *idx,
+                                       const char *name, igraph_integer_t *id) {
+    return igraph_i_name_index_get_len(idx, name, strlen(name), id);
+}
+
+/**
+ * \ingroup internal
+ * \brief The id of a name, without adding it.
+ *
+ * \param idx The name index.
+ * \param name The null-terminated name.
+ * \return The id of the name, or -1 if it is not in the index.
+ *
+ * Time complexity: O(l) expected, the length of the name.
+ */
+
+igraph_integer_t igraph_i_name_index_find(const igraph_i_name_index_t *idx, const char *name) {
+    size_t len = strlen(name);
+    size_t i = igraph_i_name_index_slot(idx, name, len, igraph_i_strpool_hash(name, len));
+    return idx->slots[i].ref - 1;
+}
+
+/**
+ * \ingroup internal
+ * \brief The number of names in the index.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_i_name_index_size(const igraph_i_name_index_t *idx) {
+    return igraph_strvector_size(&idx->names);
+}
+
+/**
+ * \ingroup internal
+ * \brief The name with the given id.
+ *
+ * Time complexity: O(1).
+ */
+
+const char *igraph_i_name_index_name(const igraph_i_name_index_t *idx, igraph_integer_t id) {
+    return igraph_strvector_get(&idx->names, id);
+}
+
+/**
+ * \ingroup internal
+ * \brief All names, in the order of their ids.
+ *
+ * The vector belongs to the index and is valid until the index is modified
+ * or destroyed.
+ *
+ * Time complexity: O(1).
+ */
+
+const igraph_strvector_t *igraph_i_name_index_names(const igraph_i_name_index_t *idx) {
+    return &idx->names;
+}
@@ -0,0 +1,76 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#ifndef IGRAPH_CORE_NAME_INDEX_H
+#define IGRAPH_CORE_NAME_INDEX_H
+
+#include "igraph_decls.h"
+#include "igraph_error.h"
+#include "igraph_strvector.h"
+#include "igraph_types.h"
+
+#include <stdint.h>
+
+__BEGIN_DECLS
+
+/* Maps names to consecutive ids, in the order the names were first seen.
+ * Used by the readers of formats with symbolic vertex names. The names are
+ * kept in a string vector, and an open addressing hash table maps them to
+ * their ids. */
+
+typedef struct igraph_i_name_index_slot_t {
+    igraph_integer_t ref;       /* id + 1, zero marks a free slot */
+    uint32_t hash;
+} igraph_i_name_index_slot_t;
+
+typedef struct igraph_i_name_index_t {
+    igraph_strvector_t names;   /* the name of each id */
+    igraph_i_name_index_slot_t *slots;
+    size_t mask;                /* number of slots minus one */
+} igraph_i_name_index_t;
+
+#define IGRAPH_I_NAME_INDEX_INIT_FINALLY(idx) \
+    do { IGRAPH_CHECK(igraph_i_name_index_init(idx)); \
+        IGRAPH_FINALLY(igraph_i_name_index_destroy, idx); } while (0)
+
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_name_index_init(igraph_i_name_index_t *idx);
+IGRAPH_PRIVATE_EXPORT void igraph_i_name_index_destroy(igraph_i_name_index_t *idx);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_name_index_reserve(igraph_i_name_index_t *idx,
+                                                                 igraph_integer_t size);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_name_index_get(igraph_i_name_index_t *idx,
+                                                             const char *name,
+                                                             igraph_integer_t *id);
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_name_index_get_len(igraph_i_name_index_t *idx,
+                                                                 const char *name,
+                                                                 igraph_integer_t len,
+                                                                 igraph_integer_t *id);
+IGRAPH_PRIVATE_EXPORT igraph_integer_t igraph_i_name_index_find(const igraph_i_name_index_t *idx,
+                                                                const char *name);
+IGRAPH_PRIVATE_EXPORT igraph_integer_t igraph_i_name_index_size(const igraph_i_name_index_t *idx);
+IGRAPH_PRIVATE_EXPORT const char *igraph_i_name_index_name(const igraph_i_name_index_t *idx,
+                                                           igraph_integer_t id);
+IGRAPH_PRIVATE_EXPORT const igraph_strvector_t *igraph_i_name_index_names(const igraph_i_name_index_t *idx);
+
+__END_DECLS
+
+#endif
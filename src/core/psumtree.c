@@ -266,3 +266,66 @@ igraph_integer_t igraph_psumtree_size(const igraph_psumtree_t *t) {
 igraph_real_t igraph_psumtree_sum(const igraph_psumtree_t *t) {
     return VECTOR(t->v)[0];
 }
+
+/**
+ * \ingroup psumtree
+ * \function igraph_psumtree_sample
+ * \brief Draws several items with probabilities proportional to their values.
+ *
+ * </para><para>
+ * This is the same as calling \ref igraph_psumtree_search() \p k times with
+ * uniform random numbers from <code>[0, sum)</code>, but without the
+ * per-call overhead. The items are drawn with replacement, and the tree
+ * is not modified. Use \ref igraph_alias_t instead if the values never
+ * change between draws.
+ *
+ * \param t The tree to sample from. The sum of its values must be positive.
+ * \param rng The random number generator to use, e.g.
+ *        \ref igraph_rng_default().
+ * \param res An initialized vector, the indices of the drawn items are
+ *        stored here. It will be resized as needed.
+ * \param k The number of items to draw.
+ * \return Error code, \c IGRAPH_EINVAL if the sum of the values is zero.
+ *
+ * Time complexity: O(k log n), where n is the number of items in the tree.
+ */
+igraph_error_t igraph_psumtree_sample(const igraph_psumtree_t *t, igraph_rng_t *rng,
+                                      igraph_vector_int_t *res, igraph_integer_t k) {
+    const igraph_real_t *tree = VECTOR(t->v);
+    igraph_integer_t size = igraph_vector_size(&t->v);
+    igraph_real_t sum = igraph_psumtree_sum(t);
+
+    if (k < 0) {
+        IGRAPH_ERRORF("Number of samples must not be negative, got %" IGRAPH_PRId ".",
+                      IGRAPH_EINVAL, k);
+    }
+    if (!(sum > 0)) {
+        IGRAPH_ERROR("Cannot sample from a prefix sum tree whose values are all zero.",
+                     IGRAPH_EINVAL);
+    }
+
+    IGRAPH_CHECK(igraph_vector_int_resize(res, k));
+
+    for (igraph_integer_t j = 0; j < k; j++) {
+        igraph_real_t search = igraph_rng_get_unif(rng, 0, sum);
+        igraph_integer_t i = 1;
+
+        /* Same descent as in igraph_psumtree_search() */
+        while (2 * i + 1 <= size) {
+            if (search < tree[i * 2 - 1]) {
+                i <<= 1;
+            } else {
+                search -= tree[i * 2 - 1];
+                i <<= 1;
+                i += 1;
+            }
+        }
+        if (2 * i <= size) {
+            i = 2 * i;
+        }
+
+        VECTOR(*res)[j] = i - t->offset - 1;
+    }
+
+    return IGRAPH_SUCCESS;
+}
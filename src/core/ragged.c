@@ -0,0 +1,275 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#include "igraph_ragged.h"
+
+#include <string.h>  /* memcpy */
+
+/**
+ * \section about_ragged
+ *
+ * <para>\type igraph_ragged_int_t holds a list of integer vectors in two
+ * allocations: the values of all items, one after the other, and the
+ * offset at which each item starts. Enumerations that produce many short
+ * results, such as cliques or paths, can fill it without allocating a
+ * vector for each result, as \ref igraph_vector_int_list_t does.
+ * Items can be added but not removed or resized, except by clearing the
+ * whole list.</para>
+ */
+
+/**
+ * \function igraph_ragged_int_init
+ * \brief Initializes an empty ragged array.
+ *
+ * \param r Pointer to an uninitialized ragged array.
+ * \return Error code.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_error_t igraph_ragged_int_init(igraph_ragged_int_t *r) {
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&r->values, 0);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&r->offsets, 1);
+    IGRAPH_FINALLY_CLEAN(2);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_ragged_int_destroy
+ * \brief Deallocates a ragged array.
+ *
+ * \param r The ragged array.
+ *
+ * Time complexity: O(1).
+ */
+
+void igraph_ragged_int_destroy(igraph_ragged_int_t *r) {
+    igraph_vector_int_destroy(&r->values);
+    igraph_vector_int_destroy(&r->offsets);
+}
+
+/**
+ * \function igraph_ragged_int_clear
+ * \brief Removes all items from a ragged array.
+ *
+ * The allocated memory is kept for later items.
+ *
+ * \param r The ragged array.
+ *
+ * Time complexity: O(1).
+ */
+
+void igraph_ragged_int_clear(igraph_ragged_int_t *r) {
+    igraph_vector_int_clear(&r->values);
+    igraph_vector_int_resize(&r->offsets, 1); /* cannot fail, shrinks */
+}
+
+/**
+ * \function igraph_ragged_int_reserve
+ * \brief Reserves memory for items and values.
+ *
+ * \param r The ragged array.
+ * \param items The total number of items to make room for.
+ * \param values The total number of values to make room for.
+ * \return Error code.
+ *
+ * Time complexity: O(items + values) at most.
+ */
+
+igraph_error_t igraph_ragged_int_reserve(igraph_ragged_int_t *r,
+                                         igraph_integer_t items,
+                                         igraph_integer_t values) {
+    IGRAPH_CHECK(igraph_vector_int_reserve(&r->offsets, items + 1));
+    IGRAPH_CHECK(igraph_vector_int_reserve(&r->values, values));
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_ragged_int_size
+ * \brief The number of items in a ragged array.
+ *
+ * An open item, see \ref igraph_ragged_int_push_value(), is not counted.
+ *
+ * \param r The ragged array.
+ * \return The number of items.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_ragged_int_size(const igraph_ragged_int_t *r) {
+    return igraph_vector_int_size(&r->offsets) - 1;
+}
+
+/**
+ * \function igraph_ragged_int_item_size
+ * \brief The number of values in an item.
+ *
+ * \param r The ragged array.
+ * \param i The index of the item.
+ * \return The length of item \p i.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_ragged_int_item_size(const igraph_ragged_int_t *r,
+                                             igraph_integer_t i) {
+    IGRAPH_ASSERT(0 <= i && i < igraph_ragged_int_size(r));
+    return VECTOR(r->offsets)[i + 1] - VECTOR(r->offsets)[i];
+}
+
+/**
+ * \function igraph_ragged_int_view
+ * \brief A read-only vector view of an item.
+ *
+ * The view is only valid until the ragged array is modified, as adding
+ * values may move them in memory.
+ *
+ * \param r The ragged array.
+ * \param i The index of the item.
+ * \param v Pointer to an uninitialized vector, it becomes the view. It must
+ *    not be destroyed.
+ * \return Pointer to the view, \p v.
+ *
+ * Time complexity: O(1).
+ */
+
+const igraph_vector_int_t *igraph_ragged_int_view(const igraph_ragged_int_t *r,
+                                                  igraph_integer_t i,
+                                                  igraph_vector_int_t *v) {
+    IGRAPH_ASSERT(0 <= i && i < igraph_ragged_int_size(r));
+    return igraph_vector_int_view(v, VECTOR(r->values) + VECTOR(r->offsets)[i],
+                                  igraph_ragged_int_item_size(r, i));
+}
+
+/**
+ * \function igraph_ragged_int_push_value
+ * \brief Adds a value to the open item.
+ *
+ * Values added after the last \ref igraph_ragged_int_end_item() call form
+ * the next item, once it is closed.
+ *
+ * \param r The ragged array.
+ * \param value The value to add.
+ * \return Error code.
+ *
+ * Time complexity: O(1) amortized.
+ */
+
+igraph_error_t igraph_ragged_int_push_value(igraph_ragged_int_t *r,
+                                            igraph_integer_t value) {
+    IGRAPH_CHECK(igraph_vector_int_push_back(&r->values, value));
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_ragged_int_append_item
+ * \brief Adds the values of an item to the open item.
+ *
+ * \param r The ragged array.
+ * \param from The ragged array to copy from, it may be \p r itself.
+ * \param i The index of the item in \p from.
+ * \return Error code.
+ *
+ * Time complexity: O(l) amortized, the length of the item.
+ */
+
+igraph_error_t igraph_ragged_int_append_item(igraph_ragged_int_t *r,
+                                             const igraph_ragged_int_t *from,
+                                             igraph_integer_t i) {
+    igraph_integer_t len = igraph_ragged_int_item_size(from, i);
+    igraph_integer_t size = igraph_vector_int_size(&r->values);
+
+    /* Resize first, as that may move the values of 'from' if it is 'r' */
+    IGRAPH_CHECK(igraph_vector_int_resize(&r->values, size + len));
+    if (len > 0) {
+        memcpy(VECTOR(r->values) + size, VECTOR(from->values) + VECTOR(from->offsets)[i],
+               (size_t) len * sizeof(igraph_integer_t));
+    }
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_ragged_int_end_item
+ * \brief Closes the open item and makes it the last one.
+ *
+ * The open item may be empty, this adds an empty item.
+ *
+ * \param r The ragged array.
+ * \return Error code.
+ *
+ * Time complexity: O(1) amortized.
+ */
+
+igraph_error_t igraph_ragged_int_end_item(igraph_ragged_int_t *r) {
+    IGRAPH_CHECK(igraph_vector_int_push_back(&r->offsets, igraph_vector_int_size(&r->values)));
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_ragged_int_push_back
+ * \brief Adds a copy of a vector as the last item.
+ *
+ * \param r The ragged array. It must not have an open item.
+ * \param item The vector to copy.
+ * \return Error code.
+ *
+ * Time complexity: O(l) amortized, the length of the vector.
+ */
+
+igraph_error_t igraph_ragged_int_push_back(igraph_ragged_int_t *r,
+                                           const igraph_vector_int_t *item) {
+    igraph_integer_t size = igraph_vector_int_size(&r->values);
+
+    IGRAPH_CHECK(igraph_vector_int_append(&r->values, item));
+    if (igraph_ragged_int_end_item(r) != IGRAPH_SUCCESS) {
+        /* Keep the array consistent */
+        igraph_vector_int_resize(&r->values, size);
+        IGRAPH_ERROR("Cannot add item to ragged array.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
+    }
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_ragged_int_to_list
+ * \brief Copies the items of a ragged array into a list of vectors.
+ *
+ * \param r The ragged array.
+ * \param list An initialized list, its contents are replaced by the items.
+ * \return Error code.
+ *
+ * Time complexity: O(n + v), the number of items and values.
+ */
+
+igraph_error_t igraph_ragged_int_to_list(const igraph_ragged_int_t *r,
+                                         igraph_vector_int_list_t *list) {
+    igraph_integer_t i, n = igraph_ragged_int_size(r);
+
+    igraph_vector_int_list_clear(list);
+    IGRAPH_CHECK(igraph_vector_int_list_reserve(list, n));
+    for (i = 0; i < n; i++) {
+        igraph_vector_int_t item;
+        IGRAPH_CHECK(igraph_vector_int_list_push_back_copy(
+            list, igraph_ragged_int_view(r, i, &item)));
+    }
+    return IGRAPH_SUCCESS;
+}
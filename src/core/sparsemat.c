@@ -35,9 +35,17 @@
 #include <limits.h>
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <cs/cs.h>
 #undef cs  /* because otherwise it messes up the name of the 'cs' member in igraph_sparsemat_t */
 
+/* Row-compressed products split the rows between threads above this many
+ * non-zeros; below it the threads cost more than they save. */
+#define IGRAPH_I_SPARSEMAT_CSR_PARALLEL_MIN 100000
+
 /* Returns the number of potential nonzero elements in the given sparse matrix.
  * The returned value can be used to iterate over A->cs->x no matter whether the
  * matrix is in triplet or column-compressed form */
@@ -1608,7 +1616,7 @@ static igraph_error_t igraph_i_sparsemat_arpack_multiply(igraph_real_t *to,
                                               int n,
                                               void *extra) {
     igraph_sparsemat_t *A = extra;
-    igraph_vector_t vto, vfrom;
+    igraph_vector_t vto = IGRAPH_VECTOR_NULL, vfrom = IGRAPH_VECTOR_NULL;
     igraph_vector_view(&vto, to, n);
     igraph_vector_view(&vfrom, from, n);
     igraph_vector_null(&vto);
@@ -1616,6 +1624,19 @@ static igraph_error_t igraph_i_sparsemat_arpack_multiply(igraph_real_t *to,
     return IGRAPH_SUCCESS;
 }
 
+static igraph_error_t igraph_i_sparsemat_arpack_multiply_csr(igraph_real_t *to,
+                                                  const igraph_real_t *from,
+                                                  int n,
+                                                  void *extra) {
+    igraph_sparsemat_csr_t *A = extra;
+    igraph_vector_t vto = IGRAPH_VECTOR_NULL, vfrom = IGRAPH_VECTOR_NULL;
+    igraph_vector_view(&vto, to, n);
+    igraph_vector_view(&vfrom, from, n);
+    igraph_vector_null(&vto);
+    IGRAPH_CHECK(igraph_sparsemat_csr_gaxpy(A, &vfrom, &vto));
+    return IGRAPH_SUCCESS;
+}
+
 typedef struct igraph_i_sparsemat_arpack_rssolve_data_t {
     igraph_sparsemat_symbolic_t *dis;
     igraph_sparsemat_numeric_t *din;
@@ -1629,7 +1650,7 @@ static igraph_error_t igraph_i_sparsemat_arpack_solve(igraph_real_t *to,
                                            void *extra) {
 
     igraph_i_sparsemat_arpack_rssolve_data_t *data = extra;
-    igraph_vector_t vfrom, vto;
+    igraph_vector_t vfrom = IGRAPH_VECTOR_NULL, vto = IGRAPH_VECTOR_NULL;
 
     igraph_vector_view(&vfrom, from, n);
     igraph_vector_view(&vto, to, n);
@@ -1700,7 +1721,17 @@ igraph_error_t igraph_sparsemat_arpack_rssolve(const igraph_sparsemat_t *A,
 
     options->n = (int) n;
 
-    if (options->mode == 1) {
+    if (options->mode == 1 && igraph_sparsemat_is_cc(A)) {
+        /* ARPACK multiplies with A many times, rows are faster */
+        igraph_sparsemat_csr_t csr;
+        IGRAPH_CHECK(igraph_sparsemat_csr_init(&csr, A));
+        IGRAPH_FINALLY(igraph_sparsemat_csr_destroy, &csr);
+        IGRAPH_CHECK(igraph_arpack_rssolve(igraph_i_sparsemat_arpack_multiply_csr,
+                                           (void*) &csr, options, storage,
+                                           values, vectors));
+        igraph_sparsemat_csr_destroy(&csr);
+        IGRAPH_FINALLY_CLEAN(1);
+    } else if (options->mode == 1) {
         IGRAPH_CHECK(igraph_arpack_rssolve(igraph_i_sparsemat_arpack_multiply,
                                            (void*) A, options, storage,
                                            values, vectors));
@@ -1803,6 +1834,18 @@ igraph_error_t igraph_sparsemat_arpack_rnsolve(const igraph_sparsemat_t *A,
 
     options->n = (int) n;
 
+    if (igraph_sparsemat_is_cc(A)) {
+        igraph_sparsemat_csr_t csr;
+        IGRAPH_CHECK(igraph_sparsemat_csr_init(&csr, A));
+        IGRAPH_FINALLY(igraph_sparsemat_csr_destroy, &csr);
+        IGRAPH_CHECK(igraph_arpack_rnsolve(igraph_i_sparsemat_arpack_multiply_csr,
+                                           (void*) &csr, options, storage,
+                                           values, vectors));
+        igraph_sparsemat_csr_destroy(&csr);
+        IGRAPH_FINALLY_CLEAN(1);
+        return IGRAPH_SUCCESS;
+    }
+
     return igraph_arpack_rnsolve(igraph_i_sparsemat_arpack_multiply,
                                  (void*) A, options, storage,
                                  values, vectors);
@@ -3083,6 +3126,206 @@ igraph_error_t igraph_sparsemat_multiply_by_dense(const igraph_sparsemat_t *A,
     return IGRAPH_SUCCESS;
 }
 
+/**
+ * \function igraph_sparsemat_csr_init
+ * \brief Row-compressed copy of a sparse matrix, for fast products.
+ *
+ * Column-compressed matrices are multiplied with vectors column by
+ * column, scattering into the result, which can only be done by a single
+ * thread. The row-compressed copy made by this function computes each
+ * element of the result from a single row, and splits the rows into blocks
+ * with about the same number of non-zero elements. When igraph is built
+ * with OpenMP, \ref igraph_sparsemat_csr_gaxpy() and \ref
+ * igraph_sparsemat_csr_multiply_by_dense() multiply the blocks in parallel.
+ *
+ * </para><para>
+ * Making the copy takes longer than a few products, so use it when the
+ * same matrix is multiplied many times, for example in iterative
+ * eigensolvers. The copy does not follow later changes of \p A.
+ *
+ * \param csr Pointer to an uninitialized row-compressed matrix.
+ * \param A The matrix to copy, in triplet or column-compressed format.
+ * \return Error code.
+ *
+ * Time complexity: O(n+m+nz), for an n by m matrix with nz stored
+ * elements.
+ */
+
+igraph_error_t igraph_sparsemat_csr_init(igraph_sparsemat_csr_t *csr,
+                                         const igraph_sparsemat_t *A) {
+    igraph_integer_t nrow = igraph_sparsemat_nrow(A);
+    igraph_integer_t nblocks = 1, nz, per_block, r;
+    const CS_INT *p;
+
+    /* The columns of the transpose are the rows of A */
+    if (igraph_sparsemat_is_cc(A)) {
+        IGRAPH_CHECK(igraph_sparsemat_transpose(A, &csr->rows));
+        IGRAPH_FINALLY(igraph_sparsemat_destroy, &csr->rows);
+    } else {
+        igraph_sparsemat_t t;
+        IGRAPH_CHECK(igraph_sparsemat_transpose(A, &t));
+        IGRAPH_FINALLY(igraph_sparsemat_destroy, &t);
+        IGRAPH_CHECK(igraph_sparsemat_compress(&t, &csr->rows));
+        igraph_sparsemat_destroy(&t);
+        IGRAPH_FINALLY_CLEAN(1);
+        IGRAPH_FINALLY(igraph_sparsemat_destroy, &csr->rows);
+    }
+
+    p = csr->rows.cs->p;
+    nz = p[nrow];
+
+#ifdef _OPENMP
+    /* A few blocks per thread even out rows of uneven cost */
+    if (nz >= IGRAPH_I_SPARSEMAT_CSR_PARALLEL_MIN) {
+        nblocks = 4 * omp_get_max_threads();
+    }
+#endif
+    per_block = nz / nblocks + 1;
+
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&csr->blocks, 0);
+    IGRAPH_CHECK(igraph_vector_int_reserve(&csr->blocks, nblocks + 1));
+    igraph_vector_int_push_back(&csr->blocks, 0); /* reserved */
+    for (r = 1; r < nrow; r++) {
+        if (p[r] >= per_block * igraph_vector_int_size(&csr->blocks)) {
+            IGRAPH_CHECK(igraph_vector_int_push_back(&csr->blocks, r));
+        }
+    }
+    IGRAPH_CHECK(igraph_vector_int_push_back(&csr->blocks, nrow));
+
+    IGRAPH_FINALLY_CLEAN(2);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_sparsemat_csr_destroy
+ * \brief Deallocates a row-compressed matrix.
+ *
+ * \param csr The row-compressed matrix.
+ *
+ * Time complexity: O(1).
+ */
+
+void igraph_sparsemat_csr_destroy(igraph_sparsemat_csr_t *csr) {
+    igraph_sparsemat_destroy(&csr->rows);
+    igraph_vector_int_destroy(&csr->blocks);
+}
+
+/**
+ * \function igraph_sparsemat_csr_gaxpy
+ * \brief Matrix-vector product of a row-compressed matrix, added to another vector.
+ *
+ * The result is the same as that of \ref igraph_sparsemat_gaxpy() on the
+ * original matrix, including rounding.
+ *
+ * \param csr The row-compressed matrix.
+ * \param x The input vector, its size must match the number of
+ *    columns of the matrix.
+ * \param res This vector is added to the matrix-vector product
+ *    and it is overwritten by the result.
+ * \return Error code.
+ *
+ * Time complexity: O(n+nz), for n rows and nz stored elements.
+ */
+
+igraph_error_t igraph_sparsemat_csr_gaxpy(const igraph_sparsemat_csr_t *csr,
+                                          const igraph_vector_t *x,
+                                          igraph_vector_t *res) {
+    const CS_INT *p = csr->rows.cs->p;
+    const CS_INT *i = csr->rows.cs->i;
+    const igraph_real_t *v = csr->rows.cs->x;
+    const igraph_real_t *xx = VECTOR(*x);
+    igraph_real_t *y = VECTOR(*res);
+    igraph_integer_t nblocks = igraph_vector_int_size(&csr->blocks) - 1;
+    igraph_integer_t b;
+
+    if (csr->rows.cs->m != igraph_vector_size(x) ||
+        csr->rows.cs->n != igraph_vector_size(res)) {
+        IGRAPH_ERROR("Invalid matrix/vector size for multiplication",
+                     IGRAPH_EINVAL);
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1) if (nblocks > 1)
+#endif
+    for (b = 0; b < nblocks; b++) {
+        igraph_integer_t from = VECTOR(csr->blocks)[b];
+        igraph_integer_t to = VECTOR(csr->blocks)[b + 1];
+        for (igraph_integer_t r = from; r < to; r++) {
+            /* Starting from y[r] adds in the same order as cs_gaxpy() */
+            igraph_real_t sum = y[r];
+            for (CS_INT k = p[r]; k < p[r + 1]; k++) {
+                sum += v[k] * xx[i[k]];
+            }
+            y[r] = sum;
+        }
+    }
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_sparsemat_csr_multiply_by_dense
+ * \brief Product of a row-compressed and a dense matrix.
+ *
+ * Each thread multiplies its blocks of rows with all columns of \p B.
+ * The result is the same as that of \ref
+ * igraph_sparsemat_multiply_by_dense() on the original matrix.
+ *
+ * \param csr The row-compressed matrix.
+ * \param B The dense matrix, its number of rows must match the number of
+ *    columns of the sparse matrix.
+ * \param res Initialized matrix, resized and overwritten by the result.
+ * \return Error code.
+ *
+ * Time complexity: O(p(n+nz)), for n rows, nz stored elements and p
+ * columns of \p B.
+ */
+
+igraph_error_t igraph_sparsemat_csr_multiply_by_dense(const igraph_sparsemat_csr_t *csr,
+                                                      const igraph_matrix_t *B,
+                                                      igraph_matrix_t *res) {
+    igraph_integer_t m = csr->rows.cs->n;
+    igraph_integer_t n = csr->rows.cs->m;
+    igraph_integer_t ncol = igraph_matrix_ncol(B);
+    const CS_INT *p = csr->rows.cs->p;
+    const CS_INT *i = csr->rows.cs->i;
+    const igraph_real_t *v = csr->rows.cs->x;
+    igraph_integer_t nblocks = igraph_vector_int_size(&csr->blocks) - 1;
+    const igraph_real_t *bb;
+    igraph_real_t *y;
+    igraph_integer_t b;
+
+    if (igraph_matrix_nrow(B) != n) {
+        IGRAPH_ERROR("Invalid dimensions in sparse-dense matrix product",
+                     IGRAPH_EINVAL);
+    }
+
+    IGRAPH_CHECK(igraph_matrix_resize(res, m, ncol));
+    bb = &MATRIX(*B, 0, 0);
+    y = &MATRIX(*res, 0, 0);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1) if (nblocks > 1)
+#endif
+    for (b = 0; b < nblocks; b++) {
+        igraph_integer_t from = VECTOR(csr->blocks)[b];
+        igraph_integer_t to = VECTOR(csr->blocks)[b + 1];
+        for (igraph_integer_t c = 0; c < ncol; c++) {
+            const igraph_real_t *bc = bb + c * n;
+            igraph_real_t *yc = y + c * m;
+            for (igraph_integer_t r = from; r < to; r++) {
+                igraph_real_t sum = 0.0;
+                for (CS_INT k = p[r]; k < p[r + 1]; k++) {
+                    sum += v[k] * bc[i[k]];
+                }
+                yc[r] = sum;
+            }
+        }
+    }
+
+    return IGRAPH_SUCCESS;
+}
+
 igraph_error_t igraph_sparsemat_dense_multiply(const igraph_matrix_t *A,
                                     const igraph_sparsemat_t *B,
                                     igraph_matrix_t *res) {
@@ -0,0 +1,193 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#include "core/strpool.h"
+
+#include "igraph_memory.h"
+
+#include <string.h>  /* strncmp, memcpy */
+
+/* Size of the arena chunks. Strings longer than an eighth of this get a
+ * chunk of their own, so that they do not waste the rest of a chunk. */
+#define IGRAPH_I_STRPOOL_CHUNK_SIZE 65536
+#define IGRAPH_I_STRPOOL_LARGE (IGRAPH_I_STRPOOL_CHUNK_SIZE / 8)
+
+/* Initial number of hash slots, must be a power of two */
+#define IGRAPH_I_STRPOOL_MIN_SLOTS 16
+
+struct igraph_i_strpool_chunk_t {
+    igraph_i_strpool_chunk_t *next;
+    /* the string data follows the header */
+};
+
+/* FNV-1a, followed by the MurmurHash3 finalizer so that the low bits,
+ * which select the slot, depend on all input bytes. */
+uint32_t igraph_i_strpool_hash(const char *str, size_t len) {
+    uint32_t h = 2166136261u;
+    size_t i;
+    for (i = 0; i < len; i++) {
+        h ^= (unsigned char) str[i];
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+igraph_error_t igraph_i_strpool_init(igraph_i_strpool_t *pool) {
+    pool->slots = IGRAPH_CALLOC(IGRAPH_I_STRPOOL_MIN_SLOTS, igraph_i_strpool_slot_t);
+    IGRAPH_CHECK_OOM(pool->slots, "Cannot initialize string pool.");
+
+    pool->mask = IGRAPH_I_STRPOOL_MIN_SLOTS - 1;
+    pool->count = 0;
+    pool->chunks = NULL;
+    pool->free_begin = pool->free_end = NULL;
+
+    return IGRAPH_SUCCESS;
+}
+
+void igraph_i_strpool_destroy(igraph_i_strpool_t *pool) {
+    igraph_i_strpool_chunk_t *chunk = pool->chunks, *next;
+    while (chunk) {
+        next = chunk->next;
+        IGRAPH_FREE(chunk);
+        chunk = next;
+    }
+    pool->chunks = NULL;
+    IGRAPH_FREE(pool->slots);
+}
+
+size_t igraph_i_strpool_size(const igraph_i_strpool_t *pool) {
+    return pool->count;
+}
+
+/* Doubles the hash table. The stored hashes are reused, the strings are
+ * not looked at. */
+static igraph_error_t igraph_i_strpool_grow(igraph_i_strpool_t *pool) {
+    size_t old_size = pool->mask + 1, new_size = old_size * 2;
+    size_t new_mask = new_size - 1, i, j;
+    igraph_i_strpool_slot_t *slots;
+
+    if (new_size > SIZE_MAX / sizeof(igraph_i_strpool_slot_t)) {
+        IGRAPH_ERROR("String pool is too large.", IGRAPH_EOVERFLOW); /* LCOV_EXCL_LINE */
+    }
+
+    slots = IGRAPH_CALLOC(new_size, igraph_i_strpool_slot_t);
+    IGRAPH_CHECK_OOM(slots, "Cannot grow string pool.");
+
+    for (i = 0; i < old_size; i++) {
+        if (pool->slots[i].str != NULL) {
+            j = pool->slots[i].hash & new_mask;
+            while (slots[j].str != NULL) {
+                j = (j + 1) & new_mask;
+            }
+            slots[j] = pool->slots[i];
+        }
+    }
+
+    IGRAPH_FREE(pool->slots);
+    pool->slots = slots;
+    pool->mask = new_mask;
+
+    return IGRAPH_SUCCESS;
+}
+
+/* Copies a string of the given length into the arena and terminates it. */
+static igraph_error_t igraph_i_strpool_store(igraph_i_strpool_t *pool,
+                                             const char *str, size_t len,
+                                             char **result) {
+    igraph_i_strpool_chunk_t *chunk;
+    size_t need = len + 1;
+    char *dest;
+
+    if (need > (size_t) (pool->free_end - pool->free_begin)) {
+        size_t size = need > IGRAPH_I_STRPOOL_LARGE ? need : IGRAPH_I_STRPOOL_CHUNK_SIZE;
+        if (size > SIZE_MAX - sizeof(igraph_i_strpool_chunk_t)) {
+            IGRAPH_ERROR("String is too long for string pool.", IGRAPH_EOVERFLOW); /* LCOV_EXCL_LINE */
+        }
+        chunk = IGRAPH_MALLOC(sizeof(igraph_i_strpool_chunk_t) + size);
+        IGRAPH_CHECK_OOM(chunk, "Cannot add string to string pool.");
+        dest = (char *) (chunk + 1);
+        if (size == need && pool->chunks != NULL) {
+            /* Dedicated chunk: keep filling the current one afterwards */
+            chunk->next = pool->chunks->next;
+            pool->chunks->next = chunk;
+        } else {
+            chunk->next = pool->chunks;
+            pool->chunks = chunk;
+            pool->free_begin = dest + need;
+            pool->free_end = dest + size;
+        }
+    } else {
+        dest = pool->free_begin;
+        pool->free_begin += need;
+    }
+
+    memcpy(dest, str, len);
+    dest[len] = '\0';
+    *result = dest;
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * Returns the pooled copy of the first \p len characters of \p str in
+ * \p result, adding it to the pool first if it is not there yet. The
+ * characters must not contain a null character.
+ */
+igraph_error_t igraph_i_strpool_intern(igraph_i_strpool_t *pool,
+                                       const char *str, size_t len,
+                                       char **result) {
+    uint32_t hash = igraph_i_strpool_hash(str, len);
+    size_t i = hash & pool->mask;
+    char *stored;
+
+    while (pool->slots[i].str != NULL) {
+        if (pool->slots[i].hash == hash &&
+            strncmp(pool->slots[i].str, str, len) == 0 && pool->slots[i].str[len] == '\0') {
+            *result = pool->slots[i].str;
+            return IGRAPH_SUCCESS;
+        }
+        i = (i + 1) & pool->mask;
+    }
+
+    /* Not found. Keep the load factor at most 3/4. */
+    if ((pool->count + 1) * 4 > (pool->mask + 1) * 3) {
+        IGRAPH_CHECK(igraph_i_strpool_grow(pool));
+        i = hash & pool->mask;
+        while (pool->slots[i].str != NULL) {
+            i = (i + 1) & pool->mask;
+        }
+    }
+
+    IGRAPH_CHECK(igraph_i_strpool_store(pool, str, len, &stored));
+    pool->slots[i].str = stored;
+    pool->slots[i].hash = hash;
+    pool->count++;
+    *result = stored;
+
+    return IGRAPH_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#ifndef IGRAPH_CORE_STRPOOL_H
+#define IGRAPH_CORE_STRPOOL_H
+
+#include "igraph_decls.h"
+#include "igraph_error.h"
+#include "igraph_types.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+__BEGIN_DECLS
+
+/* Pool of interned strings. Each distinct string is stored once, in large
+ * arena chunks that are only freed together with the pool, and is found
+ * through an open addressing hash table. Interning the same contents twice
+ * returns the same pointer, so interned strings from one pool are equal
+ * exactly if their pointers are. */
+
+typedef struct igraph_i_strpool_chunk_t igraph_i_strpool_chunk_t;
+
+typedef struct igraph_i_strpool_slot_t {
+    char *str;                  /* NULL marks a free slot */
+    uint32_t hash;
+} igraph_i_strpool_slot_t;
+
+typedef struct igraph_i_strpool_t {
+    igraph_i_strpool_slot_t *slots; /* open addressing hash table */
+    size_t mask;                /* number of slots minus one */
+    size_t count;               /* number of distinct strings */
+    igraph_i_strpool_chunk_t *chunks;
+    char *free_begin;           /* unused part of the newest chunk */
+    char *free_end;
+} igraph_i_strpool_t;
+
+igraph_error_t igraph_i_strpool_init(igraph_i_strpool_t *pool);
+void igraph_i_strpool_destroy(igraph_i_strpool_t *pool);
+igraph_error_t igraph_i_strpool_intern(igraph_i_strpool_t *pool,
+                                       const char *str, size_t len,
+                                       char **result);
+size_t igraph_i_strpool_size(const igraph_i_strpool_t *pool);
+
+uint32_t igraph_i_strpool_hash(const char *str, size_t len);
+
+__END_DECLS
+
+#endif
@@ -26,6 +26,7 @@
 #include "igraph_memory.h"
 #include "igraph_error.h"
 
+#include "core/strpool.h"
 #include "internal/hacks.h" /* strdup */
 #include "math/safe_intop.h"
 
@@ -48,6 +49,16 @@
  * </para>
  *
  * <para>
+ * A string vector created with \ref igraph_strvector_init_interned() keeps
+ * a single copy of each distinct string, in large blocks of memory that are
+ * released together when the vector is destroyed. This saves memory and
+ * allocations when many elements have the same value, e.g. vertex names or
+ * string attributes read from a file, and makes equal elements share the
+ * same pointer, see \ref igraph_strvector_equal_elements(). Strings removed
+ * from an interned vector are only freed when the vector is destroyed.
+ * </para>
+ *
+ * <para>
  * \example examples/simple/igraph_strvector.c
  * </para>
  */
@@ -92,10 +103,126 @@ igraph_error_t igraph_strvector_init(igraph_strvector_t *sv, igraph_integer_t si
 
     sv->stor_end = sv->stor_begin + size;
     sv->end = sv->stor_end;
+    sv->pool = NULL;
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \ingroup strvector
+ * \function igraph_strvector_init_interned
+ * \brief Initializes a string vector that stores each distinct string once.
+ *
+ * The vector behaves like one created with \ref igraph_strvector_init(),
+ * but the strings are kept in a pool owned by the vector, and adding a
+ * string that is already in the pool only stores a pointer to it. Use it
+ * for vectors with many repeated values.
+ *
+ * \param sv Pointer to an uninitialized string vector.
+ * \param len The (initial) length of the string vector.
+ * \return Error code.
+ *
+ * Time complexity: O(\p len).
+ */
+
+igraph_error_t igraph_strvector_init_interned(igraph_strvector_t *sv, igraph_integer_t size) {
+    igraph_integer_t i;
+    char *empty;
+
+    sv->stor_begin = IGRAPH_CALLOC(size, char*);
+    IGRAPH_CHECK_OOM(sv->stor_begin, "String vector init failed.");
+    IGRAPH_FINALLY(igraph_free, sv->stor_begin);
+
+    sv->pool = IGRAPH_CALLOC(1, igraph_i_strpool_t);
+    IGRAPH_CHECK_OOM(sv->pool, "String vector init failed.");
+    IGRAPH_FINALLY(igraph_free, sv->pool);
+    IGRAPH_CHECK(igraph_i_strpool_init(sv->pool));
+    IGRAPH_FINALLY(igraph_i_strpool_destroy, sv->pool);
+
+    IGRAPH_CHECK(igraph_i_strpool_intern(sv->pool, "", 0, &empty));
+    for (i = 0; i < size; i++) {
+        sv->stor_begin[i] = empty;
+    }
+
+    sv->stor_end = sv->stor_begin + size;
+    sv->end = sv->stor_end;
+    IGRAPH_FINALLY_CLEAN(3);
 
     return IGRAPH_SUCCESS;
 }
 
+/**
+ * \ingroup strvector
+ * \function igraph_strvector_is_interned
+ * \brief Whether a string vector stores each distinct string once.
+ *
+ * \param sv The string vector.
+ * \return True if \p sv was created with \ref igraph_strvector_init_interned().
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_bool_t igraph_strvector_is_interned(const igraph_strvector_t *sv) {
+    return sv->pool != NULL;
+}
+
+/**
+ * \ingroup strvector
+ * \function igraph_strvector_equal_elements
+ * \brief Whether two elements of a string vector are equal.
+ *
+ * For an interned vector only the pointers are compared.
+ *
+ * \param sv The string vector.
+ * \param i The index of the first element.
+ * \param j The index of the second element.
+ * \return True if the two strings are equal.
+ *
+ * Time complexity: O(1) for interned vectors, O(l), the length of the
+ * shorter string, otherwise.
+ */
+
+igraph_bool_t igraph_strvector_equal_elements(
+        const igraph_strvector_t *sv, igraph_integer_t i, igraph_integer_t j) {
+    const char *a = igraph_strvector_get(sv, i), *b = igraph_strvector_get(sv, j);
+    if (sv->pool != NULL || a == b) {
+        return a == b;
+    }
+    return strcmp(a, b) == 0;
+}
+
+/**
+ * Stores a copy of at most \p len characters of \p value in \p result:
+ * the pooled copy for an interned vector, a newly allocated one otherwise.
+ */
+static igraph_error_t igraph_i_strvector_copy_str(
+        igraph_strvector_t *sv, const char *value, size_t len, char **result) {
+    if (sv->pool != NULL) {
+        const char *nul = memchr(value, '\0', len);
+        if (nul != NULL) {
+            len = nul - value;
+        }
+        IGRAPH_CHECK(igraph_i_strpool_intern(sv->pool, value, len, result));
+    } else {
+        *result = strndup(value, len);
+        IGRAPH_CHECK_OOM(*result, "Cannot add string to string vector.");
+    }
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * Frees the elements in <code>[from, to)</code>, unless they are pooled.
+ */
+static void igraph_i_strvector_free_range(
+        igraph_strvector_t *sv, igraph_integer_t from, igraph_integer_t to) {
+    igraph_integer_t i;
+    if (sv->pool == NULL) {
+        for (i = from; i < to; i++) {
+            IGRAPH_FREE(sv->stor_begin[i]);
+        }
+    }
+}
+
 /**
  * \ingroup strvector
  * \function igraph_strvector_destroy
@@ -110,11 +237,13 @@ igraph_error_t igraph_strvector_init(igraph_strvector_t *sv, igraph_integer_t si
  */
 
 void igraph_strvector_destroy(igraph_strvector_t *sv) {
-    char **ptr;
     IGRAPH_ASSERT(sv != NULL);
     IGRAPH_ASSERT(sv->stor_begin != NULL);
-    for (ptr = sv->stor_begin; ptr < sv->end; ptr++) {
-        IGRAPH_FREE(*ptr);
+    if (sv->pool != NULL) {
+        igraph_i_strpool_destroy(sv->pool);
+        IGRAPH_FREE(sv->pool);
+    } else {
+        igraph_i_strvector_free_range(sv, 0, igraph_strvector_size(sv));
     }
     IGRAPH_FREE(sv->stor_begin);
 }
@@ -187,6 +316,10 @@ igraph_error_t igraph_strvector_set_len(igraph_strvector_t *sv, igraph_integer_t
     IGRAPH_ASSERT(sv->stor_begin != NULL);
     IGRAPH_ASSERT(sv->stor_begin[idx] != NULL);
 
+    if (sv->pool != NULL) {
+        return igraph_i_strvector_copy_str(sv, value, len, &sv->stor_begin[idx]);
+    }
+
     tmp = IGRAPH_REALLOC(sv->stor_begin[idx], len + 1, char);
     IGRAPH_CHECK_OOM(tmp, "Cannot reserve space for new items in string vector.");
 
@@ -212,7 +345,6 @@ igraph_error_t igraph_strvector_set_len(igraph_strvector_t *sv, igraph_integer_t
 void igraph_strvector_remove_section(
         igraph_strvector_t *sv, igraph_integer_t from, igraph_integer_t to) {
     igraph_integer_t size = igraph_strvector_size(sv);
-    igraph_integer_t i;
 
     if (from < 0) {
         from = 0;
@@ -223,9 +355,7 @@ void igraph_strvector_remove_section(
     }
 
     if (to > from) {
-        for (i = from; i < to; i++) {
-            IGRAPH_FREE(sv->stor_begin[i]);
-        }
+        igraph_i_strvector_free_range(sv, from, to);
 
         memmove(sv->stor_begin + from, sv->stor_begin + to,
                 sizeof(char*) * (sv->end - sv->stor_begin - to));
@@ -254,7 +384,8 @@ void igraph_strvector_remove(igraph_strvector_t *sv, igraph_integer_t elem) {
  * \function igraph_strvector_init_copy
  * \brief Initialization by copying.
  *
- * Initializes a string vector by copying another string vector.
+ * Initializes a string vector by copying another string vector. The copy
+ * is interned if \p from is.
  *
  * \param to Pointer to an uninitialized string vector.
  * \param from The other string vector, to be copied.
@@ -268,6 +399,14 @@ igraph_error_t igraph_strvector_init_copy(igraph_strvector_t *to,
     igraph_integer_t from_size = igraph_strvector_size(from);
     igraph_integer_t i, j;
 
+    if (from->pool != NULL) {
+        IGRAPH_CHECK(igraph_strvector_init_interned(to, 0));
+        IGRAPH_FINALLY(igraph_strvector_destroy, to);
+        IGRAPH_CHECK(igraph_strvector_append(to, from));
+        IGRAPH_FINALLY_CLEAN(1);
+        return IGRAPH_SUCCESS;
+    }
+
     to->stor_begin = IGRAPH_CALLOC(from_size, char*);
     if (to->stor_begin == NULL) {
         IGRAPH_ERROR("Cannot copy string vector.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
@@ -288,6 +427,7 @@ igraph_error_t igraph_strvector_init_copy(igraph_strvector_t *to,
 
     to->stor_end = to->stor_begin + from_size;
     to->end = to->stor_end;
+    to->pool = NULL;
 
     return IGRAPH_SUCCESS;
 }
@@ -329,26 +469,24 @@ igraph_error_t igraph_strvector_append(igraph_strvector_t *to,
     igraph_integer_t len1 = igraph_strvector_size(to), len2 = igraph_strvector_size(from);
     igraph_integer_t newlen;
     igraph_integer_t i;
-    igraph_bool_t error = false;
+    igraph_error_t err = IGRAPH_SUCCESS;
     char* tmp;
 
     IGRAPH_SAFE_ADD(len1, len2, &newlen);
     IGRAPH_CHECK(igraph_strvector_reserve(to, newlen));
 
     for (i = 0; i < len2; i++) {
-        tmp = strdup(from->stor_begin[i]);
-        if (!tmp) {
-            error = true;
+        err = igraph_i_strvector_copy_str(to, from->stor_begin[i], strlen(from->stor_begin[i]), &tmp);
+        if (err != IGRAPH_SUCCESS) {
             break;
-        } else {
-            *(to->end) = tmp;
-            to->end++;
         }
+        *(to->end) = tmp;
+        to->end++;
     }
 
-    if (error) {
+    if (err != IGRAPH_SUCCESS) {
         igraph_strvector_resize(to, len1); /* always shrinks */
-        IGRAPH_ERROR("Cannot append string vector.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
+        IGRAPH_ERROR("Cannot append string vector.", err); /* LCOV_EXCL_LINE */
     }
 
     return IGRAPH_SUCCESS;
@@ -362,7 +500,8 @@ igraph_error_t igraph_strvector_append(igraph_strvector_t *to,
  * Transfers the contents of the \p from vector to the end of \p to, clearing
  * \p from in the process. If this operation fails, both vectors are left intact.
  * This function does not copy or reallocate individual strings, therefore it
- * performs better than \ref igraph_strvector_append().
+ * performs better than \ref igraph_strvector_append(). If either vector is
+ * interned, the strings are copied as by \ref igraph_strvector_append().
  *
  * \param to   The target vector. The contents of \p from will be appended to it.
  * \param from The source vector. It will be cleared.
@@ -377,6 +516,13 @@ igraph_error_t igraph_strvector_merge(igraph_strvector_t *to, igraph_strvector_t
     char **p1, **p2, **pe;
     igraph_integer_t newlen;
 
+    if (to->pool != NULL || from->pool != NULL) {
+        /* Pooled strings belong to their vector and cannot be moved */
+        IGRAPH_CHECK(igraph_strvector_append(to, from));
+        igraph_strvector_clear(from);
+        return IGRAPH_SUCCESS;
+    }
+
     IGRAPH_SAFE_ADD(igraph_strvector_size(to), igraph_strvector_size(from), &newlen);
     IGRAPH_CHECK(igraph_strvector_reserve(to, newlen));
 
@@ -407,11 +553,7 @@ igraph_error_t igraph_strvector_merge(igraph_strvector_t *to, igraph_strvector_t
  */
 
 void igraph_strvector_clear(igraph_strvector_t *sv) {
-    igraph_integer_t i, n = igraph_strvector_size(sv);
-
-    for (i = 0; i < n; i++) {
-        IGRAPH_FREE(sv->stor_begin[i]);
-    }
+    igraph_i_strvector_free_range(sv, 0, igraph_strvector_size(sv));
     sv->end = sv->stor_begin;
 }
 
@@ -437,8 +579,14 @@ igraph_error_t igraph_strvector_resize(igraph_strvector_t *sv, igraph_integer_t
     igraph_integer_t oldsize = igraph_strvector_size(sv);
 
     if (newsize < oldsize) {
-        for (i = newsize; i < oldsize; i++) {
-            IGRAPH_FREE(sv->stor_begin[i]);
+        igraph_i_strvector_free_range(sv, newsize, oldsize);
+        sv->end = sv->stor_begin + newsize;
+    } else if (newsize > oldsize && sv->pool != NULL) {
+        char *empty;
+        IGRAPH_CHECK(igraph_strvector_reserve(sv, newsize));
+        IGRAPH_CHECK(igraph_i_strpool_intern(sv->pool, "", 0, &empty));
+        for (i = oldsize; i < newsize; i++) {
+            sv->stor_begin[i] = empty;
         }
         sv->end = sv->stor_begin + newsize;
     } else if (newsize > oldsize) {
@@ -609,11 +757,9 @@ static igraph_error_t igraph_i_strvector_expand_if_full(igraph_strvector_t *sv)
  */
 
 igraph_error_t igraph_strvector_push_back(igraph_strvector_t *sv, const char *value) {
+    char *tmp;
     IGRAPH_CHECK(igraph_i_strvector_expand_if_full(sv));
-    char *tmp = strdup(value);
-    if (! tmp) {
-        IGRAPH_ERROR("Cannot add string to string vector.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
-    }
+    IGRAPH_CHECK(igraph_i_strvector_copy_str(sv, value, strlen(value), &tmp));
     *sv->end = tmp;
     sv->end++;
 
@@ -638,11 +784,9 @@ igraph_error_t igraph_strvector_push_back_len(
         igraph_strvector_t *sv,
         const char *value, igraph_integer_t len) {
 
+    char *tmp;
     IGRAPH_CHECK(igraph_i_strvector_expand_if_full(sv));
-    char *tmp = strndup(value, len);
-    if (! tmp) {
-        IGRAPH_ERROR("Cannot add string to string vector.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
-    }
+    IGRAPH_CHECK(igraph_i_strvector_copy_str(sv, value, (size_t) len, &tmp));
     *sv->end = tmp;
     sv->end++;
 
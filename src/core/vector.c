@@ -27,7 +27,14 @@
 #include "igraph_types.h"
 #include "igraph_nongraph.h"
 
+#include "core/vector_simd.h"
+
 #include <float.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define BASE_IGRAPH_REAL
 #include "igraph_pmt.h"
@@ -114,6 +121,122 @@ igraph_error_t igraph_vector_order2(igraph_vector_t *v) {
     return IGRAPH_SUCCESS;
 }
 
+/* igraph_vector_int_pair_order() switches to an LSD radix sort from this
+ * many elements on. It makes sequential passes over digits of at most 16
+ * bits instead of chasing linked lists, and runs the passes in parallel with
+ * OpenMP. Digits are as narrow as the number of passes allows, so that the
+ * buckets stay in cache. */
+#define IGRAPH_I_RADIX_MIN_SIZE (1 << 20)
+#define IGRAPH_I_RADIX_BITS 16
+/* Smallest block of elements worth a thread */
+#define IGRAPH_I_RADIX_BLOCK (1 << 16)
+
+/* One stable counting sort pass of in to out by one digit of key. Each thread
+ * counts and then scatters its own contiguous block; hist has room for the
+ * buckets of every thread. */
+static void igraph_i_radix_pass(const igraph_integer_t *key, int shift, int width,
+                                const igraph_integer_t *in, igraph_integer_t *out,
+                                igraph_integer_t n, igraph_integer_t *hist,
+                                int threads) {
+#ifdef _OPENMP
+    #pragma omp parallel num_threads(threads)
+#endif
+    {
+#ifdef _OPENMP
+        int t = omp_get_thread_num(), nt = omp_get_num_threads();
+#else
+        int t = 0, nt = 1;
+#endif
+        igraph_integer_t from = n / nt * t + (t < n % nt ? t : n % nt);
+        igraph_integer_t to = from + n / nt + (t < n % nt ? 1 : 0);
+        igraph_integer_t buckets = (igraph_integer_t) 1 << width, mask = buckets - 1;
+        igraph_integer_t *h = hist + (size_t) t * buckets;
+        igraph_integer_t i;
+
+        memset(h, 0, sizeof(igraph_integer_t) * (size_t) buckets);
+        for (i = from; i < to; i++) {
+            h[(key[in[i]] >> shift) & mask]++;
+        }
+
+#ifdef _OPENMP
+        #pragma omp barrier
+        #pragma omp single
+#endif
+        {
+            /* Bucket offsets, thread blocks in order to keep the sort stable */
+            igraph_integer_t sum = 0, c, d;
+            int t2;
+            for (d = 0; d < buckets; d++) {
+                for (t2 = 0; t2 < nt; t2++) {
+                    c = hist[(size_t) t2 * buckets + d];
+                    hist[(size_t) t2 * buckets + d] = sum;
+                    sum += c;
+                }
+            }
+        }
+
+        for (i = from; i < to; i++) {
+            out[h[(key[in[i]] >> shift) & mask]++] = in[i];
+        }
+    }
+}
+
+static igraph_error_t igraph_i_vector_int_pair_order_radix(const igraph_vector_int_t* v,
+                                                           const igraph_vector_int_t* v2,
+                                                           igraph_vector_int_t* res,
+                                                           igraph_integer_t nodes) {
+    igraph_integer_t edges = igraph_vector_int_size(v);
+    const igraph_vector_int_t *keys[2] = { v2, v };
+    igraph_vector_int_t tmp;
+    igraph_integer_t *in, *out, *swap, *hist;
+    igraph_integer_t i;
+    int bits = 1, passes, width, shift, k, threads = 1;
+
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+    if (threads > edges / IGRAPH_I_RADIX_BLOCK) {
+        threads = edges / IGRAPH_I_RADIX_BLOCK > 0 ? (int) (edges / IGRAPH_I_RADIX_BLOCK) : 1;
+    }
+#endif
+
+    while (bits < (int) (8 * sizeof(igraph_integer_t)) - 1 && (nodes >> bits) > 0) {
+        bits++;
+    }
+    passes = (bits + IGRAPH_I_RADIX_BITS - 1) / IGRAPH_I_RADIX_BITS;
+    width = (bits + passes - 1) / passes;
+
+    IGRAPH_CHECK(igraph_vector_int_resize(res, edges));
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&tmp, edges);
+    hist = IGRAPH_CALLOC((size_t) threads << width, igraph_integer_t);
+    IGRAPH_CHECK_OOM(hist, "Cannot order edges.");
+    IGRAPH_FINALLY(igraph_free, hist);
+
+    in = VECTOR(*res);
+    out = VECTOR(tmp);
+    /* Start from decreasing indices, so that equal pairs stay in the order
+     * of the linked list sort below */
+    for (i = 0; i < edges; i++) {
+        in[i] = edges - 1 - i;
+    }
+
+    /* Secondary key first, the passes are stable */
+    for (k = 0; k < 2; k++) {
+        for (shift = 0; shift < bits; shift += width) {
+            igraph_i_radix_pass(VECTOR(*keys[k]), shift, width, in, out, edges, hist, threads);
+            swap = in; in = out; out = swap;
+        }
+    }
+    if (in != VECTOR(*res)) {
+        memcpy(VECTOR(*res), in, sizeof(igraph_integer_t) * (size_t) edges);
+    }
+
+    IGRAPH_FREE(hist);
+    igraph_vector_int_destroy(&tmp);
+    IGRAPH_FINALLY_CLEAN(2);
+
+    return IGRAPH_SUCCESS;
+}
+
 /**
  * \ingroup vector
  * \function igraph_vector_int_pair_order
@@ -131,7 +254,11 @@ igraph_error_t igraph_vector_order2(igraph_vector_t *v) {
  * \return Error code:
  *         \c IGRAPH_ENOMEM: out of memory
  *
- * Time complexity: O()
+ * </para><para>
+ * Pairs that compare equal are ordered by decreasing index. Large inputs are
+ * sorted with a parallel LSD radix sort that keeps the same order.
+ *
+ * Time complexity: O(n+nodes), n is the length of \p v.
  */
 
 igraph_error_t igraph_vector_int_pair_order(const igraph_vector_int_t* v,
@@ -145,6 +272,10 @@ igraph_error_t igraph_vector_int_pair_order(const igraph_vector_int_t* v,
     IGRAPH_ASSERT(v != NULL);
     IGRAPH_ASSERT(v->stor_begin != NULL);
 
+    if (edges >= IGRAPH_I_RADIX_MIN_SIZE) {
+        return igraph_i_vector_int_pair_order_radix(v, v2, res, nodes);
+    }
+
     IGRAPH_VECTOR_INT_INIT_FINALLY(&ptr, nodes + 1);
     IGRAPH_VECTOR_INT_INIT_FINALLY(&rad, edges);
     IGRAPH_CHECK(igraph_vector_int_resize(res, edges));
@@ -0,0 +1,811 @@
+/*
+   IGraph library.
+   Copyright (C) 2024  The igraph development team <igraph@igraph.org>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "core/vector_simd.h"
+
+#include <math.h>
+
+/* The SSE2 and AVX2 code is compiled with function-level target attributes,
+ * the rest of the library needs no special compiler flags. Other compilers
+ * and architectures use the scalar code only. */
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && \
+    !defined(IGRAPH_NO_SIMD)
+#define IGRAPH_I_SIMD_X86
+#include <immintrin.h>
+#define IGRAPH_I_SSE2 __attribute__((target("sse2")))
+#define IGRAPH_I_AVX2 __attribute__((target("avx2")))
+#endif
+
+/* Shorter arrays are not worth the dispatch */
+#define IGRAPH_I_SIMD_MIN_SIZE 16
+
+static int igraph_i_simd_current = -1;
+
+static igraph_i_simd_level_t igraph_i_simd_detect(void) {
+#ifdef IGRAPH_I_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return IGRAPH_I_SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return IGRAPH_I_SIMD_SSE2;
+    }
+#endif
+    return IGRAPH_I_SIMD_SCALAR;
+}
+
+/* The instruction set used by the kernels. Detected on first use; racing
+ * threads store the same value. */
+igraph_i_simd_level_t igraph_i_simd_level(void) {
+    if (igraph_i_simd_current < 0) {
+        igraph_i_simd_current = igraph_i_simd_detect();
+    }
+    return (igraph_i_simd_level_t) igraph_i_simd_current;
+}
+
+/* Restricts the kernels to the given instruction set, or the best supported
+ * one below it. Meant for benchmarks and tests. Returns the previous level. */
+igraph_i_simd_level_t igraph_i_simd_set_level(igraph_i_simd_level_t level) {
+    igraph_i_simd_level_t previous = igraph_i_simd_level();
+    igraph_i_simd_level_t supported = igraph_i_simd_detect();
+    igraph_i_simd_current = level < supported ? level : supported;
+    return previous;
+}
+
+/****** Scalar code ******/
+
+/* Partial results are combined in the same order as the vector code does */
+#define IGRAPH_I_REDUCE8(a, OP) \
+    (((a[0] OP a[4]) OP (a[2] OP a[6])) OP ((a[1] OP a[5]) OP (a[3] OP a[7])))
+
+static igraph_real_t igraph_i_sum_scalar(const igraph_real_t *x, igraph_integer_t n) {
+    igraph_real_t a[8] = { 0, 0, 0, 0, 0, 0, 0, 0 }, res;
+    igraph_integer_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        for (int j = 0; j < 8; j++) {
+            a[j] += x[i + j];
+        }
+    }
+    res = IGRAPH_I_REDUCE8(a, +);
+    for (; i < n; i++) {
+        res += x[i];
+    }
+    return res;
+}
+
+static igraph_real_t igraph_i_prod_scalar(const igraph_real_t *x, igraph_integer_t n) {
+    igraph_real_t a[8] = { 1, 1, 1, 1, 1, 1, 1, 1 }, res;
+    igraph_integer_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        for (int j = 0; j < 8; j++) {
+            a[j] *= x[i + j];
+        }
+    }
+    res = IGRAPH_I_REDUCE8(a, *);
+    for (; i < n; i++) {
+        res *= x[i];
+    }
+    return res;
+}
+
+static igraph_integer_t igraph_i_which_max_scalar(const igraph_real_t *x, igraph_integer_t n) {
+    igraph_integer_t max = 0;
+    if (isnan(x[0])) {
+        return 0;
+    }
+    for (igraph_integer_t i = 1; i < n; i++) {
+        if (x[i] > x[max]) {
+            max = i;
+        } else if (isnan(x[i])) {
+            return i;
+        }
+    }
+    return max;
+}
+
+static igraph_integer_t igraph_i_which_min_scalar(const igraph_real_t *x, igraph_integer_t n) {
+    igraph_integer_t min = 0;
+    if (isnan(x[0])) {
+        return 0;
+    }
+    for (igraph_integer_t i = 1; i < n; i++) {
+        if (x[i] < x[min]) {
+            min = i;
+        } else if (isnan(x[i])) {
+            return i;
+        }
+    }
+    return min;
+}
+
+static igraph_real_t igraph_i_maxdifference_scalar(const igraph_real_t *x, const igraph_real_t *y,
+                                                   igraph_integer_t n) {
+    igraph_real_t diff = 0.0;
+    for (igraph_integer_t i = 0; i < n; i++) {
+        igraph_real_t d = fabs(x[i] - y[i]);
+        if (d > diff) {
+            diff = d;
+        } else if (isnan(d)) {
+            return d;
+        }
+    }
+    return diff;
+}
+
+static igraph_integer_t igraph_i_int_which_max_scalar(const igraph_integer_t *x, igraph_integer_t n) {
+    igraph_integer_t max = 0;
+    for (igraph_integer_t i = 1; i < n; i++) {
+        if (x[i] > x[max]) {
+            max = i;
+        }
+    }
+    return max;
+}
+
+static igraph_integer_t igraph_i_int_which_min_scalar(const igraph_integer_t *x, igraph_integer_t n) {
+    igraph_integer_t min = 0;
+    for (igraph_integer_t i = 1; i < n; i++) {
+        if (x[i] < x[min]) {
+            min = i;
+        }
+    }
+    return min;
+}
+
+#ifdef IGRAPH_I_SIMD_X86
+
+static igraph_integer_t igraph_i_first_nan(const igraph_real_t *x, igraph_integer_t n) {
+    for (igraph_integer_t i = 0; i < n; i++) {
+        if (isnan(x[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/****** SSE2 code ******/
+
+IGRAPH_I_SSE2 static igraph_real_t igraph_i_sum_sse2(const igraph_real_t *x, igraph_integer_t n) {
+    __m128d s0 = _mm_setzero_pd(), s1 = s0, s2 = s0, s3 = s0, t;
+    igraph_integer_t i = 0;
+    igraph_real_t res;
+    for (; i + 8 <= n; i += 8) {
+        s0 = _mm_add_pd(s0, _mm_loadu_pd(x + i));
+        s1 = _mm_add_pd(s1, _mm_loadu_pd(x + i + 2));
+        s2 = _mm_add_pd(s2, _mm_loadu_pd(x + i + 4));
+        s3 = _mm_add_pd(s3, _mm_loadu_pd(x + i + 6));
+    }
+    t = _mm_add_pd(_mm_add_pd(s0, s2), _mm_add_pd(s1, s3));
+    res = _mm_cvtsd_f64(t) + _mm_cvtsd_f64(_mm_unpackhi_pd(t, t));
+    for (; i < n; i++) {
+        res += x[i];
+    }
+    return res;
+}
+
+IGRAPH_I_SSE2 static igraph_real_t igraph_i_prod_sse2(const igraph_real_t *x, igraph_integer_t n) {
+    __m128d s0 = _mm_set1_pd(1.0), s1 = s0, s2 = s0, s3 = s0, t;
+    igraph_integer_t i = 0;
+    igraph_real_t res;
+    for (; i + 8 <= n; i += 8) {
+        s0 = _mm_mul_pd(s0, _mm_loadu_pd(x + i));
+        s1 = _mm_mul_pd(s1, _mm_loadu_pd(x + i + 2));
+        s2 = _mm_mul_pd(s2, _mm_loadu_pd(x + i + 4));
+        s3 = _mm_mul_pd(s3, _mm_loadu_pd(x + i + 6));
+    }
+    t = _mm_mul_pd(_mm_mul_pd(s0, s2), _mm_mul_pd(s1, s3));
+    res = _mm_cvtsd_f64(t) * _mm_cvtsd_f64(_mm_unpackhi_pd(t, t));
+    for (; i < n; i++) {
+        res *= x[i];
+    }
+    return res;
+}
+
+/* Largest (max = true) or smallest element; *nan is set if x contains NaN */
+IGRAPH_I_SSE2 static igraph_real_t igraph_i_extreme_sse2(const igraph_real_t *x, igraph_integer_t n,
+                                                         igraph_bool_t max, igraph_bool_t *nan) {
+    __m128d m = _mm_set1_pd(x[0]), unord = _mm_setzero_pd();
+    igraph_integer_t i = 0;
+    igraph_real_t res, hi;
+    for (; i + 2 <= n; i += 2) {
+        __m128d v = _mm_loadu_pd(x + i);
+        m = max ? _mm_max_pd(m, v) : _mm_min_pd(m, v);
+        unord = _mm_or_pd(unord, _mm_cmpunord_pd(v, v));
+    }
+    res = _mm_cvtsd_f64(m);
+    hi = _mm_cvtsd_f64(_mm_unpackhi_pd(m, m));
+    res = max ? (hi > res ? hi : res) : (hi < res ? hi : res);
+    for (; i < n; i++) {
+        if (max ? x[i] > res : x[i] < res) {
+            res = x[i];
+        }
+        if (isnan(x[i])) {
+            unord = _mm_cmpunord_pd(_mm_set1_pd(x[i]), _mm_set1_pd(x[i]));
+        }
+    }
+    *nan = _mm_movemask_pd(unord) != 0;
+    return res;
+}
+
+IGRAPH_I_SSE2 static igraph_integer_t igraph_i_which_equal_sse2(const igraph_real_t *x, igraph_integer_t n,
+                                                                igraph_real_t value) {
+    __m128d v = _mm_set1_pd(value);
+    igraph_integer_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(x + i), v));
+        if (mask) {
+            return i + (mask & 1 ? 0 : 1);
+        }
+    }
+    for (; i < n; i++) {
+        if (x[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+IGRAPH_I_SSE2 static igraph_real_t igraph_i_maxdifference_sse2(const igraph_real_t *x, const igraph_real_t *y,
+                                                                igraph_integer_t n) {
+    const __m128d sign = _mm_set1_pd(-0.0);
+    __m128d m = _mm_setzero_pd(), unord = _mm_setzero_pd();
+    igraph_integer_t i = 0;
+    igraph_real_t res, hi;
+    for (; i + 2 <= n; i += 2) {
+        __m128d d = _mm_andnot_pd(sign, _mm_sub_pd(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i)));
+        m = _mm_max_pd(m, d);
+        unord = _mm_or_pd(unord, _mm_cmpunord_pd(d, d));
+    }
+    if (_mm_movemask_pd(unord)) {
+        return igraph_i_maxdifference_scalar(x, y, n);
+    }
+    res = _mm_cvtsd_f64(m);
+    hi = _mm_cvtsd_f64(_mm_unpackhi_pd(m, m));
+    res = hi > res ? hi : res;
+    for (; i < n; i++) {
+        igraph_real_t d = fabs(x[i] - y[i]);
+        if (d > res) {
+            res = d;
+        } else if (isnan(d)) {
+            return d;
+        }
+    }
+    return res;
+}
+
+#define IGRAPH_I_ELEMENTWISE_SSE2(name, op, scalar_op) \
+    IGRAPH_I_SSE2 static void igraph_i_##name##_sse2(igraph_real_t *x, const igraph_real_t *y, \
+                                                      igraph_integer_t n) { \
+        igraph_integer_t i = 0; \
+        for (; i + 2 <= n; i += 2) { \
+            _mm_storeu_pd(x + i, op(_mm_loadu_pd(x + i), _mm_loadu_pd(y + i))); \
+        } \
+        for (; i < n; i++) { \
+            x[i] scalar_op y[i]; \
+        } \
+    }
+
+#define IGRAPH_I_CONSTANT_SSE2(name, op, scalar_op) \
+    IGRAPH_I_SSE2 static void igraph_i_##name##_constant_sse2(igraph_real_t *x, igraph_integer_t n, \
+                                                               igraph_real_t c) { \
+        __m128d v = _mm_set1_pd(c); \
+        igraph_integer_t i = 0; \
+        for (; i + 2 <= n; i += 2) { \
+            _mm_storeu_pd(x + i, op(_mm_loadu_pd(x + i), v)); \
+        } \
+        for (; i < n; i++) { \
+            x[i] scalar_op c; \
+        } \
+    }
+
+IGRAPH_I_ELEMENTWISE_SSE2(add, _mm_add_pd, +=)
+IGRAPH_I_ELEMENTWISE_SSE2(sub, _mm_sub_pd, -=)
+IGRAPH_I_ELEMENTWISE_SSE2(mul, _mm_mul_pd, *=)
+IGRAPH_I_ELEMENTWISE_SSE2(div, _mm_div_pd, /=)
+IGRAPH_I_CONSTANT_SSE2(add, _mm_add_pd, +=)
+IGRAPH_I_CONSTANT_SSE2(mul, _mm_mul_pd, *=)
+
+/****** AVX2 code ******/
+
+IGRAPH_I_AVX2 static igraph_real_t igraph_i_sum_avx2(const igraph_real_t *x, igraph_integer_t n) {
+    __m256d s0 = _mm256_setzero_pd(), s1 = s0, s;
+    __m128d t;
+    igraph_integer_t i = 0;
+    igraph_real_t res;
+    for (; i + 8 <= n; i += 8) {
+        s0 = _mm256_add_pd(s0, _mm256_loadu_pd(x + i));
+        s1 = _mm256_add_pd(s1, _mm256_loadu_pd(x + i + 4));
+    }
+    s = _mm256_add_pd(s0, s1);
+    t = _mm_add_pd(_mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1));
+    res = _mm_cvtsd_f64(t) + _mm_cvtsd_f64(_mm_unpackhi_pd(t, t));
+    for (; i < n; i++) {
+        res += x[i];
+    }
+    return res;
+}
+
+IGRAPH_I_AVX2 static igraph_real_t igraph_i_prod_avx2(const igraph_real_t *x, igraph_integer_t n) {
+    __m256d s0 = _mm256_set1_pd(1.0), s1 = s0, s;
+    __m128d t;
+    igraph_integer_t i = 0;
+    igraph_real_t res;
+    for (; i + 8 <= n; i += 8) {
+        s0 = _mm256_mul_pd(s0, _mm256_loadu_pd(x + i));
+        s1 = _mm256_mul_pd(s1, _mm256_loadu_pd(x + i + 4));
+    }
+    s = _mm256_mul_pd(s0, s1);
+    t = _mm_mul_pd(_mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1));
+    res = _mm_cvtsd_f64(t) * _mm_cvtsd_f64(_mm_unpackhi_pd(t, t));
+    for (; i < n; i++) {
+        res *= x[i];
+    }
+    return res;
+}
+
+IGRAPH_I_AVX2 static igraph_real_t igraph_i_extreme_avx2(const igraph_real_t *x, igraph_integer_t n,
+                                                         igraph_bool_t max, igraph_bool_t *nan) {
+    __m256d m = _mm256_set1_pd(x[0]), unord = _mm256_setzero_pd();
+    igraph_integer_t i = 0;
+    igraph_real_t lanes[4], res;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(x + i);
+        m = max ? _mm256_max_pd(m, v) : _mm256_min_pd(m, v);
+        unord = _mm256_or_pd(unord, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+    }
+    *nan = _mm256_movemask_pd(unord) != 0;
+    _mm256_storeu_pd(lanes, m);
+    res = lanes[0];
+    for (int j = 1; j < 4; j++) {
+        if (max ? lanes[j] > res : lanes[j] < res) {
+            res = lanes[j];
+        }
+    }
+    for (; i < n; i++) {
+        if (max ? x[i] > res : x[i] < res) {
+            res = x[i];
+        }
+        if (isnan(x[i])) {
+            *nan = true;
+        }
+    }
+    return res;
+}
+
+IGRAPH_I_AVX2 static igraph_integer_t igraph_i_which_equal_avx2(const igraph_real_t *x, igraph_integer_t n,
+                                                                igraph_real_t value) {
+    __m256d v = _mm256_set1_pd(value);
+    igraph_integer_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(x + i), v, _CMP_EQ_OQ));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    for (; i < n; i++) {
+        if (x[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+IGRAPH_I_AVX2 static igraph_real_t igraph_i_maxdifference_avx2(const igraph_real_t *x, const igraph_real_t *y,
+                                                                igraph_integer_t n) {
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d m = _mm256_setzero_pd(), unord = _mm256_setzero_pd();
+    igraph_integer_t i = 0;
+    igraph_real_t lanes[4], res = 0.0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d d = _mm256_andnot_pd(sign, _mm256_sub_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+        m = _mm256_max_pd(m, d);
+        unord = _mm256_or_pd(unord, _mm256_cmp_pd(d, d, _CMP_UNORD_Q));
+    }
+    if (_mm256_movemask_pd(unord)) {
+        return igraph_i_maxdifference_scalar(x, y, n);
+    }
+    _mm256_storeu_pd(lanes, m);
+    for (int j = 0; j < 4; j++) {
+        if (lanes[j] > res) {
+            res = lanes[j];
+        }
+    }
+    for (; i < n; i++) {
+        igraph_real_t d = fabs(x[i] - y[i]);
+        if (d > res) {
+            res = d;
+        } else if (isnan(d)) {
+            return d;
+        }
+    }
+    return res;
+}
+
+#define IGRAPH_I_ELEMENTWISE_AVX2(name, op, scalar_op) \
+    IGRAPH_I_AVX2 static void igraph_i_##name##_avx2(igraph_real_t *x, const igraph_real_t *y, \
+                                                      igraph_integer_t n) { \
+        igraph_integer_t i = 0; \
+        for (; i + 4 <= n; i += 4) { \
+            _mm256_storeu_pd(x + i, op(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i))); \
+        } \
+        for (; i < n; i++) { \
+            x[i] scalar_op y[i]; \
+        } \
+    }
+
+#define IGRAPH_I_CONSTANT_AVX2(name, op, scalar_op) \
+    IGRAPH_I_AVX2 static void igraph_i_##name##_constant_avx2(igraph_real_t *x, igraph_integer_t n, \
+                                                               igraph_real_t c) { \
+        __m256d v = _mm256_set1_pd(c); \
+        igraph_integer_t i = 0; \
+        for (; i + 4 <= n; i += 4) { \
+            _mm256_storeu_pd(x + i, op(_mm256_loadu_pd(x + i), v)); \
+        } \
+        for (; i < n; i++) { \
+            x[i] scalar_op c; \
+        } \
+    }
+
+IGRAPH_I_ELEMENTWISE_AVX2(add, _mm256_add_pd, +=)
+IGRAPH_I_ELEMENTWISE_AVX2(sub, _mm256_sub_pd, -=)
+IGRAPH_I_ELEMENTWISE_AVX2(mul, _mm256_mul_pd, *=)
+IGRAPH_I_ELEMENTWISE_AVX2(div, _mm256_div_pd, /=)
+IGRAPH_I_CONSTANT_AVX2(add, _mm256_add_pd, +=)
+IGRAPH_I_CONSTANT_AVX2(mul, _mm256_mul_pd, *=)
+
+/* Integer kernels, on 64 or 32 bit lanes depending on igraph_integer_t. Below
+ * AVX2 the compiler's own vectorization of the scalar loops is as good. */
+
+#if IGRAPH_INTEGER_SIZE == 64
+#define IGRAPH_I_INT_LANES 4
+#define IGRAPH_I_EPI(op) _mm256_##op##_epi64
+#define IGRAPH_I_SET1(c) _mm256_set1_epi64x(c)
+#define IGRAPH_I_MAX(a, b) _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(b, a))
+#define IGRAPH_I_MIN(a, b) _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b))
+#else
+#define IGRAPH_I_INT_LANES 8
+#define IGRAPH_I_EPI(op) _mm256_##op##_epi32
+#define IGRAPH_I_SET1(c) _mm256_set1_epi32(c)
+#define IGRAPH_I_MAX(a, b) _mm256_max_epi32(a, b)
+#define IGRAPH_I_MIN(a, b) _mm256_min_epi32(a, b)
+#endif
+
+IGRAPH_I_AVX2 static igraph_integer_t igraph_i_int_sum_avx2(const igraph_integer_t *x, igraph_integer_t n) {
+    __m256i s = _mm256_setzero_si256();
+    igraph_integer_t lanes[IGRAPH_I_INT_LANES], res = 0;
+    igraph_integer_t i = 0;
+    for (; i + IGRAPH_I_INT_LANES <= n; i += IGRAPH_I_INT_LANES) {
+        s = IGRAPH_I_EPI(add)(s, _mm256_loadu_si256((const __m256i *) (x + i)));
+    }
+    _mm256_storeu_si256((__m256i *) lanes, s);
+    for (int j = 0; j < IGRAPH_I_INT_LANES; j++) {
+        res += lanes[j];
+    }
+    for (; i < n; i++) {
+        res += x[i];
+    }
+    return res;
+}
+
+IGRAPH_I_AVX2 static igraph_integer_t igraph_i_int_extreme_avx2(const igraph_integer_t *x, igraph_integer_t n,
+                                                                igraph_bool_t max) {
+    __m256i m = IGRAPH_I_SET1(x[0]);
+    igraph_integer_t lanes[IGRAPH_I_INT_LANES], res;
+    igraph_integer_t i = 0;
+    for (; i + IGRAPH_I_INT_LANES <= n; i += IGRAPH_I_INT_LANES) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (x + i));
+        m = max ? IGRAPH_I_MAX(m, v) : IGRAPH_I_MIN(m, v);
+    }
+    _mm256_storeu_si256((__m256i *) lanes, m);
+    res = lanes[0];
+    for (int j = 1; j < IGRAPH_I_INT_LANES; j++) {
+        if (max ? lanes[j] > res : lanes[j] < res) {
+            res = lanes[j];
+        }
+    }
+    for (; i < n; i++) {
+        if (max ? x[i] > res : x[i] < res) {
+            res = x[i];
+        }
+    }
+    return res;
+}
+
+IGRAPH_I_AVX2 static igraph_integer_t igraph_i_int_which_equal_avx2(const igraph_integer_t *x, igraph_integer_t n,
+                                                                    igraph_integer_t value) {
+    __m256i v = IGRAPH_I_SET1(value);
+    igraph_integer_t i = 0;
+    for (; i + IGRAPH_I_INT_LANES <= n; i += IGRAPH_I_INT_LANES) {
+        __m256i eq = IGRAPH_I_EPI(cmpeq)(_mm256_loadu_si256((const __m256i *) (x + i)), v);
+        int mask = _mm256_movemask_epi8(eq);
+        if (mask) {
+            return i + __builtin_ctz(mask) / (int) sizeof(igraph_integer_t);
+        }
+    }
+    for (; i < n; i++) {
+        if (x[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#define IGRAPH_I_INT_ELEMENTWISE_AVX2(name, op, scalar_op) \
+    IGRAPH_I_AVX2 static void igraph_i_int_##name##_avx2(igraph_integer_t *x, const igraph_integer_t *y, \
+                                                          igraph_integer_t n) { \
+        igraph_integer_t i = 0; \
+        for (; i + IGRAPH_I_INT_LANES <= n; i += IGRAPH_I_INT_LANES) { \
+            __m256i a = _mm256_loadu_si256((const __m256i *) (x + i)); \
+            __m256i b = _mm256_loadu_si256((const __m256i *) (y + i)); \
+            _mm256_storeu_si256((__m256i *) (x + i), IGRAPH_I_EPI(op)(a, b)); \
+        } \
+        for (; i < n; i++) { \
+            x[i] scalar_op y[i]; \
+        } \
+    }
+
+IGRAPH_I_INT_ELEMENTWISE_AVX2(add, add, +=)
+IGRAPH_I_INT_ELEMENTWISE_AVX2(sub, sub, -=)
+
+IGRAPH_I_AVX2 static void igraph_i_int_add_constant_avx2(igraph_integer_t *x, igraph_integer_t n,
+                                                         igraph_integer_t plus) {
+    __m256i v = IGRAPH_I_SET1(plus);
+    igraph_integer_t i = 0;
+    for (; i + IGRAPH_I_INT_LANES <= n; i += IGRAPH_I_INT_LANES) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (x + i));
+        _mm256_storeu_si256((__m256i *) (x + i), IGRAPH_I_EPI(add)(a, v));
+    }
+    for (; i < n; i++) {
+        x[i] += plus;
+    }
+}
+
+#endif /* IGRAPH_I_SIMD_X86 */
+
+/****** Dispatch ******/
+
+#ifdef IGRAPH_I_SIMD_X86
+#define IGRAPH_I_LEVEL(n) ((n) < IGRAPH_I_SIMD_MIN_SIZE ? IGRAPH_I_SIMD_SCALAR : igraph_i_simd_level())
+#else
+#define IGRAPH_I_LEVEL(n) IGRAPH_I_SIMD_SCALAR
+#endif
+
+igraph_real_t igraph_i_simd_sum(const igraph_real_t *x, igraph_integer_t n) {
+    switch (IGRAPH_I_LEVEL(n)) {
+#ifdef IGRAPH_I_SIMD_X86
+    case IGRAPH_I_SIMD_AVX2: return igraph_i_sum_avx2(x, n);
+    case IGRAPH_I_SIMD_SSE2: return igraph_i_sum_sse2(x, n);
+#endif
+    default: return igraph_i_sum_scalar(x, n);
+    }
+}
+
+igraph_real_t igraph_i_simd_prod(const igraph_real_t *x, igraph_integer_t n) {
+    switch (IGRAPH_I_LEVEL(n)) {
+#ifdef IGRAPH_I_SIMD_X86
+    case IGRAPH_I_SIMD_AVX2: return igraph_i_prod_avx2(x, n);
+    case IGRAPH_I_SIMD_SSE2: return igraph_i_prod_sse2(x, n);
+#endif
+    default: return igraph_i_prod_scalar(x, n);
+    }
+}
+
+/* Index of the first largest (max = true) or smallest element, or of the
+ * first NaN. n must be positive. */
+static igraph_integer_t igraph_i_simd_which_extreme(const igraph_real_t *x, igraph_integer_t n,
+                                                    igraph_bool_t max) {
+#ifdef IGRAPH_I_SIMD_X86
+    igraph_bool_t nan;
+    igraph_real_t value;
+    switch (IGRAPH_I_LEVEL(n)) {
+    case IGRAPH_I_SIMD_AVX2:
+        value = igraph_i_extreme_avx2(x, n, max, &nan);
+        return nan ? igraph_i_first_nan(x, n) : igraph_i_which_equal_avx2(x, n, value);
+    case IGRAPH_I_SIMD_SSE2:
+        value = igraph_i_extreme_sse2(x, n, max, &nan);
+        return nan ? igraph_i_first_nan(x, n) : igraph_i_which_equal_sse2(x, n, value);
+    default:
+        break;
+    }
+#endif
+    return max ? igraph_i_which_max_scalar(x, n) : igraph_i_which_min_scalar(x, n);
+}
+
+/* Largest (max = true) or smallest element, or the first NaN. n must be
+ * positive. */
+static igraph_real_t igraph_i_simd_extreme(const igraph_real_t *x, igraph_integer_t n,
+                                           igraph_bool_t max) {
+#ifdef IGRAPH_I_SIMD_X86
+    igraph_bool_t nan;
+    igraph_real_t value;
+    switch (IGRAPH_I_LEVEL(n)) {
+    case IGRAPH_I_SIMD_AVX2:
+        value = igraph_i_extreme_avx2(x, n, max, &nan);
+        return nan ? x[igraph_i_first_nan(x, n)] : value;
+    case IGRAPH_I_SIMD_SSE2:
+        value = igraph_i_extreme_sse2(x, n, max, &nan);
+        return nan ? x[igraph_i_first_nan(x, n)] : value;
+    default:
+        break;
+    }
+#endif
+    return x[max ? igraph_i_which_max_scalar(x, n) : igraph_i_which_min_scalar(x, n)];
+}
+
+igraph_real_t igraph_i_simd_max(const igraph_real_t *x, igraph_integer_t n) {
+    return igraph_i_simd_extreme(x, n, true);
+}
+
+igraph_real_t igraph_i_simd_min(const igraph_real_t *x, igraph_integer_t n) {
+    return igraph_i_simd_extreme(x, n, false);
+}
+
+igraph_integer_t igraph_i_simd_which_max(const igraph_real_t *x, igraph_integer_t n) {
+    return igraph_i_simd_which_extreme(x, n, true);
+}
+
+igraph_integer_t igraph_i_simd_which_min(const igraph_real_t *x, igraph_integer_t n) {
+    return igraph_i_simd_which_extreme(x, n, false);
+}
+
+igraph_real_t igraph_i_simd_maxdifference(const igraph_real_t *x, const igraph_real_t *y,
+                                          igraph_integer_t n) {
+    switch (IGRAPH_I_LEVEL(n)) {
+#ifdef IGRAPH_I_SIMD_X86
+    case IGRAPH_I_SIMD_AVX2: return igraph_i_maxdifference_avx2(x, y, n);
+    case IGRAPH_I_SIMD_SSE2: return igraph_i_maxdifference_sse2(x, y, n);
+#endif
+    default: return igraph_i_maxdifference_scalar(x, y, n);
+    }
+}
+
+#define IGRAPH_I_DISPATCH_ELEMENTWISE(name, scalar_op) \
+    void igraph_i_simd_##name(igraph_real_t *x, const igraph_real_t *y, igraph_integer_t n) { \
+        switch (IGRAPH_I_LEVEL(n)) { \
+        IGRAPH_I_CASES(name, (x, y, n)) \
+        default: \
+            for (igraph_integer_t i = 0; i < n; i++) { \
+                x[i] scalar_op y[i]; \
+            } \
+        } \
+    }
+
+#ifdef IGRAPH_I_SIMD_X86
+#define IGRAPH_I_CASES(name, args) \
+    case IGRAPH_I_SIMD_AVX2: igraph_i_##name##_avx2 args; break; \
+    case IGRAPH_I_SIMD_SSE2: igraph_i_##name##_sse2 args; break;
+#else
+#define IGRAPH_I_CASES(name, args)
+#endif
+
+IGRAPH_I_DISPATCH_ELEMENTWISE(add, +=)
+IGRAPH_I_DISPATCH_ELEMENTWISE(sub, -=)
+IGRAPH_I_DISPATCH_ELEMENTWISE(mul, *=)
+IGRAPH_I_DISPATCH_ELEMENTWISE(div, /=)
+
+void igraph_i_simd_scale(igraph_real_t *x, igraph_integer_t n, igraph_real_t by) {
+    switch (IGRAPH_I_LEVEL(n)) {
+    IGRAPH_I_CASES(mul_constant, (x, n, by))
+    default:
+        for (igraph_integer_t i = 0; i < n; i++) {
+            x[i] *= by;
+        }
+    }
+}
+
+void igraph_i_simd_add_constant(igraph_real_t *x, igraph_integer_t n, igraph_real_t plus) {
+    switch (IGRAPH_I_LEVEL(n)) {
+    IGRAPH_I_CASES(add_constant, (x, n, plus))
+    default:
+        for (igraph_integer_t i = 0; i < n; i++) {
+            x[i] += plus;
+        }
+    }
+}
+
+#ifdef IGRAPH_I_SIMD_X86
+#define IGRAPH_I_INT_CASES(name, args) \
+    case IGRAPH_I_SIMD_AVX2: return igraph_i_int_##name##_avx2 args;
+#else
+#define IGRAPH_I_INT_CASES(name, args)
+#endif
+
+igraph_integer_t igraph_i_simd_int_sum(const igraph_integer_t *x, igraph_integer_t n) {
+    igraph_integer_t res = 0;
+    switch (IGRAPH_I_LEVEL(n)) {
+    IGRAPH_I_INT_CASES(sum, (x, n))
+    default:
+        for (igraph_integer_t i = 0; i < n; i++) {
+            res += x[i];
+        }
+        return res;
+    }
+}
+
+igraph_integer_t igraph_i_simd_int_which_max(const igraph_integer_t *x, igraph_integer_t n) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        return igraph_i_int_which_equal_avx2(x, n, igraph_i_int_extreme_avx2(x, n, true));
+    }
+#endif
+    return igraph_i_int_which_max_scalar(x, n);
+}
+
+igraph_integer_t igraph_i_simd_int_which_min(const igraph_integer_t *x, igraph_integer_t n) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        return igraph_i_int_which_equal_avx2(x, n, igraph_i_int_extreme_avx2(x, n, false));
+    }
+#endif
+    return igraph_i_int_which_min_scalar(x, n);
+}
+
+igraph_integer_t igraph_i_simd_int_max(const igraph_integer_t *x, igraph_integer_t n) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        return igraph_i_int_extreme_avx2(x, n, true);
+    }
+#endif
+    return x[igraph_i_int_which_max_scalar(x, n)];
+}
+
+igraph_integer_t igraph_i_simd_int_min(const igraph_integer_t *x, igraph_integer_t n) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        return igraph_i_int_extreme_avx2(x, n, false);
+    }
+#endif
+    return x[igraph_i_int_which_min_scalar(x, n)];
+}
+
+void igraph_i_simd_int_add(igraph_integer_t *x, const igraph_integer_t *y, igraph_integer_t n) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        igraph_i_int_add_avx2(x, y, n);
+        return;
+    }
+#endif
+    for (igraph_integer_t i = 0; i < n; i++) {
+        x[i] += y[i];
+    }
+}
+
+void igraph_i_simd_int_sub(igraph_integer_t *x, const igraph_integer_t *y, igraph_integer_t n) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        igraph_i_int_sub_avx2(x, y, n);
+        return;
+    }
+#endif
+    for (igraph_integer_t i = 0; i < n; i++) {
+        x[i] -= y[i];
+    }
+}
+
+void igraph_i_simd_int_add_constant(igraph_integer_t *x, igraph_integer_t n, igraph_integer_t plus) {
+#ifdef IGRAPH_I_SIMD_X86
+    if (IGRAPH_I_LEVEL(n) == IGRAPH_I_SIMD_AVX2) {
+        igraph_i_int_add_constant_avx2(x, n, plus);
+        return;
+    }
+#endif
+    for (igraph_integer_t i = 0; i < n; i++) {
+        x[i] += plus;
+    }
+}
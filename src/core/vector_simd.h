@@ -0,0 +1,72 @@
+/*
+   IGraph library.
+   Copyright (C) 2024  The igraph development team <igraph@igraph.org>
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef IGRAPH_CORE_VECTOR_SIMD_H
+#define IGRAPH_CORE_VECTOR_SIMD_H
+
+#include "igraph_decls.h"
+#include "igraph_types.h"
+
+__BEGIN_DECLS
+
+/* Kernels behind the igraph_vector_t and igraph_vector_int_t operations of
+ * the same name. They run on raw arrays and pick SSE2, AVX2 or plain C code
+ * at runtime. The names follow the FUNCTION() convention of the vector
+ * templates, so vector.pmt can call FUNCTION(igraph_i_simd, sum) etc.
+ *
+ * Sums and products are accumulated in eight interleaved partial results on
+ * every code path, so they do not depend on the CPU, but they may differ in
+ * the last bits from strictly sequential accumulation. NaN handling matches
+ * the scalar templates. */
+
+typedef enum {
+    IGRAPH_I_SIMD_SCALAR = 0,
+    IGRAPH_I_SIMD_SSE2,
+    IGRAPH_I_SIMD_AVX2
+} igraph_i_simd_level_t;
+
+IGRAPH_PRIVATE_EXPORT igraph_i_simd_level_t igraph_i_simd_level(void);
+IGRAPH_PRIVATE_EXPORT igraph_i_simd_level_t igraph_i_simd_set_level(igraph_i_simd_level_t level);
+
+igraph_real_t igraph_i_simd_sum(const igraph_real_t *x, igraph_integer_t n);
+igraph_real_t igraph_i_simd_prod(const igraph_real_t *x, igraph_integer_t n);
+igraph_real_t igraph_i_simd_max(const igraph_real_t *x, igraph_integer_t n);
+igraph_real_t igraph_i_simd_min(const igraph_real_t *x, igraph_integer_t n);
+igraph_integer_t igraph_i_simd_which_max(const igraph_real_t *x, igraph_integer_t n);
+igraph_integer_t igraph_i_simd_which_min(const igraph_real_t *x, igraph_integer_t n);
+igraph_real_t igraph_i_simd_maxdifference(const igraph_real_t *x, const igraph_real_t *y,
+                                          igraph_integer_t n);
+void igraph_i_simd_scale(igraph_real_t *x, igraph_integer_t n, igraph_real_t by);
+void igraph_i_simd_add_constant(igraph_real_t *x, igraph_integer_t n, igraph_real_t plus);
+void igraph_i_simd_add(igraph_real_t *x, const igraph_real_t *y, igraph_integer_t n);
+void igraph_i_simd_sub(igraph_real_t *x, const igraph_real_t *y, igraph_integer_t n);
+void igraph_i_simd_mul(igraph_real_t *x, const igraph_real_t *y, igraph_integer_t n);
+void igraph_i_simd_div(igraph_real_t *x, const igraph_real_t *y, igraph_integer_t n);
+
+igraph_integer_t igraph_i_simd_int_sum(const igraph_integer_t *x, igraph_integer_t n);
+igraph_integer_t igraph_i_simd_int_max(const igraph_integer_t *x, igraph_integer_t n);
+igraph_integer_t igraph_i_simd_int_min(const igraph_integer_t *x, igraph_integer_t n);
+igraph_integer_t igraph_i_simd_int_which_max(const igraph_integer_t *x, igraph_integer_t n);
+igraph_integer_t igraph_i_simd_int_which_min(const igraph_integer_t *x, igraph_integer_t n);
+void igraph_i_simd_int_add_constant(igraph_integer_t *x, igraph_integer_t n, igraph_integer_t plus);
+void igraph_i_simd_int_add(igraph_integer_t *x, const igraph_integer_t *y, igraph_integer_t n);
+void igraph_i_simd_int_sub(igraph_integer_t *x, const igraph_integer_t *y, igraph_integer_t n);
+
+__END_DECLS
+
+#endif
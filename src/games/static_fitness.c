@@ -24,6 +24,7 @@
 #include "igraph_games.h"
 
 #include "igraph_adjlist.h"
+#include "igraph_alias.h"
 #include "igraph_conversion.h"
 #include "igraph_constructors.h"
 #include "igraph_interface.h"
@@ -62,6 +63,12 @@
  * \ref igraph_degree_sequence_game instead.
  *
  * </para><para>
+ * Vertices are drawn from alias tables, see \ref igraph_alias_t. Earlier
+ * versions searched cumulative fitness sums, so for a given random seed the
+ * generated graph differs from theirs, although it follows the same
+ * distribution.
+ *
+ * </para><para>
  * This model is commonly used to generate static scale-free networks. To
  * achieve this, you have to draw the fitness scores from the desired power-law
  * distribution. Alternatively, you may use \ref igraph_static_power_law_game
@@ -74,16 +81,19 @@
  * \param graph        Pointer to an uninitialized graph object.
  * \param fitness_out  A numeric vector containing the fitness of each vertex.
  *                     For directed graphs, this specifies the out-fitness
- *                     of each vertex.
+ *                     of each vertex. Fitness scores must be non-negative
+ *                     and finite. Unless \p no_of_edges is zero, at least
+ *                     one of them must be positive.
  * \param fitness_in   If \c NULL, the generated graph will be undirected.
  *                     If not \c NULL, this argument specifies the in-fitness
- *                     of each vertex.
+ *                     of each vertex, with the same constraints.
  * \param no_of_edges  The number of edges in the generated graph.
  * \param loops        Whether to allow loop edges in the generated graph.
  * \param multiple     Whether to allow multiple edges in the generated graph.
  *
  * \return Error code:
- *         \c IGRAPH_EINVAL: invalid parameter
+ *         \c IGRAPH_EINVAL: invalid parameter, including infinite fitness
+ *         scores and, when edges are requested, all-zero ones
  *         \c IGRAPH_ENOMEM: there is not enough
  *         memory for the operation.
  *
@@ -95,9 +105,9 @@ igraph_error_t igraph_static_fitness_game(igraph_t *graph, igraph_integer_t no_o
     igraph_vector_int_t edges = IGRAPH_VECTOR_NULL;
     igraph_integer_t no_of_nodes;
     igraph_integer_t outnodes, innodes, nodes;
-    igraph_vector_t cum_fitness_in, cum_fitness_out;
-    igraph_vector_t *p_cum_fitness_in, *p_cum_fitness_out;
-    igraph_real_t x, max_in, max_out;
+    igraph_alias_t alias_in, alias_out;
+    igraph_alias_t *p_alias_in;
+    igraph_rng_t *rng = igraph_rng_default();
     igraph_real_t max_no_of_edges;
     igraph_bool_t is_directed = (fitness_in != 0);
     igraph_real_t num_steps;
@@ -162,19 +172,19 @@ igraph_error_t igraph_static_fitness_game(igraph_t *graph, igraph_integer_t no_o
         }
     }
 
-    /* Calculate the cumulative fitness scores */
-    IGRAPH_VECTOR_INIT_FINALLY(&cum_fitness_out, no_of_nodes);
-    IGRAPH_CHECK(igraph_vector_cumsum(&cum_fitness_out, fitness_out));
-    max_out = igraph_vector_tail(&cum_fitness_out);
-    p_cum_fitness_out = &cum_fitness_out;
+    if (no_of_edges == 0) {
+        IGRAPH_CHECK(igraph_empty(graph, no_of_nodes, is_directed));
+        return IGRAPH_SUCCESS;
+    }
+
+    /* The fitness scores do not change, so endpoints are drawn from alias
+     * tables in constant time. */
+    IGRAPH_ALIAS_INIT_FINALLY(&alias_out, fitness_out);
     if (is_directed) {
-        IGRAPH_VECTOR_INIT_FINALLY(&cum_fitness_in, no_of_nodes);
-        IGRAPH_CHECK(igraph_vector_cumsum(&cum_fitness_in, fitness_in));
-        max_in = igraph_vector_tail(&cum_fitness_in);
-        p_cum_fitness_in = &cum_fitness_in;
+        IGRAPH_ALIAS_INIT_FINALLY(&alias_in, fitness_in);
+        p_alias_in = &alias_in;
     } else {
-        max_in = max_out;
-        p_cum_fitness_in = &cum_fitness_out;
+        p_alias_in = &alias_out;
     }
 
     RNG_BEGIN();
@@ -192,10 +202,8 @@ igraph_error_t igraph_static_fitness_game(igraph_t *graph, igraph_integer_t no_o
                 IGRAPH_ALLOW_INTERRUPTION();
             }
 
-            x = RNG_UNIF(0, max_out);
-            igraph_vector_binsearch(p_cum_fitness_out, x, &from);
-            x = RNG_UNIF(0, max_in);
-            igraph_vector_binsearch(p_cum_fitness_in, x, &to);
+            from = igraph_alias_draw(&alias_out, rng);
+            to = igraph_alias_draw(p_alias_in, rng);
 
             /* Skip if loop edge and loops = false */
             if (!loops && from == to) {
@@ -228,10 +236,8 @@ igraph_error_t igraph_static_fitness_game(igraph_t *graph, igraph_integer_t no_o
                 IGRAPH_ALLOW_INTERRUPTION();
             }
 
-            x = RNG_UNIF(0, max_out);
-            igraph_vector_binsearch(p_cum_fitness_out, x, &from);
-            x = RNG_UNIF(0, max_in);
-            igraph_vector_binsearch(p_cum_fitness_in, x, &to);
+            from = igraph_alias_draw(&alias_out, rng);
+            to = igraph_alias_draw(p_alias_in, rng);
 
             /* Skip if loop edge and loops = false */
             if (!loops && from == to) {
@@ -273,10 +279,10 @@ igraph_error_t igraph_static_fitness_game(igraph_t *graph, igraph_integer_t no_o
 
     /* Cleanup before we create the graph */
     if (is_directed) {
-        igraph_vector_destroy(&cum_fitness_in);
+        igraph_alias_destroy(&alias_in);
         IGRAPH_FINALLY_CLEAN(1);
     }
-    igraph_vector_destroy(&cum_fitness_out);
+    igraph_alias_destroy(&alias_out);
     IGRAPH_FINALLY_CLEAN(1);
 
     return IGRAPH_SUCCESS;
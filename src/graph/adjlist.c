@@ -26,8 +26,9 @@
 #include "igraph_interface.h"
 
 #include "core/interruption.h"
+#include "graph/caching.h"
 
-#include <string.h>   /* memset */
+#include <string.h>   /* memset, memcpy */
 #include <stdio.h>
 
 /**
@@ -39,6 +40,9 @@ static igraph_error_t igraph_i_simplify_sorted_int_adjacency_vector_in_place(
     igraph_loops_t loops, igraph_multiple_t multiple
 );
 
+static igraph_error_t igraph_i_adjlist_init_raw(const igraph_t *graph, igraph_adjlist_t *al,
+                                                igraph_neimode_t mode);
+
 /**
  * Helper function that removes loops from an incidence vector (either both
  * occurrences or only one of them).
@@ -84,6 +88,18 @@ static igraph_error_t igraph_i_remove_loops_from_incidence_vector_in_place(
  * during the computation.
  * </para>
  *
+ * <para>Algorithms that only read the neighbor lists can use a flat
+ * adjacency list instead, see \ref igraph_flat_adjlist_init(). It stores
+ * the lists of all vertices in a single array, which is faster to create
+ * and to scan for large graphs.
+ * </para>
+ *
+ * <para>Lazy lists must not be shared between threads. Parallel code can use
+ * \ref igraph_concurrent_adjlist_init() and \ref
+ * igraph_concurrent_inclist_init() instead, their rows are filled on first
+ * use by whichever thread asks first.
+ * </para>
+ *
  * <para>
  * \example examples/simple/adjlist.c
  * </para>
@@ -104,6 +120,10 @@ static igraph_error_t igraph_i_remove_loops_from_incidence_vector_in_place(
  * to a different value than \c IGRAPH_LOOPS_TWICE or setting \p multiple to a
  * different value from \c IGRAPH_MULTIPLE.
  *
+ * </para><para>
+ * If the budget set with \ref igraph_set_property_cache_budget() allows,
+ * the neighbor lists are cached with the graph until it is modified.
+ *
  * \param graph The input graph.
  * \param al Pointer to an uninitialized <type>igraph_adjlist_t</type> object.
  * \param mode Constant specifying whether outgoing
@@ -133,7 +153,7 @@ igraph_error_t igraph_adjlist_init(const igraph_t *graph, igraph_adjlist_t *al,
                         igraph_neimode_t mode, igraph_loops_t loops,
                         igraph_multiple_t multiple) {
     igraph_integer_t no_of_nodes = igraph_vcount(graph);
-    igraph_vector_int_t degrees;
+    const igraph_adjlist_t *cached;
 
     if (mode != IGRAPH_IN && mode != IGRAPH_OUT && mode != IGRAPH_ALL) {
         IGRAPH_ERROR("Cannot create adjacency list view.", IGRAPH_EINVMODE);
@@ -143,6 +163,56 @@ igraph_error_t igraph_adjlist_init(const igraph_t *graph, igraph_adjlist_t *al,
         mode = IGRAPH_ALL;
     }
 
+    /* Keep the raw neighbor lists in the property cache if the budget allows,
+     * later calls on the unchanged graph then only copy and simplify them. */
+    cached = igraph_i_property_cache_get_adjlist(graph, mode);
+    if (cached == NULL) {
+        igraph_integer_t no_of_neis = igraph_ecount(graph) * (mode == IGRAPH_ALL ? 2 : 1);
+        size_t bytes = sizeof(igraph_adjlist_t) + no_of_nodes * sizeof(igraph_vector_int_t) +
+                       no_of_neis * sizeof(igraph_integer_t);
+        if (igraph_i_property_cache_reserve(graph, bytes)) {
+            igraph_adjlist_t *raw = IGRAPH_CALLOC(1, igraph_adjlist_t);
+            IGRAPH_CHECK_OOM(raw, "Cannot create adjacency list view.");
+            IGRAPH_FINALLY(igraph_free, raw);
+            IGRAPH_CHECK(igraph_i_adjlist_init_raw(graph, raw, mode));
+            IGRAPH_FINALLY_CLEAN(1);
+            igraph_i_property_cache_set_adjlist(graph, mode, raw);
+            cached = raw;
+        }
+    }
+
+    if (cached) {
+        al->length = no_of_nodes;
+        al->adjs = IGRAPH_CALLOC(al->length, igraph_vector_int_t);
+        IGRAPH_CHECK_OOM(al->adjs, "Cannot create adjacency list view.");
+        IGRAPH_FINALLY(igraph_adjlist_destroy, al);
+        for (igraph_integer_t i = 0; i < al->length; i++) {
+            IGRAPH_CHECK(igraph_vector_int_init_copy(&al->adjs[i], &cached->adjs[i]));
+        }
+    } else {
+        IGRAPH_CHECK(igraph_i_adjlist_init_raw(graph, al, mode));
+        IGRAPH_FINALLY(igraph_adjlist_destroy, al);
+    }
+
+    for (igraph_integer_t i = 0; i < al->length; i++) {
+        IGRAPH_CHECK(igraph_i_simplify_sorted_int_adjacency_vector_in_place(
+            &al->adjs[i], i, mode, loops, multiple
+        ));
+    }
+
+    IGRAPH_FINALLY_CLEAN(1); /* igraph_adjlist_destroy */
+
+    return IGRAPH_SUCCESS;
+}
+
+/* Fills an adjacency list with the neighbor lists of igraph_neighbors(), i.e.
+ * with all loops and multi-edges. mode must be IGRAPH_ALL for undirected
+ * graphs. */
+static igraph_error_t igraph_i_adjlist_init_raw(const igraph_t *graph, igraph_adjlist_t *al,
+                                                igraph_neimode_t mode) {
+    igraph_integer_t no_of_nodes = igraph_vcount(graph);
+    igraph_vector_int_t degrees;
+
     IGRAPH_VECTOR_INT_INIT_FINALLY(&degrees, no_of_nodes);
     /* igraph_degrees() is fast when loops=true */
     IGRAPH_CHECK(igraph_degree(graph, &degrees, igraph_vss_all(), mode, /* loops= */ 1));
@@ -160,18 +230,161 @@ igraph_error_t igraph_adjlist_init(const igraph_t *graph, igraph_adjlist_t *al,
 
         IGRAPH_CHECK(igraph_vector_int_init(&al->adjs[i], VECTOR(degrees)[i]));
         IGRAPH_CHECK(igraph_neighbors(graph, &al->adjs[i], i, mode));
+    }
 
+    igraph_vector_int_destroy(&degrees);
+    IGRAPH_FINALLY_CLEAN(2); /* + igraph_adjlist_destroy */
+
+    return IGRAPH_SUCCESS;
+}
+
+/* Writes the neighbors (edges = false) or the incident edges of a vertex to
+ * dst in the order of igraph_neighbors() and igraph_incident(), i.e. with all
+ * loops and multi-edges, and returns their number. mode must be IGRAPH_ALL
+ * for undirected graphs. Never fails, so it can be called from any thread. */
+static igraph_integer_t igraph_i_raw_neighbors(const igraph_t *graph, igraph_integer_t node,
+                                               igraph_neimode_t mode, igraph_bool_t edges,
+                                               igraph_integer_t *dst) {
+    const igraph_integer_t *from = VECTOR(graph->from), *to = VECTOR(graph->to);
+    const igraph_integer_t *oi = VECTOR(graph->oi), *ii = VECTOR(graph->ii);
+    igraph_integer_t i1 = 0, j1 = 0, i2 = 0, j2 = 0, n = 0;
+
+    if (mode & IGRAPH_OUT) {
+        i1 = VECTOR(graph->os)[node];
+        j1 = VECTOR(graph->os)[node + 1];
+    }
+    if (mode & IGRAPH_IN) {
+        i2 = VECTOR(graph->is)[node];
+        j2 = VECTOR(graph->is)[node + 1];
+    }
+
+    /* Out- and in-neighbors of undirected graphs are already in order */
+    if (igraph_is_directed(graph) && mode == IGRAPH_ALL) {
+        while (i1 < j1 && i2 < j2) {
+            igraph_integer_t n1 = to[oi[i1]], n2 = from[ii[i2]];
+            if (n1 <= n2) {
+                dst[n++] = edges ? oi[i1] : n1;
+                i1++;
+            }
+            if (n2 <= n1) {
+                dst[n++] = edges ? ii[i2] : n2;
+                i2++;
+            }
+        }
+    }
+    for (; i1 < j1; i1++) {
+        dst[n++] = edges ? oi[i1] : to[oi[i1]];
+    }
+    for (; i2 < j2; i2++) {
+        dst[n++] = edges ? ii[i2] : from[ii[i2]];
+    }
+
+    return n;
+}
+
+/**
+ * \function igraph_flat_adjlist_init
+ * \brief Constructs a read-only adjacency list in a single block of memory.
+ *
+ * Creates the same neighbor lists as \ref igraph_adjlist_init(), but
+ * stores all of them in one array, in vertex order, instead of allocating
+ * a separate vector for each vertex. This is faster to build and uses less
+ * memory for large graphs, and scanning the lists is more cache friendly.
+ * The lists are accessed with \ref igraph_flat_adjlist_get(), which
+ * returns read-only vector views; use \ref igraph_adjlist_init() when the
+ * lists need to be modified.
+ *
+ * \param graph The input graph.
+ * \param al Pointer to an uninitialized <type>igraph_flat_adjlist_t</type>
+ *   object.
+ * \param mode Which neighbors to include, see \ref igraph_adjlist_init().
+ * \param loops How to treat loop edges, see \ref igraph_adjlist_init().
+ * \param multiple How to treat multiple edges, see \ref igraph_adjlist_init().
+ * \return Error code.
+ *
+ * Time complexity: O(|V|+|E|), linear in the number of vertices and
+ * edges.
+ */
+
+igraph_error_t igraph_flat_adjlist_init(const igraph_t *graph, igraph_flat_adjlist_t *al,
+                                        igraph_neimode_t mode, igraph_loops_t loops,
+                                        igraph_multiple_t multiple) {
+    igraph_integer_t no_of_nodes = igraph_vcount(graph);
+    const igraph_adjlist_t *cached;
+    igraph_integer_t *neis, size = 0;
+
+    if (mode != IGRAPH_IN && mode != IGRAPH_OUT && mode != IGRAPH_ALL) {
+        IGRAPH_ERROR("Cannot create adjacency list view.", IGRAPH_EINVMODE);
+    }
+
+    if (!igraph_is_directed(graph)) {
+        mode = IGRAPH_ALL;
+    }
+
+    cached = igraph_i_property_cache_get_adjlist(graph, mode);
+
+    /* The raw lists are written into the reserved space one after the other
+     * and simplified in place, so they never add up to more than this. */
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&al->neis, 0);
+    IGRAPH_CHECK(igraph_vector_int_reserve(&al->neis,
+                                           igraph_ecount(graph) * (mode == IGRAPH_ALL ? 2 : 1)));
+    neis = VECTOR(al->neis);
+
+    al->length = no_of_nodes;
+    al->adjs = IGRAPH_CALLOC(no_of_nodes, igraph_vector_int_t);
+    IGRAPH_CHECK_OOM(al->adjs, "Cannot create adjacency list view.");
+    IGRAPH_FINALLY(igraph_free, al->adjs);
+
+    for (igraph_integer_t i = 0; i < no_of_nodes; i++) {
+        igraph_integer_t count;
+
+        IGRAPH_ALLOW_INTERRUPTION();
+
+        if (cached) {
+            count = igraph_vector_int_size(&cached->adjs[i]);
+            memcpy(neis + size, VECTOR(cached->adjs[i]), count * sizeof(igraph_integer_t));
+        } else {
+            count = igraph_i_raw_neighbors(graph, i, mode, /* edges= */ false, neis + size);
+        }
+        igraph_vector_int_view(&al->adjs[i], neis + size, count);
         IGRAPH_CHECK(igraph_i_simplify_sorted_int_adjacency_vector_in_place(
             &al->adjs[i], i, mode, loops, multiple
         ));
+        size += igraph_vector_int_size(&al->adjs[i]);
     }
 
-    igraph_vector_int_destroy(&degrees);
-    IGRAPH_FINALLY_CLEAN(2); /* + igraph_adjlist_destroy */
+    IGRAPH_CHECK(igraph_vector_int_resize(&al->neis, size));
+    IGRAPH_FINALLY_CLEAN(2); /* al->adjs, al->neis */
 
     return IGRAPH_SUCCESS;
 }
 
+/**
+ * \function igraph_flat_adjlist_destroy
+ * \brief Deallocates a flat adjacency list.
+ *
+ * \param al The flat adjacency list to destroy.
+ *
+ * Time complexity: O(1).
+ */
+void igraph_flat_adjlist_destroy(igraph_flat_adjlist_t *al) {
+    IGRAPH_FREE(al->adjs);
+    igraph_vector_int_destroy(&al->neis);
+}
+
+/**
+ * \function igraph_flat_adjlist_size
+ * \brief Returns the number of vertices in a flat adjacency list.
+ *
+ * \param al The flat adjacency list.
+ * \return The number of vertices in the adjacency list.
+ *
+ * Time complexity: O(1).
+ */
+igraph_integer_t igraph_flat_adjlist_size(const igraph_flat_adjlist_t *al) {
+    return al->length;
+}
+
 /**
  * \function igraph_adjlist_init_empty
  * \brief Initializes an empty adjacency list.
@@ -1183,3 +1396,326 @@ igraph_vector_int_t *igraph_i_lazy_inclist_get_real(igraph_lazy_inclist_t *il, i
 
     return il->incs[no];
 }
+
+/* Rows of the concurrent lists are built by whichever thread asks for them
+ * first and published with a compare-and-swap; a thread that loses the race
+ * frees its own copy. Building a row never calls the error handler. */
+
+#if defined(__GNUC__) || defined(__clang__)
+
+static igraph_vector_int_t *igraph_i_concurrent_load(igraph_vector_int_t **slot) {
+    return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+}
+
+static igraph_vector_int_t *igraph_i_concurrent_publish(igraph_vector_int_t **slot,
+                                                        igraph_vector_int_t *row) {
+    igraph_vector_int_t *expected = NULL;
+    if (!__atomic_compare_exchange_n(slot, &expected, row, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        IGRAPH_FREE(row);
+        return expected;
+    }
+    return row;
+}
+
+#else
+
+static igraph_vector_int_t *igraph_i_concurrent_load(igraph_vector_int_t **slot) {
+    igraph_vector_int_t *row;
+#ifdef _OPENMP
+    #pragma omp critical(igraph_concurrent_lists)
+#endif
+    row = *slot;
+    return row;
+}
+
+static igraph_vector_int_t *igraph_i_concurrent_publish(igraph_vector_int_t **slot,
+                                                        igraph_vector_int_t *row) {
+    igraph_vector_int_t *result;
+#ifdef _OPENMP
+    #pragma omp critical(igraph_concurrent_lists)
+#endif
+    {
+        if (*slot == NULL) {
+            *slot = row;
+        }
+        result = *slot;
+    }
+    if (result != row) {
+        IGRAPH_FREE(row);
+    }
+    return result;
+}
+
+#endif
+
+/* A row is a single block, the vector header followed by the raw neighbors
+ * or incident edges of the vertex. */
+static igraph_vector_int_t *igraph_i_concurrent_row(const igraph_t *graph, igraph_integer_t no,
+                                                    igraph_neimode_t mode, igraph_bool_t edges) {
+    igraph_integer_t size = 0;
+    igraph_vector_int_t *row;
+
+    if (mode & IGRAPH_OUT) {
+        size += VECTOR(graph->os)[no + 1] - VECTOR(graph->os)[no];
+    }
+    if (mode & IGRAPH_IN) {
+        size += VECTOR(graph->is)[no + 1] - VECTOR(graph->is)[no];
+    }
+
+    row = igraph_malloc(sizeof(igraph_vector_int_t) + size * sizeof(igraph_integer_t));
+    if (row == NULL) {
+        return NULL;
+    }
+    igraph_vector_int_view(row, (igraph_integer_t *) (row + 1), size);
+    if (size > 0) {
+        igraph_i_raw_neighbors(graph, no, mode, edges, VECTOR(*row));
+    }
+
+    return row;
+}
+
+static void igraph_i_concurrent_rows_free(igraph_vector_int_t **rows, igraph_integer_t length) {
+    for (igraph_integer_t i = 0; i < length; i++) {
+        IGRAPH_FREE(rows[i]);
+    }
+    IGRAPH_FREE(rows);
+}
+
+/**
+ * \function igraph_concurrent_adjlist_init
+ * \brief Initializes a lazy adjacency list that can be shared by threads.
+ *
+ * Works like \ref igraph_lazy_adjlist_init(), but \ref
+ * igraph_concurrent_adjlist_get() may be called from several threads at
+ * the same time, e.g. from the threads of a parallel traversal. The
+ * neighbors of a vertex are queried on first use and kept; when two
+ * threads ask for the same vertex at the same time, both query it and one
+ * copy is discarded.
+ *
+ * </para><para>
+ * The graph must not be modified while the list is in use. Initialization
+ * and destruction must happen outside of the parallel section.
+ *
+ * \param graph The input graph.
+ * \param al Pointer to an uninitialized concurrent adjacency list.
+ * \param mode Constant specifying whether outgoing
+ *   (<code>IGRAPH_OUT</code>), incoming (<code>IGRAPH_IN</code>),
+ *   or both (<code>IGRAPH_ALL</code>) types of neighbors to include
+ *   in the adjacency list. It is ignored for undirected networks.
+ * \param loops How to treat loop edges, see \ref igraph_adjlist_init().
+ * \param multiple How to treat multiple edges, see \ref igraph_adjlist_init().
+ * \return Error code.
+ *
+ * Time complexity: O(|V|), the number of vertices, possibly, but
+ * depends on the underlying memory management too.
+ */
+
+igraph_error_t igraph_concurrent_adjlist_init(const igraph_t *graph,
+                                              igraph_concurrent_adjlist_t *al,
+                                              igraph_neimode_t mode,
+                                              igraph_loops_t loops,
+                                              igraph_multiple_t multiple) {
+    if (mode != IGRAPH_IN && mode != IGRAPH_OUT && mode != IGRAPH_ALL) {
+        IGRAPH_ERROR("Cannot create concurrent adjacency list view.", IGRAPH_EINVMODE);
+    }
+
+    if (!igraph_is_directed(graph)) {
+        mode = IGRAPH_ALL;
+    }
+
+    al->graph = graph;
+    al->mode = mode;
+    al->loops = loops;
+    al->multiple = multiple;
+
+    al->length = igraph_vcount(graph);
+    al->adjs = IGRAPH_CALLOC(al->length, igraph_vector_int_t*);
+    IGRAPH_CHECK_OOM(al->adjs, "Cannot create concurrent adjacency list view.");
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_concurrent_adjlist_destroy
+ * \brief Deallocates a concurrent adjacency list.
+ *
+ * \param al The adjacency list to deallocate.
+ *
+ * Time complexity: depends on the memory management.
+ */
+
+void igraph_concurrent_adjlist_destroy(igraph_concurrent_adjlist_t *al) {
+    igraph_i_concurrent_rows_free(al->adjs, al->length);
+}
+
+/**
+ * \function igraph_concurrent_adjlist_size
+ * \brief Returns the number of vertices in a concurrent adjacency list.
+ *
+ * \param al The concurrent adjacency list.
+ * \return The number of vertices.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_concurrent_adjlist_size(const igraph_concurrent_adjlist_t *al) {
+    return al->length;
+}
+
+/**
+ * \function igraph_concurrent_adjlist_get
+ * \brief Query neighbor vertices, safe to call from several threads.
+ *
+ * \param al The concurrent adjacency list.
+ * \param no The vertex ID to query.
+ * \return Pointer to a read-only vector, or \c NULL if memory ran out while
+ *   querying the vertex for the first time. The error handler is not
+ *   called in this case.
+ *
+ * Time complexity: O(d), the number of neighbor vertices for the
+ * first time, O(1) for subsequent calls.
+ */
+
+const igraph_vector_int_t *igraph_concurrent_adjlist_get(igraph_concurrent_adjlist_t *al,
+                                                         igraph_integer_t no) {
+    igraph_vector_int_t *row = igraph_i_concurrent_load(&al->adjs[no]);
+
+    if (row == NULL) {
+        row = igraph_i_concurrent_row(al->graph, no, al->mode, /* edges= */ false);
+        if (row == NULL) {
+            return NULL;
+        }
+        if (igraph_i_simplify_sorted_int_adjacency_vector_in_place(
+                row, no, al->mode, al->loops, al->multiple) != IGRAPH_SUCCESS) {
+            IGRAPH_FREE(row);
+            return NULL;
+        }
+        row = igraph_i_concurrent_publish(&al->adjs[no], row);
+    }
+
+    return row;
+}
+
+/**
+ * \function igraph_concurrent_inclist_init
+ * \brief Initializes a lazy incidence list that can be shared by threads.
+ *
+ * The incidence list counterpart of \ref igraph_concurrent_adjlist_init(),
+ * it works like \ref igraph_lazy_inclist_init(), but \ref
+ * igraph_concurrent_inclist_get() may be called from several threads at
+ * the same time.
+ *
+ * \param graph The input graph.
+ * \param il Pointer to an uninitialized concurrent incidence list.
+ * \param mode Constant specifying whether outgoing
+ *   (<code>IGRAPH_OUT</code>), incoming (<code>IGRAPH_IN</code>),
+ *   or both (<code>IGRAPH_ALL</code>) types of edges to include
+ *   in the incidence list. It is ignored for undirected networks.
+ * \param loops How to treat loop edges, see \ref igraph_lazy_inclist_init().
+ * \return Error code.
+ *
+ * Time complexity: O(|V|), the number of vertices, possibly, but
+ * depends on the underlying memory management too.
+ */
+
+igraph_error_t igraph_concurrent_inclist_init(const igraph_t *graph,
+                                              igraph_concurrent_inclist_t *il,
+                                              igraph_neimode_t mode,
+                                              igraph_loops_t loops) {
+    if (mode != IGRAPH_IN && mode != IGRAPH_OUT && mode != IGRAPH_ALL) {
+        IGRAPH_ERROR("Cannot create concurrent incidence list view.", IGRAPH_EINVMODE);
+    }
+    if (loops != IGRAPH_NO_LOOPS && loops != IGRAPH_LOOPS_ONCE && loops != IGRAPH_LOOPS_TWICE) {
+        IGRAPH_ERROR("Invalid value for 'loops' argument.", IGRAPH_EINVAL);
+    }
+
+    if (!igraph_is_directed(graph)) {
+        mode = IGRAPH_ALL;
+    }
+
+    il->graph = graph;
+    il->mode = mode;
+    il->loops = loops;
+
+    il->length = igraph_vcount(graph);
+    il->incs = IGRAPH_CALLOC(il->length, igraph_vector_int_t*);
+    IGRAPH_CHECK_OOM(il->incs, "Cannot create concurrent incidence list view.");
+
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_concurrent_inclist_destroy
+ * \brief Deallocates a concurrent incidence list.
+ *
+ * \param il The incidence list to deallocate.
+ *
+ * Time complexity: depends on the memory management.
+ */
+
+void igraph_concurrent_inclist_destroy(igraph_concurrent_inclist_t *il) {
+    igraph_i_concurrent_rows_free(il->incs, il->length);
+}
+
+/**
+ * \function igraph_concurrent_inclist_size
+ * \brief Returns the number of vertices in a concurrent incidence list.
+ *
+ * \param il The concurrent incidence list.
+ * \return The number of vertices.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_concurrent_inclist_size(const igraph_concurrent_inclist_t *il) {
+    return il->length;
+}
+
+/**
+ * \function igraph_concurrent_inclist_get
+ * \brief Query incident edges, safe to call from several threads.
+ *
+ * \param il The concurrent incidence list.
+ * \param no The vertex ID to query.
+ * \return Pointer to a read-only vector, or \c NULL if memory ran out while
+ *   querying the vertex for the first time. The error handler is not
+ *   called in this case.
+ *
+ * Time complexity: O(d), the number of incident edges for the first
+ * time, O(1) for subsequent calls.
+ */
+
+const igraph_vector_int_t *igraph_concurrent_inclist_get(igraph_concurrent_inclist_t *il,
+                                                         igraph_integer_t no) {
+    igraph_vector_int_t *row = igraph_i_concurrent_load(&il->incs[no]);
+
+    if (row == NULL) {
+        row = igraph_i_concurrent_row(il->graph, no, il->mode, /* edges= */ true);
+        if (row == NULL) {
+            return NULL;
+        }
+        if (il->loops != IGRAPH_LOOPS_TWICE) {
+            /* Loop edges may appear twice in the raw list; keep the first
+             * occurrence or none */
+            igraph_integer_t n = igraph_vector_int_size(row), p = 0;
+            for (igraph_integer_t i = 0; i < n; i++) {
+                igraph_integer_t eid = VECTOR(*row)[i];
+                igraph_bool_t keep = true;
+                if (IGRAPH_FROM(il->graph, eid) == IGRAPH_TO(il->graph, eid)) {
+                    keep = il->loops == IGRAPH_LOOPS_ONCE;
+                    for (igraph_integer_t j = 0; keep && j < p; j++) {
+                        keep = VECTOR(*row)[j] != eid;
+                    }
+                }
+                if (keep) {
+                    VECTOR(*row)[p++] = eid;
+                }
+            }
+            row->end = row->stor_begin + p;
+        }
+        row = igraph_i_concurrent_publish(&il->incs[no], row);
+    }
+
+    return row;
+}
@@ -17,13 +17,88 @@
 */
 
 #include "igraph_interface.h"
+#include "igraph_memory.h"
 
 #include "graph/caching.h"
 
 #include <assert.h>
 
+/* Memory budget for the derived structures of a single graph, in bytes.
+ * Zero disables caching them. */
+static IGRAPH_THREAD_LOCAL size_t igraph_i_property_cache_budget = 0;
+
 /****** Strictly internal functions ******/
 
+static size_t igraph_i_vector_int_bytes(const igraph_vector_int_t *v) {
+    return sizeof(igraph_vector_int_t) + igraph_vector_int_size(v) * sizeof(igraph_integer_t);
+}
+
+static size_t igraph_i_adjlist_bytes(const igraph_adjlist_t *al) {
+    size_t bytes = sizeof(igraph_adjlist_t);
+    for (igraph_integer_t i = 0; i < al->length; i++) {
+        bytes += igraph_i_vector_int_bytes(&al->adjs[i]);
+    }
+    return bytes;
+}
+
+static void igraph_i_property_cache_drop_vector(
+        igraph_i_property_cache_t *cache, igraph_vector_int_t **v) {
+    if (*v) {
+        cache->bytes -= igraph_i_vector_int_bytes(*v);
+        igraph_vector_int_destroy(*v);
+        IGRAPH_FREE(*v);
+    }
+}
+
+static void igraph_i_property_cache_drop_adjlist(
+        igraph_i_property_cache_t *cache, igraph_adjlist_t **al) {
+    if (*al) {
+        cache->bytes -= igraph_i_adjlist_bytes(*al);
+        igraph_adjlist_destroy(*al);
+        IGRAPH_FREE(*al);
+    }
+}
+
+/**
+ * \brief Frees all derived structures held by a property cache.
+ */
+static void igraph_i_property_cache_drop_derived(igraph_i_property_cache_t *cache) {
+    for (int i = 0; i < 3; i++) {
+        igraph_i_property_cache_drop_adjlist(cache, &cache->adjlist[i]);
+        igraph_i_property_cache_drop_vector(cache, &cache->degree[i]);
+    }
+    igraph_i_property_cache_drop_vector(cache, &cache->membership);
+    cache->bytes = 0;
+}
+
+/**
+ * \brief Stores a copy of a vector in a cache slot, if it fits in the budget.
+ *
+ * Failing to allocate the copy is not an error, the vector is simply not
+ * cached.
+ */
+static void igraph_i_property_cache_set_vector(
+        const igraph_t *graph, igraph_vector_int_t **slot, const igraph_vector_int_t *v) {
+    igraph_vector_int_t *copy;
+
+    igraph_i_property_cache_drop_vector(graph->cache, slot);
+    if (!igraph_i_property_cache_reserve(graph, igraph_i_vector_int_bytes(v))) {
+        return;
+    }
+
+    copy = IGRAPH_CALLOC(1, igraph_vector_int_t);
+    if (copy == NULL) {
+        return;
+    }
+    if (igraph_vector_int_init_copy(copy, v) != IGRAPH_SUCCESS) {
+        IGRAPH_FREE(copy);
+        return;
+    }
+
+    *slot = copy;
+    graph->cache->bytes += igraph_i_vector_int_bytes(copy);
+}
+
 /**
  * \brief Initializes a property cache, ensuring that all values are unknown.
  */
@@ -32,16 +107,28 @@ igraph_error_t igraph_i_property_cache_init(igraph_i_property_cache_t *cache) {
 
     memset(cache->value, 0, sizeof(cache->value) / sizeof(cache->value[0]));
     cache->known = 0;
+    memset(cache->degree, 0, sizeof(cache->degree));
+    memset(cache->adjlist, 0, sizeof(cache->adjlist));
+    cache->membership = NULL;
+    cache->no_of_components = 0;
+    cache->bytes = 0;
     return IGRAPH_SUCCESS;
 }
 
 /**
  * \brief Copies a property cache.
+ *
+ * Only the boolean properties are copied, if \p other_cache is not \c NULL. Derived structures are recomputed
+ * on demand for the copy, which is usually modified right after copying.
  */
 igraph_error_t igraph_i_property_cache_copy(
         igraph_i_property_cache_t *cache,
         const igraph_i_property_cache_t *other_cache) {
-    *cache = *other_cache;
+    IGRAPH_CHECK(igraph_i_property_cache_init(cache));
+    if (other_cache) {
+        memcpy(cache->value, other_cache->value, sizeof(cache->value));
+        cache->known = other_cache->known;
+    }
     return IGRAPH_SUCCESS;
 }
 
@@ -49,12 +136,15 @@ igraph_error_t igraph_i_property_cache_copy(
  * \brief Destroys a property cache.
  */
 void igraph_i_property_cache_destroy(igraph_i_property_cache_t *cache) {
-    IGRAPH_UNUSED(cache);
-    /* Nothing to do */
+    igraph_i_property_cache_drop_derived(cache);
 }
 
 /***** Developer fuctions, exposed *****/
 
+/* Graphs that were not created by igraph, such as the ones the R interface
+ * builds around R vectors, may have no cache. For them nothing is cached,
+ * values are not stored and invalidation does nothing. */
+
 /**
  * \brief Returns the value of a cached boolean property.
  *
@@ -65,12 +155,11 @@ void igraph_i_property_cache_destroy(igraph_i_property_cache_t *cache) {
  * \param graph  the graph whose cache is to be checked
  * \param prop   the property to retrieve from the cache
  * \return the cached value of the property if the value is in the cache, or
- *         an undefined value otherwise
+ *         an undefined value otherwise; false if the graph has no cache
  */
 igraph_bool_t igraph_i_property_cache_get_bool(const igraph_t *graph, igraph_cached_property_t prop) {
     IGRAPH_ASSERT(prop >= 0 && prop < IGRAPH_PROP_I_SIZE);
-    assert(graph->cache != NULL);
-    return graph->cache->value[prop];
+    return graph->cache ? graph->cache->value[prop] : false;
 }
 
 /**
@@ -81,8 +170,7 @@ igraph_bool_t igraph_i_property_cache_get_bool(const igraph_t *graph, igraph_cac
  */
 igraph_bool_t igraph_i_property_cache_has(const igraph_t *graph, igraph_cached_property_t prop) {
     IGRAPH_ASSERT(prop >= 0 && prop < IGRAPH_PROP_I_SIZE);
-    assert(graph->cache != NULL);
-    return graph->cache->known & (1 << prop);
+    return graph->cache && (graph->cache->known & (1 << prop));
 }
 
 /**
@@ -94,7 +182,9 @@ igraph_bool_t igraph_i_property_cache_has(const igraph_t *graph, igraph_cached_p
  */
 void igraph_i_property_cache_set_bool(const igraph_t *graph, igraph_cached_property_t prop, igraph_bool_t value) {
     IGRAPH_ASSERT(prop >= 0 && prop < IGRAPH_PROP_I_SIZE);
-    assert(graph->cache != NULL);
+    if (graph->cache == NULL) {
+        return;
+    }
     /* Even though graph is const, updating the cache is not considered modification.
      * Functions that merely compute graph properties, and thus leave the graph structure
      * intact, will often update the cache. */
@@ -110,8 +200,9 @@ void igraph_i_property_cache_set_bool(const igraph_t *graph, igraph_cached_prope
  */
 void igraph_i_property_cache_invalidate(const igraph_t *graph, igraph_cached_property_t prop) {
     IGRAPH_ASSERT(prop >= 0 && prop < IGRAPH_PROP_I_SIZE);
-    assert(graph->cache != NULL);
-    graph->cache->known &= ~(1 << prop);
+    if (graph->cache) {
+        graph->cache->known &= ~(1 << prop);
+    }
 }
 
 /**
@@ -122,8 +213,10 @@ void igraph_i_property_cache_invalidate(const igraph_t *graph, igraph_cached_pro
  * \param graph  the graph whose cache is to be invalidated
  */
 void igraph_i_property_cache_invalidate_all(const igraph_t *graph) {
-    assert(graph->cache != NULL);
-    graph->cache->known = 0;
+    if (graph->cache) {
+        graph->cache->known = 0;
+        igraph_i_property_cache_drop_derived(graph->cache);
+    }
 }
 
 /**
@@ -154,7 +247,9 @@ void igraph_i_property_cache_invalidate_conditionally(
     uint32_t maybe_keep;
     igraph_bool_t cached_value;
 
-    assert(graph->cache != NULL);
+    if (graph->cache == NULL) {
+        return;
+    }
 
     /* The bits of maybe_keep are set to 1 for those properties that are:
      *
@@ -182,4 +277,169 @@ void igraph_i_property_cache_invalidate_conditionally(
     }
 
     graph->cache->known &= ~invalidate;
+
+    /* Derived structures do not survive any modification */
+    igraph_i_property_cache_drop_derived(graph->cache);
+}
+
+/**
+ * \brief Makes room for a derived structure in the cache.
+ *
+ * Evicts the cached derived structures if the new one would not fit next to
+ * them in the memory budget.
+ *
+ * \param graph  the graph whose cache is to be modified
+ * \param bytes  the size of the structure to be cached
+ * \return whether the structure fits in the memory budget; always false
+ *         for graphs without a cache
+ */
+igraph_bool_t igraph_i_property_cache_reserve(const igraph_t *graph, size_t bytes) {
+    if (graph->cache == NULL || bytes > igraph_i_property_cache_budget) {
+        return false;
+    }
+    if (graph->cache->bytes + bytes > igraph_i_property_cache_budget) {
+        igraph_i_property_cache_drop_derived(graph->cache);
+    }
+    return true;
+}
+
+/**
+ * \brief Returns the cached degrees of all vertices, without loops.
+ *
+ * \param graph  the graph whose cache is to be checked
+ * \param mode   \c IGRAPH_OUT, \c IGRAPH_IN or \c IGRAPH_ALL
+ * \return the cached degrees, or \c NULL if they are not cached
+ */
+const igraph_vector_int_t *igraph_i_property_cache_get_degree(
+        const igraph_t *graph, igraph_neimode_t mode) {
+    IGRAPH_ASSERT(mode >= IGRAPH_OUT && mode <= IGRAPH_ALL);
+    return graph->cache ? graph->cache->degree[mode - 1] : NULL;
+}
+
+/**
+ * \brief Stores a copy of the degrees of all vertices, without loops.
+ */
+void igraph_i_property_cache_set_degree(
+        const igraph_t *graph, igraph_neimode_t mode, const igraph_vector_int_t *degree) {
+    IGRAPH_ASSERT(mode >= IGRAPH_OUT && mode <= IGRAPH_ALL);
+    if (graph->cache) {
+        igraph_i_property_cache_set_vector(graph, &graph->cache->degree[mode - 1], degree);
+    }
+}
+
+/**
+ * \brief Returns the cached weakly connected component membership.
+ *
+ * \param graph  the graph whose cache is to be checked
+ * \param no     if the membership is cached, the number of components is
+ *                stored here
+ * \return the cached membership, or \c NULL if it is not cached
+ */
+const igraph_vector_int_t *igraph_i_property_cache_get_membership(
+        const igraph_t *graph, igraph_integer_t *no) {
+    if (graph->cache == NULL || graph->cache->membership == NULL) {
+        return NULL;
+    }
+    *no = graph->cache->no_of_components;
+    return graph->cache->membership;
+}
+
+/**
+ * \brief Stores a copy of the weakly connected component membership.
+ */
+void igraph_i_property_cache_set_membership(
+        const igraph_t *graph, const igraph_vector_int_t *membership, igraph_integer_t no) {
+    if (graph->cache) {
+        igraph_i_property_cache_set_vector(graph, &graph->cache->membership, membership);
+        graph->cache->no_of_components = no;
+    }
+}
+
+/**
+ * \brief Returns the cached adjacency list of the graph.
+ *
+ * The neighbor lists are as returned by \ref igraph_neighbors(): sorted,
+ * with all loop and multi-edges.
+ *
+ * \param graph  the graph whose cache is to be checked
+ * \param mode   \c IGRAPH_OUT, \c IGRAPH_IN or \c IGRAPH_ALL
+ * \return the cached adjacency list, or \c NULL if it is not cached
+ */
+const igraph_adjlist_t *igraph_i_property_cache_get_adjlist(
+        const igraph_t *graph, igraph_neimode_t mode) {
+    IGRAPH_ASSERT(mode >= IGRAPH_OUT && mode <= IGRAPH_ALL);
+    return graph->cache ? graph->cache->adjlist[mode - 1] : NULL;
+}
+
+/**
+ * \brief Stores an adjacency list in the cache.
+ *
+ * The cache takes ownership of \p adjlist, which must be allocated with
+ * \ref IGRAPH_CALLOC(). Room for it must have been made with
+ * \ref igraph_i_property_cache_reserve() first.
+ */
+void igraph_i_property_cache_set_adjlist(
+        const igraph_t *graph, igraph_neimode_t mode, igraph_adjlist_t *adjlist) {
+    IGRAPH_ASSERT(mode >= IGRAPH_OUT && mode <= IGRAPH_ALL);
+    assert(graph->cache != NULL);
+    igraph_i_property_cache_drop_adjlist(graph->cache, &graph->cache->adjlist[mode - 1]);
+    graph->cache->adjlist[mode - 1] = adjlist;
+    graph->cache->bytes += igraph_i_adjlist_bytes(adjlist);
+}
+
+/***** Public functions *****/
+
+/**
+ * \function igraph_set_property_cache_budget
+ * \brief Sets the memory budget of the cached derived structures.
+ *
+ * Besides boolean properties, graphs can cache structures derived from them,
+ * such as the degrees of all vertices, the weakly connected components and
+ * adjacency lists. These are kept until the graph is modified, and each
+ * graph may use at most the given number of bytes for them. The default
+ * budget is zero, which disables caching derived structures.
+ *
+ * </para><para>
+ * A lower budget takes effect for each graph the next time a structure is
+ * added to its cache.
+ *
+ * </para><para>
+ * The structures are added on first use by functions that take the graph as
+ * \c const, without any locking. With a non-zero budget, a graph must not
+ * be queried from several threads at the same time.
+ *
+ * \param bytes The new budget in bytes.
+ * \return The previous budget.
+ *
+ * Time complexity: O(1).
+ */
+size_t igraph_set_property_cache_budget(size_t bytes) {
+    size_t previous = igraph_i_property_cache_budget;
+    igraph_i_property_cache_budget = bytes;
+    return previous;
+}
+
+/**
+ * \function igraph_property_cache_budget
+ * \brief The memory budget of the cached derived structures.
+ *
+ * \return The budget in bytes, see \ref igraph_set_property_cache_budget().
+ *
+ * Time complexity: O(1).
+ */
+size_t igraph_property_cache_budget(void) {
+    return igraph_i_property_cache_budget;
+}
+
+/**
+ * \function igraph_property_cache_size
+ * \brief The memory used by the cached derived structures of a graph.
+ *
+ * \param graph The graph.
+ * \return The size in bytes.
+ *
+ * Time complexity: O(1).
+ */
+size_t igraph_property_cache_size(const igraph_t *graph) {
+    return graph->cache ? graph->cache->bytes : 0;
 }
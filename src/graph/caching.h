@@ -19,6 +19,7 @@
 #ifndef IGRAPH_CACHING_H
 #define IGRAPH_CACHING_H
 
+#include "igraph_adjlist.h"
 #include "igraph_datatype.h"
 #include "igraph_decls.h"
 #include "igraph_error.h"
@@ -35,6 +36,21 @@ struct igraph_i_property_cache_t {
 
     /** Bit field that stores which of the properties are cached at the moment */
     uint32_t known;
+
+    /** Derived structures, NULL when not cached. They are filled through
+     * const graph pointers without locking, so they are only safe to use
+     * from one thread at a time. Degrees without loops and
+     * raw adjacency lists (as returned by igraph_neighbors()) are indexed by
+     * mode - 1, i.e. IGRAPH_OUT, IGRAPH_IN and IGRAPH_ALL. */
+    igraph_vector_int_t *degree[3];
+    igraph_adjlist_t *adjlist[3];
+
+    /** Weakly connected component membership and component count */
+    igraph_vector_int_t *membership;
+    igraph_integer_t no_of_components;
+
+    /** Memory taken by the derived structures, in bytes */
+    size_t bytes;
 };
 
 igraph_error_t igraph_i_property_cache_init(igraph_i_property_cache_t *cache);
@@ -47,6 +63,23 @@ void igraph_i_property_cache_invalidate_conditionally(
     const igraph_t *graph, uint32_t keep_always, uint32_t keep_when_false, uint32_t keep_when_true
 );
 
+const igraph_vector_int_t *igraph_i_property_cache_get_degree(
+    const igraph_t *graph, igraph_neimode_t mode);
+void igraph_i_property_cache_set_degree(
+    const igraph_t *graph, igraph_neimode_t mode, const igraph_vector_int_t *degree);
+
+const igraph_vector_int_t *igraph_i_property_cache_get_membership(
+    const igraph_t *graph, igraph_integer_t *no);
+void igraph_i_property_cache_set_membership(
+    const igraph_t *graph, const igraph_vector_int_t *membership, igraph_integer_t no);
+
+const igraph_adjlist_t *igraph_i_property_cache_get_adjlist(
+    const igraph_t *graph, igraph_neimode_t mode);
+void igraph_i_property_cache_set_adjlist(
+    const igraph_t *graph, igraph_neimode_t mode, igraph_adjlist_t *adjlist);
+
+igraph_bool_t igraph_i_property_cache_reserve(const igraph_t *graph, size_t bytes);
+
 __END_DECLS
 
 #endif /* IGRAPH_CACHING_H */
@@ -0,0 +1,486 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#include "igraph_csr.h"
+#include "igraph_interface.h"
+
+#include "core/indheap.h"
+#include "core/interruption.h"
+
+#include <math.h>
+
+/**
+ * \function igraph_csr_init
+ * \brief Creates a compressed sparse row snapshot of a graph.
+ *
+ * The snapshot holds the neighbor lists of all vertices in contiguous
+ * arrays, which take about half the memory of the indexed edge list of
+ * \p graph and are faster to scan. It is independent of the graph after
+ * creation and cannot be modified.
+ *
+ * </para><para>
+ * Neighbors are sorted by vertex ID. For undirected graphs loop edges
+ * appear twice in the neighbor list of their vertex.
+ *
+ * \param graph The input graph.
+ * \param csr Pointer to an uninitialized <type>igraph_csr_t</type> object.
+ * \param weights Edge weights to store with the snapshot, or a null pointer.
+ *   Weights must not be negative or NaN.
+ * \return Error code.
+ *
+ * Time complexity: O(|V|+|E|), linear in the number of vertices and
+ * edges.
+ */
+
+igraph_error_t igraph_csr_init(const igraph_t *graph, igraph_csr_t *csr,
+                               const igraph_vector_t *weights) {
+    igraph_integer_t no_of_nodes = igraph_vcount(graph);
+    igraph_integer_t no_of_edges = igraph_ecount(graph);
+    igraph_bool_t directed = igraph_is_directed(graph);
+    igraph_integer_t i, k;
+
+    if (weights) {
+        if (igraph_vector_size(weights) != no_of_edges) {
+            IGRAPH_ERROR("Weight vector length does not match the number of edges.", IGRAPH_EINVAL);
+        }
+        if (no_of_edges > 0) {
+            igraph_real_t min = igraph_vector_min(weights);
+            if (min < 0 || isnan(min)) {
+                IGRAPH_ERROR("Weights must not be negative or NaN.", IGRAPH_EINVAL);
+            }
+        }
+    }
+
+    csr->n = no_of_nodes;
+    csr->ecount = no_of_edges;
+    csr->directed = directed;
+    csr->weighted = weights != NULL;
+    csr->integer_weights = true;
+    for (k = 0; weights && csr->integer_weights && k < no_of_edges; k++) {
+        csr->integer_weights = VECTOR(*weights)[k] == floor(VECTOR(*weights)[k]);
+    }
+
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&csr->out_start, no_of_nodes + 1);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&csr->out_nei, directed ? no_of_edges : 2 * no_of_edges);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&csr->in_start, directed ? no_of_nodes + 1 : 0);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&csr->in_nei, directed ? no_of_edges : 0);
+    IGRAPH_VECTOR_INIT_FINALLY(&csr->out_weight,
+                               !weights ? 0 : directed ? no_of_edges : 2 * no_of_edges);
+    IGRAPH_VECTOR_INIT_FINALLY(&csr->in_weight, weights && directed ? no_of_edges : 0);
+
+    if (directed) {
+        /* os/is already are the start vectors of oi/ii */
+        for (i = 0; i <= no_of_nodes; i++) {
+            VECTOR(csr->out_start)[i] = VECTOR(graph->os)[i];
+            VECTOR(csr->in_start)[i] = VECTOR(graph->is)[i];
+        }
+        for (k = 0; k < no_of_edges; k++) {
+            igraph_integer_t oe = VECTOR(graph->oi)[k], ie = VECTOR(graph->ii)[k];
+            VECTOR(csr->out_nei)[k] = VECTOR(graph->to)[oe];
+            VECTOR(csr->in_nei)[k] = VECTOR(graph->from)[ie];
+            if (weights) {
+                VECTOR(csr->out_weight)[k] = VECTOR(*weights)[oe];
+                VECTOR(csr->in_weight)[k] = VECTOR(*weights)[ie];
+            }
+        }
+    } else {
+        /* Merge the two sorted halves of each undirected neighbor list */
+        for (i = 0, k = 0; i < no_of_nodes; i++) {
+            igraph_integer_t o = VECTOR(graph->os)[i], oend = VECTOR(graph->os)[i + 1];
+            igraph_integer_t p = VECTOR(graph->is)[i], pend = VECTOR(graph->is)[i + 1];
+            VECTOR(csr->out_start)[i] = k;
+            while (o < oend || p < pend) {
+                igraph_integer_t e;
+                if (p == pend || (o < oend &&
+                                  VECTOR(graph->to)[VECTOR(graph->oi)[o]] <=
+                                  VECTOR(graph->from)[VECTOR(graph->ii)[p]])) {
+                    e = VECTOR(graph->oi)[o++];
+                    VECTOR(csr->out_nei)[k] = VECTOR(graph->to)[e];
+                } else {
+                    e = VECTOR(graph->ii)[p++];
+                    VECTOR(csr->out_nei)[k] = VECTOR(graph->from)[e];
+                }
+                if (weights) {
+                    VECTOR(csr->out_weight)[k] = VECTOR(*weights)[e];
+                }
+                k++;
+            }
+        }
+        VECTOR(csr->out_start)[no_of_nodes] = k;
+    }
+
+    IGRAPH_FINALLY_CLEAN(6);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_csr_destroy
+ * \brief Frees the memory of a compressed sparse row snapshot.
+ *
+ * \param csr The snapshot to destroy.
+ *
+ * Time complexity: operating system dependent.
+ */
+
+void igraph_csr_destroy(igraph_csr_t *csr) {
+    igraph_vector_int_destroy(&csr->out_start);
+    igraph_vector_int_destroy(&csr->out_nei);
+    igraph_vector_int_destroy(&csr->in_start);
+    igraph_vector_int_destroy(&csr->in_nei);
+    igraph_vector_destroy(&csr->out_weight);
+    igraph_vector_destroy(&csr->in_weight);
+}
+
+igraph_integer_t igraph_csr_vcount(const igraph_csr_t *csr) {
+    return csr->n;
+}
+
+igraph_integer_t igraph_csr_ecount(const igraph_csr_t *csr) {
+    return csr->ecount;
+}
+
+/**
+ * \function igraph_csr_size
+ * \brief Memory used by the arrays of a snapshot, in bytes.
+ *
+ * \param csr The snapshot.
+ * \return The number of bytes.
+ *
+ * Time complexity: O(1).
+ */
+
+igraph_integer_t igraph_csr_size(const igraph_csr_t *csr) {
+    return sizeof(igraph_integer_t) * (
+               igraph_vector_int_size(&csr->out_start) + igraph_vector_int_size(&csr->out_nei) +
+               igraph_vector_int_size(&csr->in_start) + igraph_vector_int_size(&csr->in_nei)) +
+           sizeof(igraph_real_t) * (
+               igraph_vector_size(&csr->out_weight) + igraph_vector_size(&csr->in_weight));
+}
+
+/* Neighbor ranges to scan for a mode: the out- and, for directed graphs in
+ * IGRAPH_ALL mode, also the in-neighbor arrays. */
+static igraph_error_t igraph_i_csr_sides(const igraph_csr_t *csr, igraph_neimode_t mode,
+                                         igraph_bool_t *out, igraph_bool_t *in) {
+    if (mode != IGRAPH_OUT && mode != IGRAPH_IN && mode != IGRAPH_ALL) {
+        IGRAPH_ERROR("Invalid mode argument.", IGRAPH_EINVMODE);
+    }
+    *out = !csr->directed || mode != IGRAPH_IN;
+    *in = csr->directed && mode != IGRAPH_OUT;
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_csr_bfs
+ * \brief Unweighted distances from one vertex, by breadth-first search.
+ *
+ * \param csr The snapshot.
+ * \param root The source vertex.
+ * \param mode Which edges to follow, <code>IGRAPH_OUT</code>,
+ *   <code>IGRAPH_IN</code> or <code>IGRAPH_ALL</code>. Ignored for
+ *   undirected graphs.
+ * \param dist Initialized vector, resized to the number of vertices. It
+ *   receives the number of steps from \p root, or -1 for unreachable
+ *   vertices.
+ * \return Error code.
+ *
+ * Time complexity: O(|V|+|E|).
+ */
+
+igraph_error_t igraph_csr_bfs(const igraph_csr_t *csr, igraph_integer_t root,
+                              igraph_neimode_t mode, igraph_vector_int_t *dist) {
+    igraph_integer_t no_of_nodes = csr->n;
+    igraph_vector_int_t queue;
+    igraph_integer_t head = 0, tail = 0, k;
+    igraph_bool_t out, in;
+
+    if (root < 0 || root >= no_of_nodes) {
+        IGRAPH_ERROR("Invalid root vertex.", IGRAPH_EINVVID);
+    }
+    IGRAPH_CHECK(igraph_i_csr_sides(csr, mode, &out, &in));
+
+    IGRAPH_CHECK(igraph_vector_int_resize(dist, no_of_nodes));
+    igraph_vector_int_fill(dist, -1);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&queue, no_of_nodes);
+
+    /* Every vertex enters the queue at most once */
+    VECTOR(*dist)[root] = 0;
+    VECTOR(queue)[tail++] = root;
+    while (head < tail) {
+        igraph_integer_t v = VECTOR(queue)[head++];
+        igraph_integer_t d = VECTOR(*dist)[v] + 1;
+        if (out) {
+            for (k = VECTOR(csr->out_start)[v]; k < VECTOR(csr->out_start)[v + 1]; k++) {
+                igraph_integer_t u = VECTOR(csr->out_nei)[k];
+                if (VECTOR(*dist)[u] < 0) {
+                    VECTOR(*dist)[u] = d;
+                    VECTOR(queue)[tail++] = u;
+                }
+            }
+        }
+        if (in) {
+            for (k = VECTOR(csr->in_start)[v]; k < VECTOR(csr->in_start)[v + 1]; k++) {
+                igraph_integer_t u = VECTOR(csr->in_nei)[k];
+                if (VECTOR(*dist)[u] < 0) {
+                    VECTOR(*dist)[u] = d;
+                    VECTOR(queue)[tail++] = u;
+                }
+            }
+        }
+        if ((head & 0xFFFF) == 0) {
+            IGRAPH_ALLOW_INTERRUPTION();
+        }
+    }
+
+    igraph_vector_int_destroy(&queue);
+    IGRAPH_FINALLY_CLEAN(1);
+    return IGRAPH_SUCCESS;
+}
+
+static igraph_error_t igraph_i_csr_relax(igraph_i_dijkstra_queue_t *Q, igraph_real_t mindist,
+                               const igraph_vector_int_t *start, const igraph_vector_int_t *nei,
+                               const igraph_vector_t *weight, igraph_integer_t v) {
+    igraph_integer_t k;
+    for (k = VECTOR(*start)[v]; k < VECTOR(*start)[v + 1]; k++) {
+        igraph_integer_t u = VECTOR(*nei)[k];
+        igraph_real_t altdist = mindist + (weight ? VECTOR(*weight)[k] : 1.0);
+        if (!igraph_i_dijkstra_queue_has_elem(Q, u)) {
+            IGRAPH_CHECK(igraph_i_dijkstra_queue_push(Q, u, altdist));
+        } else if (igraph_i_dijkstra_queue_has_active(Q, u) && altdist < igraph_i_dijkstra_queue_get(Q, u)) {
+            IGRAPH_CHECK(igraph_i_dijkstra_queue_decrease(Q, u, altdist));
+        }
+    }
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_csr_dijkstra
+ * \brief Weighted distances from one vertex, using Dijkstra's algorithm.
+ *
+ * Uses the weights stored in the snapshot, or unit weights if there are
+ * none.
+ *
+ * \param csr The snapshot.
+ * \param root The source vertex.
+ * \param mode Which edges to follow, see \ref igraph_csr_bfs().
+ * \param dist Initialized vector, resized to the number of vertices. It
+ *   receives the distances from \p root, infinity for unreachable vertices.
+ * \return Error code.
+ *
+ * Time complexity: O(|E| log |V|).
+ */
+
+igraph_error_t igraph_csr_dijkstra(const igraph_csr_t *csr, igraph_integer_t root,
+                                   igraph_neimode_t mode, igraph_vector_t *dist) {
+    igraph_integer_t no_of_nodes = csr->n;
+    const igraph_vector_t *out_weight = csr->weighted ? &csr->out_weight : NULL;
+    const igraph_vector_t *in_weight = csr->weighted ? &csr->in_weight : NULL;
+    igraph_i_dijkstra_queue_t Q;
+    igraph_bool_t out, in;
+    igraph_integer_t steps = 0;
+
+    if (root < 0 || root >= no_of_nodes) {
+        IGRAPH_ERROR("Invalid root vertex.", IGRAPH_EINVVID);
+    }
+    IGRAPH_CHECK(igraph_i_csr_sides(csr, mode, &out, &in));
+
+    IGRAPH_CHECK(igraph_vector_resize(dist, no_of_nodes));
+    igraph_vector_fill(dist, IGRAPH_INFINITY);
+    IGRAPH_CHECK(igraph_i_dijkstra_queue_init(
+                     &Q, no_of_nodes, igraph_i_dijkstra_heap_type(no_of_nodes, csr->integer_weights)));
+    IGRAPH_FINALLY(igraph_i_dijkstra_queue_destroy, &Q);
+
+    IGRAPH_CHECK(igraph_i_dijkstra_queue_push(&Q, root, 0.0));
+    while (!igraph_i_dijkstra_queue_empty(&Q)) {
+        igraph_integer_t v;
+        igraph_real_t mindist;
+        IGRAPH_CHECK(igraph_i_dijkstra_queue_deactivate_min(&Q, &v, &mindist));
+        VECTOR(*dist)[v] = mindist;
+        if (out) {
+            IGRAPH_CHECK(igraph_i_csr_relax(&Q, mindist, &csr->out_start, &csr->out_nei, out_weight, v));
+        }
+        if (in) {
+            IGRAPH_CHECK(igraph_i_csr_relax(&Q, mindist, &csr->in_start, &csr->in_nei, in_weight, v));
+        }
+        if ((++steps & 0xFFFF) == 0) {
+            IGRAPH_ALLOW_INTERRUPTION();
+        }
+    }
+
+    igraph_i_dijkstra_queue_destroy(&Q);
+    IGRAPH_FINALLY_CLEAN(1);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_csr_pagerank
+ * \brief PageRank scores by power iteration over the snapshot.
+ *
+ * Edges are followed in their direction in directed graphs. Edge weights
+ * are used if the snapshot has them. The score of vertices without
+ * outgoing edges is distributed uniformly. Iteration stops when the
+ * scores change by less than 1e-10 in total, or after 1000 rounds.
+ *
+ * \param csr The snapshot.
+ * \param damping The damping factor, between 0 and 1.
+ * \param res Initialized vector, resized to the number of vertices. It
+ *   receives the scores, which sum up to one.
+ * \return Error code.
+ *
+ * Time complexity: O(|E|) per round.
+ */
+
+igraph_error_t igraph_csr_pagerank(const igraph_csr_t *csr, igraph_real_t damping,
+                                   igraph_vector_t *res) {
+    igraph_integer_t no_of_nodes = csr->n;
+    /* Scores flow along out-edges, so they are pulled over in-edges */
+    const igraph_vector_int_t *pull_start = csr->directed ? &csr->in_start : &csr->out_start;
+    const igraph_vector_int_t *pull_nei = csr->directed ? &csr->in_nei : &csr->out_nei;
+    const igraph_vector_t *pull_weight = csr->directed ? &csr->in_weight : &csr->out_weight;
+    igraph_vector_t outstr, contrib;
+    igraph_integer_t i, k, iter;
+
+    if (damping < 0 || damping > 1) {
+        IGRAPH_ERROR("The PageRank damping factor must be in the range [0,1].", IGRAPH_EINVAL);
+    }
+
+    IGRAPH_CHECK(igraph_vector_resize(res, no_of_nodes));
+    if (no_of_nodes == 0) {
+        return IGRAPH_SUCCESS;
+    }
+    IGRAPH_VECTOR_INIT_FINALLY(&outstr, no_of_nodes);
+    IGRAPH_VECTOR_INIT_FINALLY(&contrib, no_of_nodes);
+
+    for (i = 0; i < no_of_nodes; i++) {
+        igraph_integer_t from = VECTOR(csr->out_start)[i], to = VECTOR(csr->out_start)[i + 1];
+        if (csr->weighted) {
+            for (k = from; k < to; k++) {
+                VECTOR(outstr)[i] += VECTOR(csr->out_weight)[k];
+            }
+        } else {
+            VECTOR(outstr)[i] = to - from;
+        }
+    }
+
+    igraph_vector_fill(res, 1.0 / no_of_nodes);
+    for (iter = 0; iter < 1000; iter++) {
+        igraph_real_t dangling = 0, change = 0, sum = 0;
+
+        for (i = 0; i < no_of_nodes; i++) {
+            if (VECTOR(outstr)[i] > 0) {
+                VECTOR(contrib)[i] = VECTOR(*res)[i] / VECTOR(outstr)[i];
+            } else {
+                VECTOR(contrib)[i] = 0;
+                dangling += VECTOR(*res)[i];
+            }
+        }
+
+        for (i = 0; i < no_of_nodes; i++) {
+            igraph_real_t in = 0, value;
+            for (k = VECTOR(*pull_start)[i]; k < VECTOR(*pull_start)[i + 1]; k++) {
+                in += VECTOR(contrib)[VECTOR(*pull_nei)[k]] *
+                      (csr->weighted ? VECTOR(*pull_weight)[k] : 1.0);
+            }
+            value = (1 - damping) / no_of_nodes + damping * (in + dangling / no_of_nodes);
+            change += fabs(value - VECTOR(*res)[i]);
+            VECTOR(*res)[i] = value;
+            sum += value;
+        }
+
+        /* Keep rounding errors from accumulating */
+        igraph_vector_scale(res, 1.0 / sum);
+        if (change < 1e-10) {
+            break;
+        }
+        IGRAPH_ALLOW_INTERRUPTION();
+    }
+
+    igraph_vector_destroy(&contrib);
+    igraph_vector_destroy(&outstr);
+    IGRAPH_FINALLY_CLEAN(2);
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_csr_components
+ * \brief Weakly connected components of the snapshot.
+ *
+ * \param csr The snapshot.
+ * \param membership Initialized vector, resized to the number of vertices.
+ *   It receives the component ID of each vertex, numbered from zero in
+ *   the order of their smallest vertex.
+ * \param no Pointer to an integer, the number of components is stored
+ *   here. May be a null pointer.
+ * \return Error code.
+ *
+ * Time complexity: O(|V|+|E|).
+ */
+
+igraph_error_t igraph_csr_components(const igraph_csr_t *csr,
+                                     igraph_vector_int_t *membership,
+                                     igraph_integer_t *no) {
+    igraph_integer_t no_of_nodes = csr->n;
+    igraph_vector_int_t queue;
+    igraph_integer_t i, k, comp = 0;
+
+    IGRAPH_CHECK(igraph_vector_int_resize(membership, no_of_nodes));
+    igraph_vector_int_fill(membership, -1);
+    IGRAPH_VECTOR_INT_INIT_FINALLY(&queue, no_of_nodes);
+
+    for (i = 0; i < no_of_nodes; i++) {
+        igraph_integer_t head = 0, tail = 0;
+        if (VECTOR(*membership)[i] >= 0) {
+            continue;
+        }
+        VECTOR(*membership)[i] = comp;
+        VECTOR(queue)[tail++] = i;
+        while (head < tail) {
+            igraph_integer_t v = VECTOR(queue)[head++];
+            for (k = VECTOR(csr->out_start)[v]; k < VECTOR(csr->out_start)[v + 1]; k++) {
+                igraph_integer_t u = VECTOR(csr->out_nei)[k];
+                if (VECTOR(*membership)[u] < 0) {
+                    VECTOR(*membership)[u] = comp;
+                    VECTOR(queue)[tail++] = u;
+                }
+            }
+            if (csr->directed) {
+                for (k = VECTOR(csr->in_start)[v]; k < VECTOR(csr->in_start)[v + 1]; k++) {
+                    igraph_integer_t u = VECTOR(csr->in_nei)[k];
+                    if (VECTOR(*membership)[u] < 0) {
+                        VECTOR(*membership)[u] = comp;
+                        VECTOR(queue)[tail++] = u;
+                    }
+                }
+            }
+        }
+        comp++;
+        IGRAPH_ALLOW_INTERRUPTION();
+    }
+
+    if (no) {
+        *no = comp;
+    }
+
+    igraph_vector_int_destroy(&queue);
+    IGRAPH_FINALLY_CLEAN(1);
+    return IGRAPH_SUCCESS;
+}
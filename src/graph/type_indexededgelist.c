@@ -24,6 +24,7 @@
 #include "igraph_datatype.h"
 #include "igraph_interface.h"
 #include "igraph_memory.h"
+#include "igraph_qsort.h"
 
 #include "graph/attributes.h"
 #include "graph/caching.h"
@@ -35,6 +36,17 @@
 static igraph_error_t igraph_i_create_start_vectors(
         igraph_vector_int_t *res, igraph_vector_int_t *el,
         igraph_vector_int_t *index, igraph_integer_t nodes);
+static void igraph_i_sort_edge_batch(
+        const igraph_vector_int_t *el1, const igraph_vector_int_t *el2,
+        igraph_integer_t first, igraph_vector_int_t *batch);
+static void igraph_i_merge_edge_batch(
+        igraph_vector_int_t *index, igraph_vector_int_t *start,
+        const igraph_vector_int_t *el1, const igraph_vector_int_t *el2,
+        const igraph_vector_int_t *batch, igraph_integer_t nodes);
+
+/* igraph_add_edges() merges batches of at most this fraction of the
+ * current edge count into the existing index instead of rebuilding it. */
+#define IGRAPH_I_MERGE_EDGES_RATIO 8
 
 /**
  * \section about_basic_interface
@@ -300,7 +312,30 @@ igraph_error_t igraph_add_edges(igraph_t *graph, const igraph_vector_int_t *edge
 
     /* oi & ii */
     IGRAPH_FINALLY_ENTER();
-    {
+    if (no_of_edges > 0 && edges_to_add <= no_of_edges / IGRAPH_I_MERGE_EDGES_RATIO) {
+        /* Small batch: sort only the new edges and merge them into the
+         * existing index. Reserving first makes the merge error safe. */
+        CHECK_ERR(igraph_vector_int_reserve(&graph->oi, new_no_of_edges));
+        CHECK_ERR(igraph_vector_int_reserve(&graph->ii, new_no_of_edges));
+        CHECK_ERR(igraph_vector_int_init(&newoi, edges_to_add));
+        IGRAPH_FINALLY(igraph_vector_int_destroy, &newoi);
+        CHECK_ERR(igraph_vector_int_init(&newii, edges_to_add));
+        IGRAPH_FINALLY(igraph_vector_int_destroy, &newii);
+        igraph_i_sort_edge_batch(&graph->from, &graph->to, no_of_edges, &newoi);
+        igraph_i_sort_edge_batch(&graph->to, &graph->from, no_of_edges, &newii);
+
+        /* Attributes */
+        if (graph->attr) {
+            CHECK_ERR(igraph_i_attribute_add_edges(graph, edges, attr));
+        }
+
+        igraph_i_merge_edge_batch(&graph->oi, &graph->os, &graph->from, &graph->to, &newoi, graph->n);
+        igraph_i_merge_edge_batch(&graph->ii, &graph->is, &graph->to, &graph->from, &newii, graph->n);
+
+        igraph_vector_int_destroy(&newoi);
+        igraph_vector_int_destroy(&newii);
+        IGRAPH_FINALLY_CLEAN(2);
+    } else {
         CHECK_ERR(igraph_vector_int_init(&newoi, no_of_edges));
         IGRAPH_FINALLY(igraph_vector_int_destroy, &newoi);
         CHECK_ERR(igraph_vector_int_init(&newii, no_of_edges));
@@ -497,10 +532,10 @@ igraph_error_t igraph_delete_edges(igraph_t *graph, igraph_es_t edges) {
     igraph_vector_int_t newfrom, newto;
     igraph_vector_int_t newoi, newii;
 
-    igraph_bool_t *mark;
+    igraph_integer_t *mark;
     igraph_integer_t i, j;
 
-    mark = IGRAPH_CALLOC(no_of_edges, igraph_bool_t);
+    mark = IGRAPH_CALLOC(no_of_edges, igraph_integer_t);
     IGRAPH_CHECK_OOM(mark, "Cannot delete edges.");
     IGRAPH_FINALLY(igraph_free, mark);
 
@@ -511,7 +546,7 @@ igraph_error_t igraph_delete_edges(igraph_t *graph, igraph_es_t edges) {
         igraph_integer_t e = IGRAPH_EIT_GET(eit);
         if (mark[e] == 0) {
             edges_to_remove++;
-            mark[e]++;
+            mark[e] = -1;
         }
     }
     remaining_edges = no_of_edges - edges_to_remove;
@@ -523,20 +558,34 @@ igraph_error_t igraph_delete_edges(igraph_t *graph, igraph_es_t edges) {
     IGRAPH_VECTOR_INT_INIT_FINALLY(&newfrom, remaining_edges);
     IGRAPH_VECTOR_INT_INIT_FINALLY(&newto, remaining_edges);
 
-    /* Actually remove the edges, move from pos i to pos j in newfrom/newto */
-    for (i = 0, j = 0; j < remaining_edges; i++) {
+    /* Actually remove the edges, move from pos i to pos j in newfrom/newto.
+     * mark[i] becomes the new ID of kept edge i. */
+    for (i = 0, j = 0; i < no_of_edges; i++) {
         if (mark[i] == 0) {
             VECTOR(newfrom)[j] = VECTOR(graph->from)[i];
             VECTOR(newto)[j] = VECTOR(graph->to)[i];
-            j++;
+            mark[i] = j++;
+        } else {
+            mark[i] = -1;
         }
     }
 
-    /* Create index, this might require additional memory */
+    /* Create index. Renumbering keeps the order of the remaining edges, so
+     * filtering the old index is enough, there is no need to sort. */
     IGRAPH_VECTOR_INT_INIT_FINALLY(&newoi, remaining_edges);
     IGRAPH_VECTOR_INT_INIT_FINALLY(&newii, remaining_edges);
-    IGRAPH_CHECK(igraph_vector_int_pair_order(&newfrom, &newto, &newoi, no_of_nodes));
-    IGRAPH_CHECK(igraph_vector_int_pair_order(&newto, &newfrom, &newii, no_of_nodes));
+    for (i = 0, j = 0; i < no_of_edges; i++) {
+        igraph_integer_t e = mark[VECTOR(graph->oi)[i]];
+        if (e >= 0) {
+            VECTOR(newoi)[j++] = e;
+        }
+    }
+    for (i = 0, j = 0; i < no_of_edges; i++) {
+        igraph_integer_t e = mark[VECTOR(graph->ii)[i]];
+        if (e >= 0) {
+            VECTOR(newii)[j++] = e;
+        }
+    }
 
     /* Edge attributes, we need an index that gives the IDs of the
        original edges for every new edge.
@@ -545,7 +594,7 @@ igraph_error_t igraph_delete_edges(igraph_t *graph, igraph_es_t edges) {
         igraph_vector_int_t idx;
         IGRAPH_VECTOR_INT_INIT_FINALLY(&idx, remaining_edges);
         for (i = 0, j = 0; i < no_of_edges; i++) {
-            if (mark[i] == 0) {
+            if (mark[i] >= 0) {
                 VECTOR(idx)[j++] = i;
             }
         }
@@ -1187,7 +1236,10 @@ igraph_error_t igraph_degree_1(const igraph_t *graph, igraph_integer_t *deg,
  * Time complexity: O(v) if \p loops is \c true, and
  * O(v*d) otherwise. v is the number of
  * vertices for which the degree will be calculated, and
- * d is their (average) degree.
+ * d is their (average) degree. Degrees of all vertices without loops
+ * are cached with the graph if the budget set with
+ * \ref igraph_set_property_cache_budget() allows; later calls are
+ * then O(v).
  *
  * \sa \ref igraph_strength() for the version that takes into account
  * edge weights; \ref igraph_degree_1() to efficiently compute the
@@ -1202,6 +1254,7 @@ igraph_error_t igraph_degree(const igraph_t *graph, igraph_vector_int_t *res,
     igraph_integer_t nodes_to_calc;
     igraph_integer_t i, j;
     igraph_vit_t vit;
+    const igraph_vector_int_t *cached;
 
     IGRAPH_CHECK(igraph_vit_create(graph, vids, &vit));
     IGRAPH_FINALLY(igraph_vit_destroy, &vit);
@@ -1235,6 +1288,12 @@ igraph_error_t igraph_degree(const igraph_t *graph, igraph_vector_int_t *res,
                 VECTOR(*res)[i] += (VECTOR(graph->is)[vid + 1] - VECTOR(graph->is)[vid]);
             }
         }
+    } else if ((cached = igraph_i_property_cache_get_degree(graph, mode))) {
+        for (IGRAPH_VIT_RESET(vit), i = 0;
+             !IGRAPH_VIT_END(vit);
+             IGRAPH_VIT_NEXT(vit), i++) {
+            VECTOR(*res)[i] = VECTOR(*cached)[IGRAPH_VIT_GET(vit)];
+        }
     } else { /* no loops */
         if (mode & IGRAPH_OUT) {
             for (IGRAPH_VIT_RESET(vit), i = 0;
@@ -1264,6 +1323,12 @@ igraph_error_t igraph_degree(const igraph_t *graph, igraph_vector_int_t *res,
                 }
             }
         }
+
+        /* Counting loops needs a pass over the edges, keep the result if
+         * the budget allows */
+        if (igraph_vs_is_all(&vids)) {
+            igraph_i_property_cache_set_degree(graph, mode, res);
+        }
     }  /* loops */
 
     igraph_vit_destroy(&vit);
@@ -1861,5 +1926,85 @@ igraph_error_t igraph_i_reverse(igraph_t *graph) {
     igraph_vector_int_swap(&graph->oi, &graph->ii);
     igraph_vector_int_swap(&graph->os, &graph->is);
 
+    /* In- and out-degrees and adjacency lists are swapped too */
+    igraph_i_property_cache_invalidate_all(graph);
+
     return IGRAPH_SUCCESS;
 }
+
+typedef struct {
+    const igraph_vector_int_t *el1;
+    const igraph_vector_int_t *el2;
+} igraph_i_edge_batch_t;
+
+static int igraph_i_edge_batch_cmp(void *data, const void *a, const void *b) {
+    const igraph_i_edge_batch_t *el = (const igraph_i_edge_batch_t *) data;
+    igraph_integer_t ea = *(const igraph_integer_t *) a, eb = *(const igraph_integer_t *) b;
+    igraph_integer_t a1 = VECTOR(*el->el1)[ea], b1 = VECTOR(*el->el1)[eb];
+    igraph_integer_t a2, b2;
+    if (a1 != b1) {
+        return a1 < b1 ? -1 : 1;
+    }
+    a2 = VECTOR(*el->el2)[ea]; b2 = VECTOR(*el->el2)[eb];
+    if (a2 != b2) {
+        return a2 < b2 ? -1 : 1;
+    }
+    /* Equal edges are ordered as igraph_vector_int_pair_order() does */
+    return ea > eb ? -1 : (ea < eb ? 1 : 0);
+}
+
+/* Fills batch with the IDs of the edges from first on, in the order of the
+ * index given by el1 and el2, with the largest ID first among equal edges. */
+static void igraph_i_sort_edge_batch(
+        const igraph_vector_int_t *el1, const igraph_vector_int_t *el2,
+        igraph_integer_t first, igraph_vector_int_t *batch) {
+
+    igraph_i_edge_batch_t el = { el1, el2 };
+    igraph_integer_t i, n = igraph_vector_int_size(batch);
+
+    for (i = 0; i < n; i++) {
+        VECTOR(*batch)[i] = first + i;
+    }
+    igraph_qsort_r(VECTOR(*batch), (size_t) n, sizeof(igraph_integer_t), &el,
+                   igraph_i_edge_batch_cmp);
+}
+
+/* Merges a sorted batch of new edges into an index and its start vector.
+ * The index must have room reserved for the batch, so this cannot fail.
+ * Like a rebuilt index, equal edges are ordered by decreasing ID, and since
+ * new edges have the largest IDs, they go before equal existing edges. */
+static void igraph_i_merge_edge_batch(
+        igraph_vector_int_t *index, igraph_vector_int_t *start,
+        const igraph_vector_int_t *el1, const igraph_vector_int_t *el2,
+        const igraph_vector_int_t *batch, igraph_integer_t nodes) {
+
+    igraph_integer_t m = igraph_vector_int_size(index);
+    igraph_integer_t k = igraph_vector_int_size(batch);
+    igraph_integer_t i = m - 1, j = k - 1, w = m + k - 1, v;
+
+    igraph_vector_int_resize(index, m + k); /* reserved */
+
+    /* Merge from the back, in place */
+    while (j >= 0) {
+        igraph_integer_t b = VECTOR(*batch)[j];
+        if (i >= 0) {
+            igraph_integer_t a = VECTOR(*index)[i];
+            if (VECTOR(*el1)[a] > VECTOR(*el1)[b] ||
+                (VECTOR(*el1)[a] == VECTOR(*el1)[b] && VECTOR(*el2)[a] >= VECTOR(*el2)[b])) {
+                VECTOR(*index)[w--] = a;
+                i--;
+                continue;
+            }
+        }
+        VECTOR(*index)[w--] = b;
+        j--;
+    }
+
+    /* Every start shifts by the number of new edges before its vertex */
+    for (v = 0, j = 0; v <= nodes; v++) {
+        while (j < k && VECTOR(*el1)[VECTOR(*batch)[j]] < v) {
+            j++;
+        }
+        VECTOR(*start)[v] += j;
+    }
+}
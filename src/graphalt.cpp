@@ -1,5 +1,19 @@
 #include "graphalt.h"
+#include "rattributes.h"
 
+#include <limits.h>
+#include <string.h>
+
+static R_altrep_class_t graph_class;
+static R_altrep_class_t index_view_class;
+static R_altrep_class_t edgelist_view_class;
+
+// Version tag of the serialized form. It is written in native byte order and
+// includes the width of igraph_integer_t, so it also detects byte order and
+// integer size mismatches. Graphs with attributes serialize as a list of the
+// structure and the attribute lists.
+static const igraph_integer_t GRAPH_SERIALIZE_VERSION = 0x100 | IGRAPH_INTEGER_SIZE;
+static const int GRAPH_SERIALIZE_HEADER = 4;
 
 static void delete_graph(SEXP xp){
   auto* c_graph = static_cast<igraph_t*>(R_ExternalPtrAddr(xp));
@@ -14,4 +28,651 @@ SEXP create_graph(igraph_t* graph) {
   UNPROTECT(1);
 
   return xp;
-}
\ No newline at end of file
+}
+
+// Graph handles: ALTREP integers of length zero whose data1 is the external
+// pointer holding the igraph_t. Being ALTREP lets them survive serialization.
+// data2 is NULL or a token of the handle, an external pointer whose tag is
+// the environment of the graph, see graph_handle_env().
+//
+// Handles are modified in place by the mutating entry points, unless that
+// would be visible elsewhere; see mutable_graph_handle(). An igraph_t can be
+// held by several handles, when R duplicates one, and by edge list views.
+// The tag of its external pointer counts these extra holders, it is NULL
+// when there are none. Each extra holder owns a token whose protected field
+// is the graph, and releases it once, when the token is released or
+// collected.
+
+static int graph_sharers(SEXP xp) {
+  SEXP tag = R_ExternalPtrTag(xp);
+  return isNull(tag) ? 0 : INTEGER(tag)[0];
+}
+
+static void graph_share(SEXP xp) {
+  if (graph_sharers(xp) == 0) {
+    R_SetExternalPtrTag(xp, ScalarInteger(1));
+  } else {
+    INTEGER(R_ExternalPtrTag(xp))[0]++;
+  }
+}
+
+static void graph_unshare(SEXP xp) {
+  if (graph_sharers(xp) <= 1) {
+    R_SetExternalPtrTag(xp, R_NilValue);
+  } else {
+    INTEGER(R_ExternalPtrTag(xp))[0]--;
+  }
+}
+
+static void graph_release(SEXP token) {
+  SEXP xp = R_ExternalPtrProtected(token);
+  if (!isNull(xp)) {
+    graph_unshare(xp);
+    R_SetExternalPtrProtected(token, R_NilValue);
+  }
+}
+
+// A token that holds a share of the graph xp, or of no graph if xp is NULL.
+static SEXP new_graph_token(SEXP xp, SEXP tag) {
+  SEXP token = PROTECT(R_MakeExternalPtr(NULL, tag, xp));
+  if (!isNull(xp)) {
+    R_RegisterCFinalizerEx(token, graph_release, TRUE);
+    graph_share(xp);
+  }
+  UNPROTECT(1);
+  return token;
+}
+
+static igraph_vector_int_t* graph_fields(igraph_t* graph, int i) {
+  igraph_vector_int_t* fields[] = {
+    &graph->from, &graph->to, &graph->oi, &graph->ii, &graph->os, &graph->is
+  };
+  return fields[i];
+}
+
+static R_xlen_t graph_length(SEXP x) {
+  return 0;
+}
+
+static Rboolean graph_inspect(SEXP x, int pre, int deep, int pvec,
+                              void (*inspect_subtree)(SEXP, int, int, int)) {
+  auto* c_graph = static_cast<igraph_t*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+  Rprintf("igraph2 graph (vcount=%ld, ecount=%ld, %s)\n",
+          (long) igraph_vcount(c_graph), (long) igraph_ecount(c_graph),
+          igraph_is_directed(c_graph) ? "directed" : "undirected");
+  return TRUE;
+}
+
+// Copies of a handle share its environment, see graph_handle_env().
+static SEXP graph_duplicate(SEXP x, Rboolean deep) {
+  SEXP token = PROTECT(new_graph_token(R_altrep_data1(x), graph_handle_env(x)));
+  SEXP res = R_new_altrep(graph_class, R_altrep_data1(x), token);
+  UNPROTECT(1);
+  return res;
+}
+
+static void* graph_dataptr(SEXP x, Rboolean writeable) {
+  static int empty;
+  return &empty;
+}
+
+static SEXP graph_serialized_state(SEXP x) {
+  auto* c_graph = static_cast<igraph_t*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+  igraph_integer_t no_of_nodes = igraph_vcount(c_graph);
+  igraph_integer_t no_of_edges = igraph_ecount(c_graph);
+  size_t size = GRAPH_SERIALIZE_HEADER + 4 * (size_t) no_of_edges + 2 * ((size_t) no_of_nodes + 1);
+  SEXP state = PROTECT(NEW_RAW(sizeof(igraph_integer_t) * size));
+  auto* data = reinterpret_cast<igraph_integer_t*>(RAW(state));
+  int i;
+
+  data[0] = GRAPH_SERIALIZE_VERSION;
+  data[1] = no_of_nodes;
+  data[2] = c_graph->directed;
+  data[3] = no_of_edges;
+  data += GRAPH_SERIALIZE_HEADER;
+  for (i = INDEX_VIEW_FROM; i <= INDEX_VIEW_IS; i++) {
+    igraph_vector_int_t* field = graph_fields(c_graph, i);
+    size_t field_size = (size_t) igraph_vector_int_size(field);
+    if (field_size > 0) {
+      memcpy(data, field->stor_begin, sizeof(igraph_integer_t) * field_size);
+    }
+    data += field_size;
+  }
+
+  SEXP attr = R_igraph_attribute_list(c_graph);
+  if (!isNull(attr)) {
+    SEXP res = PROTECT(NEW_LIST(2));
+    SET_VECTOR_ELT(res, 0, state);
+    SET_VECTOR_ELT(res, 1, attr);
+    UNPROTECT(2);
+    return res;
+  }
+
+  UNPROTECT(1);
+  return state;
+}
+
+// Checks that the serialized index vectors form a valid igraph_t, so that a
+// damaged or hand-made state cannot lead to reads out of bounds later:
+// endpoints are vertices, os and is are start vectors ending at the edge
+// count, and oi and ii list every edge once, grouped by vertex and sorted by
+// the other endpoint. Runs in O(|V|+|E|).
+static bool graph_index_valid(const igraph_integer_t* data, igraph_integer_t no_of_nodes,
+                              igraph_integer_t no_of_edges, bool directed) {
+  const igraph_integer_t* from = data;
+  const igraph_integer_t* to = from + no_of_edges;
+  const igraph_integer_t* index[2] = { to + no_of_edges, to + 2 * no_of_edges };
+  const igraph_integer_t* start[2] = { to + 3 * no_of_edges, to + 3 * no_of_edges + no_of_nodes + 1 };
+  const igraph_integer_t* el[2][2] = { { from, to }, { to, from } };
+  igraph_integer_t e, v, k;
+
+  for (e = 0; e < no_of_edges; e++) {
+    if (from[e] < 0 || from[e] >= no_of_nodes || to[e] < 0 || to[e] >= no_of_nodes ||
+        (!directed && from[e] < to[e])) {
+      return false;
+    }
+  }
+
+  char* seen = R_alloc(no_of_edges > 0 ? no_of_edges : 1, 1);
+  for (int i = 0; i < 2; i++) {
+    if (start[i][0] != 0 || start[i][no_of_nodes] != no_of_edges) {
+      return false;
+    }
+    for (v = 0; v < no_of_nodes; v++) {
+      if (start[i][v] > start[i][v + 1]) {
+        return false;
+      }
+    }
+    memset(seen, 0, no_of_edges);
+    for (v = 0; v < no_of_nodes; v++) {
+      for (k = start[i][v]; k < start[i][v + 1]; k++) {
+        e = index[i][k];
+        if (e < 0 || e >= no_of_edges || seen[e] || el[i][0][e] != v ||
+            (k > start[i][v] && el[i][1][index[i][k - 1]] > el[i][1][e])) {
+          return false;
+        }
+        seen[e] = 1;
+      }
+    }
+  }
+
+  return true;
+}
+
+static SEXP graph_unserialize(SEXP klass, SEXP state) {
+  SEXP attr = R_NilValue;
+  if (TYPEOF(state) == VECSXP && XLENGTH(state) == 2) {
+    attr = VECTOR_ELT(state, 1);
+    state = VECTOR_ELT(state, 0);
+  }
+  if (TYPEOF(state) != RAWSXP) {
+    error("Cannot unserialize igraph2 graph: unknown format, byte order or integer size.");
+  }
+  const auto* data = reinterpret_cast<const igraph_integer_t*>(RAW(state));
+  size_t size = (size_t) XLENGTH(state) / sizeof(igraph_integer_t);
+  igraph_integer_t no_of_nodes, no_of_edges;
+  igraph_t* c_graph;
+  int i;
+
+  if (size < (size_t) GRAPH_SERIALIZE_HEADER || data[0] != GRAPH_SERIALIZE_VERSION) {
+    error("Cannot unserialize igraph2 graph: unknown format, byte order or integer size.");
+  }
+  no_of_nodes = data[1];
+  no_of_edges = data[3];
+  if (no_of_nodes < 0 || no_of_edges < 0 || (size_t) no_of_nodes >= size ||
+      (size_t) no_of_edges >= size ||
+      size != GRAPH_SERIALIZE_HEADER + 4 * (size_t) no_of_edges + 2 * ((size_t) no_of_nodes + 1) ||
+      !graph_index_valid(data + GRAPH_SERIALIZE_HEADER, no_of_nodes, no_of_edges, data[2])) {
+    error("Cannot unserialize igraph2 graph: corrupt data.");
+  }
+
+  c_graph = new igraph_t{};
+  if (igraph_empty(c_graph, 0, data[2]) != IGRAPH_SUCCESS) {
+    delete c_graph;
+    error("Cannot unserialize igraph2 graph: out of memory.");
+  }
+  data += GRAPH_SERIALIZE_HEADER;
+  for (i = INDEX_VIEW_FROM; i <= INDEX_VIEW_IS; i++) {
+    igraph_vector_int_t* field = graph_fields(c_graph, i);
+    igraph_integer_t field_size = i < INDEX_VIEW_OS ? no_of_edges : no_of_nodes + 1;
+    if (igraph_vector_int_resize(field, field_size) != IGRAPH_SUCCESS) {
+      igraph_destroy(c_graph);
+      delete c_graph;
+      error("Cannot unserialize igraph2 graph: out of memory.");
+    }
+    if (field_size > 0) {
+      memcpy(field->stor_begin, data, sizeof(igraph_integer_t) * (size_t) field_size);
+    }
+    data += field_size;
+  }
+  c_graph->n = no_of_nodes;
+  igraph_invalidate_cache(c_graph);
+
+  SEXP xp = PROTECT(create_graph(c_graph));
+  R_igraph_attribute_restore(c_graph, attr);
+  UNPROTECT(1);
+  return wrap_graph(xp);
+}
+
+void register_graph(DllInfo* dll, const char* class_name, const char* package_name) {
+  graph_class = R_make_altinteger_class(class_name, package_name, dll);
+
+  R_set_altrep_Length_method(graph_class, graph_length);
+  R_set_altrep_Inspect_method(graph_class, graph_inspect);
+  R_set_altrep_Duplicate_method(graph_class, graph_duplicate);
+  R_set_altrep_Serialized_state_method(graph_class, graph_serialized_state);
+  R_set_altrep_Unserialize_method(graph_class, graph_unserialize);
+
+  R_set_altvec_Dataptr_method(graph_class, graph_dataptr);
+}
+
+SEXP wrap_graph(SEXP xp) {
+  return R_new_altrep(graph_class, xp, R_NilValue);
+}
+
+// Returns the graph held by a graph handle, or NULL if x is not one.
+igraph_t* graph_handle(SEXP x) {
+  if (!R_altrep_inherits(x, graph_class)) {
+    return NULL;
+  }
+  return static_cast<igraph_t*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+// The environment of a graph handle is the tag of its token. It is created
+// the first time it is asked for, at the latest when the handle is copied,
+// so that all copies of a handle share it, like R's copies of a list form
+// graph share its environment.
+SEXP graph_handle_env(SEXP x) {
+  SEXP token = R_altrep_data2(x);
+  SEXP env;
+
+  if (!isNull(token) && !isNull(R_ExternalPtrTag(token))) {
+    return R_ExternalPtrTag(token);
+  }
+  PROTECT(env = allocSExp(ENVSXP));
+  if (isNull(token)) {
+    R_set_altrep_data2(x, new_graph_token(R_NilValue, env));
+  } else {
+    R_SetExternalPtrTag(token, env);
+  }
+  UNPROTECT(1);
+  return env;
+}
+
+// Returns a graph handle whose graph can be modified in place without the
+// change being visible through anything else, and stores its graph in
+// *graph. *graph is NULL if x is not a handle.
+//
+// Whether x is visible elsewhere is decided from its reference count. The
+// mutating entry points must be called with .Call() directly from the R
+// function that the user calls, as in
+//
+//   add_edges <- function(graph, edges) {
+//     .Call(C_R_igraph_add_edges, graph, ...)
+//   }
+//
+// Then `g <- add_edges(g, ...)` references the handle from the variable of
+// the caller and from the argument of the wrapper only, and anything more
+// means that the handle is shared. Any wrapper in between adds a reference
+// and makes every call copy.
+//
+// A shared handle gets a new handle holding a copy, with the same
+// environment. A handle that is not
+// shared but whose graph is, swaps in a private copy and releases the shared
+// graph.
+SEXP mutable_graph_handle(SEXP x, igraph_t** graph) {
+  igraph_t* c_graph = graph_handle(x);
+  igraph_t* copy;
+  bool shared_handle;
+
+  *graph = c_graph;
+  if (!c_graph) {
+    return x;
+  }
+  shared_handle = REFCNT(x) > 2;
+  if (!shared_handle && graph_sharers(R_altrep_data1(x)) == 0) {
+    return x;
+  }
+
+  copy = new igraph_t{};
+  if (igraph_copy(copy, c_graph) != IGRAPH_SUCCESS) {
+    delete copy;
+    R_igraph_attribute_resume();
+    error("Cannot copy shared igraph2 graph: out of memory.");
+  }
+  SEXP xp = PROTECT(create_graph(copy));
+  *graph = copy;
+
+  if (shared_handle) {
+    SEXP res = PROTECT(wrap_graph(xp));
+    SEXP token = PROTECT(new_graph_token(R_NilValue, graph_handle_env(x)));
+    R_set_altrep_data2(res, token);
+    DUPLICATE_ATTRIB(res, x);
+    UNPROTECT(3);
+    return res;
+  }
+
+  // A handle made by R duplicating another one holds a share of the graph,
+  // which its token releases. Otherwise x was the first holder of the graph,
+  // and one of the others takes its place.
+  SEXP token = R_altrep_data2(x);
+  if (!isNull(token) && R_ExternalPtrProtected(token) == R_altrep_data1(x)) {
+    graph_release(token);
+  } else {
+    graph_unshare(R_altrep_data1(x));
+  }
+  R_set_altrep_data1(x, xp);
+  UNPROTECT(1);
+  return x;
+}
+
+// Index views: ALTREP vectors backed by one of the index vectors of the
+// igraph_t held by an external pointer. data1 is the external pointer, which
+// keeps the graph alive, and data2 is the field as an integer scalar. Writing
+// through the view materializes it: data1 is then replaced by a plain copy
+// and the graph is no longer referenced. The 64-bit build exposes doubles,
+// so there every data pointer request materializes and reads go through
+// Elt/Get_region instead.
+
+static bool index_view_materialized(SEXP x) {
+  return TYPEOF(R_altrep_data1(x)) == R_IGRAPH_INT_SXP;
+}
+
+static igraph_vector_int_t* index_view_field(SEXP x) {
+  auto* c_graph = static_cast<igraph_t*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+  return graph_fields(c_graph, INTEGER(R_altrep_data2(x))[0]);
+}
+
+static SEXP index_view_materialize(SEXP x) {
+  if (!index_view_materialized(x)) {
+    igraph_vector_int_t* field = index_view_field(x);
+    R_xlen_t size = igraph_vector_int_size(field);
+    SEXP data = PROTECT(allocVector(R_IGRAPH_INT_SXP, size));
+    auto* values = static_cast<r_igraph_int_t*>(DATAPTR(data));
+#if IGRAPH_INTEGER_SIZE == 64
+    for (R_xlen_t i = 0; i < size; i++) {
+      values[i] = VECTOR(*field)[i];
+    }
+#else
+    if (size > 0) {
+      memcpy(values, field->stor_begin, sizeof(igraph_integer_t) * (size_t) size);
+    }
+#endif
+    R_set_altrep_data1(x, data);
+    UNPROTECT(1);
+  }
+  return R_altrep_data1(x);
+}
+
+static R_xlen_t index_view_length(SEXP x) {
+  if (index_view_materialized(x)) {
+    return XLENGTH(R_altrep_data1(x));
+  }
+  return igraph_vector_int_size(index_view_field(x));
+}
+
+static Rboolean index_view_inspect(SEXP x, int pre, int deep, int pvec,
+                                   void (*inspect_subtree)(SEXP, int, int, int)) {
+  Rprintf("igraph2 index view (len=%ld, %s)\n", (long) index_view_length(x),
+          index_view_materialized(x) ? "materialized" : "shared");
+  return TRUE;
+}
+
+static SEXP index_view_duplicate(SEXP x, Rboolean deep) {
+  if (index_view_materialized(x)) {
+    return duplicate(R_altrep_data1(x));
+  }
+  return R_new_altrep(index_view_class, R_altrep_data1(x), R_altrep_data2(x));
+}
+
+static void* index_view_dataptr(SEXP x, Rboolean writeable) {
+#if IGRAPH_INTEGER_SIZE == 32
+  if (!writeable && !index_view_materialized(x)) {
+    return index_view_field(x)->stor_begin;
+  }
+#endif
+  return DATAPTR(index_view_materialize(x));
+}
+
+static const void* index_view_dataptr_or_null(SEXP x) {
+#if IGRAPH_INTEGER_SIZE == 64
+  if (!index_view_materialized(x)) {
+    return NULL;
+  }
+#endif
+  return index_view_dataptr(x, FALSE);
+}
+
+static r_igraph_int_t index_view_elt(SEXP x, R_xlen_t i) {
+  if (index_view_materialized(x)) {
+    return static_cast<r_igraph_int_t*>(DATAPTR(R_altrep_data1(x)))[i];
+  }
+  return VECTOR(*index_view_field(x))[i];
+}
+
+static R_xlen_t index_view_get_region(SEXP x, R_xlen_t start, R_xlen_t size, r_igraph_int_t* buf) {
+  R_xlen_t length = index_view_length(x);
+  R_xlen_t count = length - start < size ? length - start : size;
+  if (index_view_materialized(x)) {
+    const auto* values = static_cast<const r_igraph_int_t*>(DATAPTR(R_altrep_data1(x)));
+    for (R_xlen_t i = 0; i < count; i++) {
+      buf[i] = values[start + i];
+    }
+  } else {
+    const igraph_integer_t* values = index_view_field(x)->stor_begin;
+    for (R_xlen_t i = 0; i < count; i++) {
+      buf[i] = values[start + i];
+    }
+  }
+  return count < 0 ? 0 : count;
+}
+
+static int index_view_no_na(SEXP x) {
+  return !index_view_materialized(x);
+}
+
+void register_index_view(DllInfo* dll, const char* class_name, const char* package_name) {
+#if IGRAPH_INTEGER_SIZE == 64
+  index_view_class = R_make_altreal_class(class_name, package_name, dll);
+#else
+  index_view_class = R_make_altinteger_class(class_name, package_name, dll);
+#endif
+
+  R_set_altrep_Length_method(index_view_class, index_view_length);
+  R_set_altrep_Inspect_method(index_view_class, index_view_inspect);
+  R_set_altrep_Duplicate_method(index_view_class, index_view_duplicate);
+
+  R_set_altvec_Dataptr_method(index_view_class, index_view_dataptr);
+  R_set_altvec_Dataptr_or_null_method(index_view_class, index_view_dataptr_or_null);
+
+#if IGRAPH_INTEGER_SIZE == 64
+  R_set_altreal_Elt_method(index_view_class, index_view_elt);
+  R_set_altreal_Get_region_method(index_view_class, index_view_get_region);
+  R_set_altreal_No_NA_method(index_view_class, index_view_no_na);
+#else
+  R_set_altinteger_Elt_method(index_view_class, index_view_elt);
+  R_set_altinteger_Get_region_method(index_view_class, index_view_get_region);
+  R_set_altinteger_No_NA_method(index_view_class, index_view_no_na);
+#endif
+}
+
+SEXP create_index_view(SEXP xp, int field) {
+  SEXP data2 = PROTECT(ScalarInteger(field));
+  SEXP view = R_new_altrep(index_view_class, xp, data2);
+  UNPROTECT(1);
+
+  return view;
+}
+
+// Returns the graph behind an index view, or NULL if x is not an index view
+// or has been materialized.
+igraph_t* index_view_graph(SEXP x) {
+  if (!R_altrep_inherits(x, index_view_class) || index_view_materialized(x)) {
+    return NULL;
+  }
+  return static_cast<igraph_t*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+// Returns the external pointer behind an index view, or NULL if x is not an
+// index view or has been materialized.
+SEXP index_view_xp(SEXP x) {
+  return index_view_graph(x) ? R_altrep_data1(x) : R_NilValue;
+}
+
+SEXP graph_handle_xp(SEXP x) {
+  return graph_handle(x) ? R_altrep_data1(x) : R_NilValue;
+}
+
+// Edge list views: the two-column edge list of the graph held by the external
+// pointer in data1, as 1-based vertex ids computed on access. The view counts
+// as a holder of the graph, so handles copy it before modifying it and the
+// view keeps seeing the edges it was created for. Like index views, a data
+// pointer request replaces data1 with a plain copy. data2 is a token that
+// releases the graph when the view is materialized or collected, whichever
+// comes first.
+
+static SEXP new_edgelist_view(SEXP xp) {
+  SEXP token = PROTECT(new_graph_token(xp, R_NilValue));
+  SEXP view = R_new_altrep(edgelist_view_class, xp, token);
+  UNPROTECT(1);
+  return view;
+}
+
+static bool edgelist_view_materialized(SEXP x) {
+  return TYPEOF(R_altrep_data1(x)) == R_IGRAPH_INT_SXP;
+}
+
+static igraph_t* edgelist_view_graph(SEXP x) {
+  return static_cast<igraph_t*>(R_ExternalPtrAddr(R_altrep_data1(x)));
+}
+
+// igraph_edge() swaps the endpoints of undirected edges.
+static void edgelist_view_fill(const igraph_t* graph, R_xlen_t start, R_xlen_t count,
+                               r_igraph_int_t* buf) {
+  igraph_integer_t no_of_edges = igraph_ecount(graph);
+  bool directed = igraph_is_directed(graph);
+  const igraph_integer_t* first = directed ? graph->from.stor_begin : graph->to.stor_begin;
+  const igraph_integer_t* second = directed ? graph->to.stor_begin : graph->from.stor_begin;
+
+  for (R_xlen_t i = 0; i < count; i++) {
+    R_xlen_t pos = start + i;
+    buf[i] = (pos < no_of_edges ? first[pos] : second[pos - no_of_edges]) + 1;
+  }
+}
+
+static R_xlen_t edgelist_view_length(SEXP x) {
+  if (edgelist_view_materialized(x)) {
+    return XLENGTH(R_altrep_data1(x));
+  }
+  return 2 * (R_xlen_t) igraph_ecount(edgelist_view_graph(x));
+}
+
+static SEXP edgelist_view_materialize(SEXP x) {
+  if (!edgelist_view_materialized(x)) {
+    R_xlen_t size = edgelist_view_length(x);
+    SEXP data = PROTECT(allocVector(R_IGRAPH_INT_SXP, size));
+    edgelist_view_fill(edgelist_view_graph(x), 0, size, static_cast<r_igraph_int_t*>(DATAPTR(data)));
+    R_set_altrep_data1(x, data);
+    graph_release(R_altrep_data2(x));
+    UNPROTECT(1);
+  }
+  return R_altrep_data1(x);
+}
+
+static Rboolean edgelist_view_inspect(SEXP x, int pre, int deep, int pvec,
+                                      void (*inspect_subtree)(SEXP, int, int, int)) {
+  Rprintf("igraph2 edge list view (len=%ld, %s)\n", (long) edgelist_view_length(x),
+          edgelist_view_materialized(x) ? "materialized" : "shared");
+  return TRUE;
+}
+
+static SEXP edgelist_view_duplicate(SEXP x, Rboolean deep) {
+  if (edgelist_view_materialized(x)) {
+    return duplicate(R_altrep_data1(x));
+  }
+  return new_edgelist_view(R_altrep_data1(x));
+}
+
+static void* edgelist_view_dataptr(SEXP x, Rboolean writeable) {
+  return DATAPTR(edgelist_view_materialize(x));
+}
+
+static const void* edgelist_view_dataptr_or_null(SEXP x) {
+  if (!edgelist_view_materialized(x)) {
+    return NULL;
+  }
+  return DATAPTR(R_altrep_data1(x));
+}
+
+static r_igraph_int_t edgelist_view_elt(SEXP x, R_xlen_t i) {
+  r_igraph_int_t value;
+  if (edgelist_view_materialized(x)) {
+    return static_cast<r_igraph_int_t*>(DATAPTR(R_altrep_data1(x)))[i];
+  }
+  edgelist_view_fill(edgelist_view_graph(x), i, 1, &value);
+  return value;
+}
+
+static R_xlen_t edgelist_view_get_region(SEXP x, R_xlen_t start, R_xlen_t size, r_igraph_int_t* buf) {
+  R_xlen_t length = edgelist_view_length(x);
+  R_xlen_t count = length - start < size ? length - start : size;
+  if (count <= 0) {
+    return 0;
+  }
+  if (edgelist_view_materialized(x)) {
+    const auto* values = static_cast<const r_igraph_int_t*>(DATAPTR(R_altrep_data1(x)));
+    for (R_xlen_t i = 0; i < count; i++) {
+      buf[i] = values[start + i];
+    }
+  } else {
+    edgelist_view_fill(edgelist_view_graph(x), start, count, buf);
+  }
+  return count;
+}
+
+static int edgelist_view_no_na(SEXP x) {
+  return !edgelist_view_materialized(x);
+}
+
+void register_edgelist_view(DllInfo* dll, const char* class_name, const char* package_name) {
+#if IGRAPH_INTEGER_SIZE == 64
+  edgelist_view_class = R_make_altreal_class(class_name, package_name, dll);
+#else
+  edgelist_view_class = R_make_altinteger_class(class_name, package_name, dll);
+#endif
+
+  R_set_altrep_Length_method(edgelist_view_class, edgelist_view_length);
+  R_set_altrep_Inspect_method(edgelist_view_class, edgelist_view_inspect);
+  R_set_altrep_Duplicate_method(edgelist_view_class, edgelist_view_duplicate);
+
+  R_set_altvec_Dataptr_method(edgelist_view_class, edgelist_view_dataptr);
+  R_set_altvec_Dataptr_or_null_method(edgelist_view_class, edgelist_view_dataptr_or_null);
+
+#if IGRAPH_INTEGER_SIZE == 64
+  R_set_altreal_Elt_method(edgelist_view_class, edgelist_view_elt);
+  R_set_altreal_Get_region_method(edgelist_view_class, edgelist_view_get_region);
+  R_set_altreal_No_NA_method(edgelist_view_class, edgelist_view_no_na);
+#else
+  R_set_altinteger_Elt_method(edgelist_view_class, edgelist_view_elt);
+  R_set_altinteger_Get_region_method(edgelist_view_class, edgelist_view_get_region);
+  R_set_altinteger_No_NA_method(edgelist_view_class, edgelist_view_no_na);
+#endif
+}
+
+// Returns an edge list matrix with one row per edge. Matrix dimensions are
+// R integers, so this fails for graphs with more than INT_MAX edges.
+SEXP create_edgelist_view(SEXP xp) {
+  auto* c_graph = static_cast<igraph_t*>(R_ExternalPtrAddr(xp));
+  if (igraph_ecount(c_graph) > INT_MAX) {
+    error("Cannot create an edge list matrix with more than %d rows.", INT_MAX);
+  }
+
+  SEXP view = PROTECT(new_edgelist_view(xp));
+  SEXP dim = PROTECT(allocVector(INTSXP, 2));
+  INTEGER(dim)[0] = (int) igraph_ecount(c_graph);
+  INTEGER(dim)[1] = 2;
+  setAttrib(view, R_DimSymbol, dim);
+  UNPROTECT(2);
+
+  return view;
+}
@@ -8,6 +8,49 @@
 
 #include "igraph.h"
 
+// R storage type of igraph_integer_t vectors. R integers are 32 bits wide,
+// so the 64-bit build stores indices in doubles, which are exact up to 2^53.
+#if IGRAPH_INTEGER_SIZE == 64
+#define R_IGRAPH_INT_SXP REALSXP
+#define R_IGRAPH_INT_NA NA_REAL
+typedef double r_igraph_int_t;
+#else
+#define R_IGRAPH_INT_SXP INTSXP
+#define R_IGRAPH_INT_NA NA_INTEGER
+typedef int r_igraph_int_t;
+#endif
+
+enum index_view_field_t {
+  INDEX_VIEW_FROM = 0,
+  INDEX_VIEW_TO,
+  INDEX_VIEW_OI,
+  INDEX_VIEW_II,
+  INDEX_VIEW_OS,
+  INDEX_VIEW_IS
+};
+
 void register_graph(DllInfo* dll, const char* class_name, const char* package_name);
 
-SEXP create_graph(igraph_t* graph);
\ No newline at end of file
+void register_index_view(DllInfo* dll, const char* class_name, const char* package_name);
+
+void register_edgelist_view(DllInfo* dll, const char* class_name, const char* package_name);
+
+SEXP create_graph(igraph_t* graph);
+
+SEXP wrap_graph(SEXP xp);
+
+igraph_t* graph_handle(SEXP x);
+
+SEXP graph_handle_xp(SEXP x);
+
+SEXP mutable_graph_handle(SEXP x, igraph_t** graph);
+
+SEXP graph_handle_env(SEXP x);
+
+SEXP create_index_view(SEXP xp, int field);
+
+igraph_t* index_view_graph(SEXP x);
+
+SEXP index_view_xp(SEXP x);
+
+SEXP create_edgelist_view(SEXP xp);
@@ -31,9 +31,12 @@ __BEGIN_DECLS
  * \define IGRAPH_INTEGER_SIZE
  *
  * Specifies the size of igraph's integer data type; must be one of 32 (for
- * 32-bit integers) or 64 (for 64-bit integers).
+ * 32-bit integers) or 64 (for 64-bit integers). Can be overridden from
+ * the compiler command line, see IGRAPH_INTEGER_SIZE in Makevars.
  */
+#ifndef IGRAPH_INTEGER_SIZE
 #define IGRAPH_INTEGER_SIZE 32
+#endif
 
 #define IGRAPH_DEPRECATED_ENUMVAL __attribute__ ((deprecated))
 
@@ -44,8 +44,10 @@
 #include "igraph_stack.h"
 #include "igraph_heap.h"
 #include "igraph_psumtree.h"
+#include "igraph_alias.h"
 #include "igraph_strvector.h"
 #include "igraph_vector_list.h"
+#include "igraph_ragged.h"
 #include "igraph_vector_ptr.h"
 #include "igraph_sparsemat.h"
 #include "igraph_qsort.h"
@@ -99,5 +101,6 @@
 #include "igraph_eulerian.h"
 #include "igraph_graphicality.h"
 #include "igraph_cycles.h"
+#include "igraph_csr.h"
 
 #endif
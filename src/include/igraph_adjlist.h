@@ -37,6 +37,12 @@ typedef struct igraph_adjlist_t {
     igraph_vector_int_t *adjs;
 } igraph_adjlist_t;
 
+typedef struct igraph_flat_adjlist_t {
+    igraph_integer_t length;
+    igraph_vector_int_t *adjs;
+    igraph_vector_int_t neis;
+} igraph_flat_adjlist_t;
+
 typedef struct igraph_inclist_t {
     igraph_integer_t length;
     igraph_vector_int_t *incs;
@@ -76,6 +82,26 @@ IGRAPH_EXPORT igraph_error_t igraph_adjlist_replace_edge(igraph_adjlist_t* al, i
  */
 #define igraph_adjlist_get(al,no) (&(al)->adjs[(igraph_integer_t)(no)])
 
+IGRAPH_EXPORT igraph_error_t igraph_flat_adjlist_init(const igraph_t *graph, igraph_flat_adjlist_t *al,
+                                                     igraph_neimode_t mode, igraph_loops_t loops,
+                                                     igraph_multiple_t multiple);
+IGRAPH_EXPORT void igraph_flat_adjlist_destroy(igraph_flat_adjlist_t *al);
+IGRAPH_EXPORT igraph_integer_t igraph_flat_adjlist_size(const igraph_flat_adjlist_t *al);
+
+/**
+ * \define igraph_flat_adjlist_get
+ * \brief Query a vector in a flat adjacency list.
+ *
+ * Returns a pointer to a read-only <type>igraph_vector_int_t</type> view
+ * of the neighbors of a vertex. The view must not be modified.
+ * \param al The flat adjacency list object.
+ * \param no The vertex whose adjacent vertices will be returned.
+ * \return Pointer to a constant <type>igraph_vector_int_t</type> object.
+ *
+ * Time complexity: O(1).
+ */
+#define igraph_flat_adjlist_get(al,no) ((const igraph_vector_int_t *) &(al)->adjs[(igraph_integer_t)(no)])
+
 IGRAPH_EXPORT igraph_error_t igraph_adjlist(igraph_t *graph, const igraph_adjlist_t *adjlist,
                                  igraph_neimode_t mode, igraph_bool_t duplicate);
 
@@ -219,6 +245,45 @@ IGRAPH_EXPORT igraph_integer_t igraph_lazy_inclist_size(const igraph_lazy_inclis
                                     : (igraph_i_lazy_inclist_get_real(il,no)))
 IGRAPH_EXPORT igraph_vector_int_t *igraph_i_lazy_inclist_get_real(igraph_lazy_inclist_t *il, igraph_integer_t no);
 
+/* Lazy adjacency and incidence lists that can be shared by the threads of a
+ * parallel algorithm. */
+
+typedef struct igraph_concurrent_adjlist_t {
+    const igraph_t *graph;
+    igraph_integer_t length;
+    igraph_vector_int_t **adjs;
+    igraph_neimode_t mode;
+    igraph_loops_t loops;
+    igraph_multiple_t multiple;
+} igraph_concurrent_adjlist_t;
+
+IGRAPH_EXPORT igraph_error_t igraph_concurrent_adjlist_init(const igraph_t *graph,
+                                                           igraph_concurrent_adjlist_t *al,
+                                                           igraph_neimode_t mode,
+                                                           igraph_loops_t loops,
+                                                           igraph_multiple_t multiple);
+IGRAPH_EXPORT void igraph_concurrent_adjlist_destroy(igraph_concurrent_adjlist_t *al);
+IGRAPH_EXPORT igraph_integer_t igraph_concurrent_adjlist_size(const igraph_concurrent_adjlist_t *al);
+IGRAPH_EXPORT const igraph_vector_int_t *igraph_concurrent_adjlist_get(igraph_concurrent_adjlist_t *al,
+                                                                      igraph_integer_t no);
+
+typedef struct igraph_concurrent_inclist_t {
+    const igraph_t *graph;
+    igraph_integer_t length;
+    igraph_vector_int_t **incs;
+    igraph_neimode_t mode;
+    igraph_loops_t loops;
+} igraph_concurrent_inclist_t;
+
+IGRAPH_EXPORT igraph_error_t igraph_concurrent_inclist_init(const igraph_t *graph,
+                                                           igraph_concurrent_inclist_t *il,
+                                                           igraph_neimode_t mode,
+                                                           igraph_loops_t loops);
+IGRAPH_EXPORT void igraph_concurrent_inclist_destroy(igraph_concurrent_inclist_t *il);
+IGRAPH_EXPORT igraph_integer_t igraph_concurrent_inclist_size(const igraph_concurrent_inclist_t *il);
+IGRAPH_EXPORT const igraph_vector_int_t *igraph_concurrent_inclist_get(igraph_concurrent_inclist_t *il,
+                                                                      igraph_integer_t no);
+
 __END_DECLS
 
 #endif
@@ -0,0 +1,63 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#ifndef IGRAPH_ALIAS_H
+#define IGRAPH_ALIAS_H
+
+#include "igraph_decls.h"
+#include "igraph_error.h"
+#include "igraph_random.h"
+#include "igraph_types.h"
+#include "igraph_vector.h"
+
+__BEGIN_DECLS
+
+/* Walker alias table for sampling from a fixed discrete distribution.
+ * An item is drawn by picking a column c uniformly and returning c with
+ * probability columns[c].prob, and columns[c].alias otherwise. Both are
+ * kept together so that a draw touches a single cache line. */
+
+typedef struct igraph_alias_column_t {
+    igraph_real_t prob;
+    igraph_integer_t alias;
+} igraph_alias_column_t;
+
+typedef struct igraph_alias_t {
+    igraph_alias_column_t *columns;
+    igraph_integer_t size;
+} igraph_alias_t;
+
+#define IGRAPH_ALIAS_INIT_FINALLY(a, weights) \
+    do { IGRAPH_CHECK(igraph_alias_init(a, weights)); \
+        IGRAPH_FINALLY(igraph_alias_destroy, a); } while (0)
+
+IGRAPH_EXPORT igraph_error_t igraph_alias_init(igraph_alias_t *a, const igraph_vector_t *weights);
+IGRAPH_EXPORT void igraph_alias_destroy(igraph_alias_t *a);
+IGRAPH_EXPORT igraph_integer_t igraph_alias_size(const igraph_alias_t *a);
+IGRAPH_EXPORT igraph_integer_t igraph_alias_draw(const igraph_alias_t *a, igraph_rng_t *rng);
+IGRAPH_EXPORT igraph_error_t igraph_alias_sample(const igraph_alias_t *a, igraph_rng_t *rng,
+                                                 igraph_vector_int_t *res, igraph_integer_t k);
+
+__END_DECLS
+
+#endif
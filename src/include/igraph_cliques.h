@@ -29,6 +29,7 @@
 #include "igraph_types.h"
 #include "igraph_datatype.h"
 #include "igraph_vector_list.h"
+#include "igraph_ragged.h"
 
 __BEGIN_DECLS
 
@@ -40,6 +41,10 @@ IGRAPH_EXPORT igraph_error_t igraph_maximal_cliques(
    const igraph_t *graph, igraph_vector_int_list_t *res,
    igraph_integer_t min_size, igraph_integer_t max_size
 );
+IGRAPH_EXPORT igraph_error_t igraph_maximal_cliques_ragged(
+   const igraph_t *graph, igraph_ragged_int_t *res,
+   igraph_integer_t min_size, igraph_integer_t max_size
+);
 IGRAPH_EXPORT igraph_error_t igraph_maximal_cliques_file(const igraph_t *graph,
                                               FILE *outfile,
                                               igraph_integer_t min_size,
@@ -0,0 +1,75 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#ifndef IGRAPH_CSR_H
+#define IGRAPH_CSR_H
+
+#include "igraph_decls.h"
+#include "igraph_constants.h"
+#include "igraph_datatype.h"
+#include "igraph_error.h"
+#include "igraph_types.h"
+#include "igraph_vector.h"
+
+__BEGIN_DECLS
+
+/* Read-only snapshot of a graph in compressed sparse row form. Directed
+ * graphs keep an out- and an in-neighbor array, undirected graphs a single
+ * symmetric one (in_start and in_nei are then empty). Edge weights, if
+ * given, are stored aligned with the neighbor arrays. integer_weights is
+ * true if there are no weights or all of them are integers. */
+
+typedef struct igraph_csr_t {
+    igraph_integer_t n;
+    igraph_integer_t ecount;
+    igraph_bool_t directed;
+    igraph_vector_int_t out_start;
+    igraph_vector_int_t out_nei;
+    igraph_vector_int_t in_start;
+    igraph_vector_int_t in_nei;
+    igraph_bool_t weighted;
+    igraph_bool_t integer_weights;
+    igraph_vector_t out_weight;
+    igraph_vector_t in_weight;
+} igraph_csr_t;
+
+IGRAPH_EXPORT igraph_error_t igraph_csr_init(const igraph_t *graph, igraph_csr_t *csr,
+                                             const igraph_vector_t *weights);
+IGRAPH_EXPORT void igraph_csr_destroy(igraph_csr_t *csr);
+IGRAPH_EXPORT igraph_integer_t igraph_csr_vcount(const igraph_csr_t *csr);
+IGRAPH_EXPORT igraph_integer_t igraph_csr_ecount(const igraph_csr_t *csr);
+IGRAPH_EXPORT igraph_integer_t igraph_csr_size(const igraph_csr_t *csr);
+
+IGRAPH_EXPORT igraph_error_t igraph_csr_bfs(const igraph_csr_t *csr, igraph_integer_t root,
+                                            igraph_neimode_t mode, igraph_vector_int_t *dist);
+IGRAPH_EXPORT igraph_error_t igraph_csr_dijkstra(const igraph_csr_t *csr, igraph_integer_t root,
+                                                 igraph_neimode_t mode, igraph_vector_t *dist);
+IGRAPH_EXPORT igraph_error_t igraph_csr_pagerank(const igraph_csr_t *csr, igraph_real_t damping,
+                                                 igraph_vector_t *res);
+IGRAPH_EXPORT igraph_error_t igraph_csr_components(const igraph_csr_t *csr,
+                                                   igraph_vector_int_t *membership,
+                                                   igraph_integer_t *no);
+
+__END_DECLS
+
+#endif
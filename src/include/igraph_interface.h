@@ -81,6 +81,10 @@ IGRAPH_EXPORT void igraph_i_property_cache_set_bool(const igraph_t *cache, igrap
 IGRAPH_EXPORT void igraph_i_property_cache_invalidate(const igraph_t *graph, igraph_cached_property_t prop);
 IGRAPH_EXPORT void igraph_i_property_cache_invalidate_all(const igraph_t *graph);
 
+IGRAPH_EXPORT size_t igraph_set_property_cache_budget(size_t bytes);
+IGRAPH_EXPORT size_t igraph_property_cache_budget(void);
+IGRAPH_EXPORT size_t igraph_property_cache_size(const igraph_t *graph);
+
 #define IGRAPH_RETURN_IF_CACHED_BOOL(graphptr, prop, resptr) \
     do { \
         if (igraph_i_property_cache_has((graphptr), (prop))) { \
@@ -26,13 +26,14 @@
 
 #include <stdlib.h>
 #include "igraph_decls.h"
+#include "igraph_error.h"
 
 __BEGIN_DECLS
 
-#define IGRAPH_CALLOC(n,t)    (t*) calloc( (n) > 0 ? (size_t)((n)*sizeof(t)) : (size_t)1, 1 )
-#define IGRAPH_MALLOC(n)      malloc( (n) > 0 ? (size_t)((n)) : (size_t)1 )
-#define IGRAPH_REALLOC(p,n,t) (t*) realloc((void*)(p), (n) > 0 ? (size_t)((n)*sizeof(t)) : (size_t)1)
-#define IGRAPH_FREE(p)        (free( (void *)(p) ), (p) = NULL)
+#define IGRAPH_CALLOC(n,t)    (t*) igraph_calloc( (n) > 0 ? (size_t)((n)*sizeof(t)) : (size_t)1, 1 )
+#define IGRAPH_MALLOC(n)      igraph_malloc( (n) > 0 ? (size_t)((n)) : (size_t)1 )
+#define IGRAPH_REALLOC(p,n,t) (t*) igraph_realloc((void*)(p), (n) > 0 ? (size_t)((n)*sizeof(t)) : (size_t)1)
+#define IGRAPH_FREE(p)        (igraph_free( (void *)(p) ), (p) = NULL)
 
 /* These are deprecated and scheduled for removal in 0.11 */
 #define igraph_Calloc IGRAPH_CALLOC
@@ -45,6 +46,20 @@ IGRAPH_EXPORT void *igraph_malloc(size_t size);
 IGRAPH_EXPORT void *igraph_realloc(void* ptr, size_t size);
 IGRAPH_EXPORT void igraph_free(void *ptr);
 
+/* Allocation statistics of an arena, see igraph_arena_begin() */
+
+typedef struct igraph_arena_stats_t {
+    size_t allocations;
+    size_t frees;
+    size_t bytes;
+    size_t live;
+    size_t peak;
+} igraph_arena_stats_t;
+
+IGRAPH_EXPORT igraph_error_t igraph_arena_begin(void);
+IGRAPH_EXPORT void igraph_arena_end(igraph_arena_stats_t *stats);
+IGRAPH_EXPORT void igraph_arena_stats(igraph_arena_stats_t *stats);
+
 __END_DECLS
 
 #endif
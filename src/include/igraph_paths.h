@@ -28,6 +28,7 @@
 #include "igraph_error.h"
 #include "igraph_iterators.h"
 #include "igraph_matrix.h"
+#include "igraph_ragged.h"
 #include "igraph_types.h"
 #include "igraph_vector.h"
 #include "igraph_vector_list.h"
@@ -157,6 +158,12 @@ IGRAPH_EXPORT igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph
                                                 igraph_vector_int_t *nrgeo,
                                                 igraph_integer_t from, const igraph_vs_t to,
                                                 igraph_neimode_t mode);
+IGRAPH_EXPORT igraph_error_t igraph_get_all_shortest_paths_ragged(const igraph_t *graph,
+                                                       igraph_ragged_int_t *vertices,
+                                                       igraph_ragged_int_t *edges,
+                                                       igraph_vector_int_t *nrgeo,
+                                                       igraph_integer_t from, const igraph_vs_t to,
+                                                       igraph_neimode_t mode);
 IGRAPH_EXPORT igraph_error_t igraph_get_all_shortest_paths_dijkstra(const igraph_t *graph,
                                                          igraph_vector_int_list_t *vertices,
                                                          igraph_vector_int_list_t *edges,
@@ -227,6 +234,13 @@ IGRAPH_EXPORT igraph_error_t igraph_get_all_simple_paths(const igraph_t *graph,
                                               igraph_integer_t cutoff,
                                               igraph_neimode_t mode);
 
+IGRAPH_EXPORT igraph_error_t igraph_get_all_simple_paths_ragged(const igraph_t *graph,
+                                                     igraph_ragged_int_t *res,
+                                                     igraph_integer_t from,
+                                                     const igraph_vs_t to,
+                                                     igraph_integer_t cutoff,
+                                                     igraph_neimode_t mode);
+
 IGRAPH_EXPORT igraph_error_t igraph_random_walk(const igraph_t *graph,
                                      const igraph_vector_t *weights,
                                      igraph_vector_int_t *vertices,
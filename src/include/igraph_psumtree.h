@@ -26,6 +26,7 @@
 
 #include "igraph_decls.h"
 #include "igraph_error.h"
+#include "igraph_random.h"
 #include "igraph_vector.h"
 
 __BEGIN_DECLS
@@ -46,6 +47,8 @@ IGRAPH_EXPORT igraph_error_t igraph_psumtree_search(const igraph_psumtree_t *t,
 IGRAPH_EXPORT igraph_error_t igraph_psumtree_update(igraph_psumtree_t *t, igraph_integer_t idx,
                                          igraph_real_t new_value);
 IGRAPH_EXPORT igraph_real_t igraph_psumtree_sum(const igraph_psumtree_t *t);
+IGRAPH_EXPORT igraph_error_t igraph_psumtree_sample(const igraph_psumtree_t *t, igraph_rng_t *rng,
+                                                    igraph_vector_int_t *res, igraph_integer_t k);
 
 __END_DECLS
 
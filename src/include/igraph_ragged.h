@@ -0,0 +1,77 @@
+/* -*- mode: C -*-  */
+/* vim:set ts=4 sw=4 sts=4 et: */
+/*
+   IGraph library.
+   Copyright (C) 2024 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#ifndef IGRAPH_RAGGED_H
+#define IGRAPH_RAGGED_H
+
+#include "igraph_decls.h"
+#include "igraph_error.h"
+#include "igraph_types.h"
+#include "igraph_vector.h"
+#include "igraph_vector_list.h"
+
+__BEGIN_DECLS
+
+/* Packed list of integer vectors ("ragged array"). All items are stored
+ * one after the other in a single value vector; item i is
+ * values[offsets[i]] ... values[offsets[i+1]-1]. offsets has one more
+ * element than there are items and starts with zero. Values pushed after
+ * the last offset form an open item, closed by igraph_ragged_int_end_item(). */
+
+typedef struct igraph_ragged_int_t {
+    igraph_vector_int_t values;
+    igraph_vector_int_t offsets;
+} igraph_ragged_int_t;
+
+#define IGRAPH_RAGGED_INT_INIT_FINALLY(r) \
+    do { IGRAPH_CHECK(igraph_ragged_int_init(r)); \
+        IGRAPH_FINALLY(igraph_ragged_int_destroy, r); } while (0)
+
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_init(igraph_ragged_int_t *r);
+IGRAPH_EXPORT void igraph_ragged_int_destroy(igraph_ragged_int_t *r);
+IGRAPH_EXPORT void igraph_ragged_int_clear(igraph_ragged_int_t *r);
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_reserve(igraph_ragged_int_t *r,
+                                                       igraph_integer_t items,
+                                                       igraph_integer_t values);
+IGRAPH_EXPORT igraph_integer_t igraph_ragged_int_size(const igraph_ragged_int_t *r);
+IGRAPH_EXPORT igraph_integer_t igraph_ragged_int_item_size(const igraph_ragged_int_t *r,
+                                                           igraph_integer_t i);
+IGRAPH_EXPORT const igraph_vector_int_t *igraph_ragged_int_view(const igraph_ragged_int_t *r,
+                                                               igraph_integer_t i,
+                                                               igraph_vector_int_t *v);
+
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_push_value(igraph_ragged_int_t *r,
+                                                          igraph_integer_t value);
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_append_item(igraph_ragged_int_t *r,
+                                                           const igraph_ragged_int_t *from,
+                                                           igraph_integer_t i);
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_end_item(igraph_ragged_int_t *r);
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_push_back(igraph_ragged_int_t *r,
+                                                         const igraph_vector_int_t *item);
+
+IGRAPH_EXPORT igraph_error_t igraph_ragged_int_to_list(const igraph_ragged_int_t *r,
+                                                       igraph_vector_int_list_t *list);
+
+__END_DECLS
+
+#endif
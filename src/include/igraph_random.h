@@ -56,6 +56,13 @@ __BEGIN_DECLS
  * - get_gamma()
  * - get_pois()
  *
+ * Generators that can produce several values at once, or that support
+ * multiple independent streams, may also supply:
+ *
+ * - get_block()
+ * - seed_stream()
+ * - advance()
+ *
  * The best is probably to define get() leave the others as NULL; igraph will use
  * default implementations for these.
  *
@@ -76,6 +83,12 @@ __BEGIN_DECLS
  * versions of igraph_integer_t as igraph can be compiled for both cases. If
  * you are unsure, leave get_int() unimplemented and igraph will provide its
  * own implementation based on get().
+ *
+ * get_block() must fill its output with exactly the values that the same
+ * number of get() calls would return. seed_stream() selects the stream of
+ * the generator independently of the seed, so that generators seeded with
+ * the same seed but different streams produce different sequences.
+ * advance() moves the generator forward by the given number of get() calls.
  */
 typedef struct igraph_rng_type_t {
     const char *name;
@@ -103,6 +116,12 @@ typedef struct igraph_rng_type_t {
     igraph_real_t (*get_gamma)(void *state, igraph_real_t shape,
                                igraph_real_t scale);
     igraph_real_t (*get_pois)(void *state, igraph_real_t mu);
+
+    /* Optional bulk generation and stream support; igraph falls back to
+     * get() or reports an error when these are missing */
+    void (*get_block)(void *state, igraph_uint_t *out, igraph_integer_t n);
+    igraph_error_t (*seed_stream)(void *state, igraph_uint_t seed, igraph_uint_t stream);
+    void (*advance)(void *state, igraph_uint_t delta);
 } igraph_rng_type_t;
 
 typedef struct igraph_rng_t {
@@ -116,7 +135,13 @@ typedef struct igraph_rng_t {
 IGRAPH_EXPORT igraph_error_t igraph_rng_init(igraph_rng_t *rng, const igraph_rng_type_t *type);
 IGRAPH_EXPORT void igraph_rng_destroy(igraph_rng_t *rng);
 
+IGRAPH_EXPORT igraph_error_t igraph_rng_init_stream(igraph_rng_t *rng, const igraph_rng_type_t *type,
+                                                    igraph_uint_t seed, igraph_uint_t stream);
+
 IGRAPH_EXPORT igraph_error_t igraph_rng_seed(igraph_rng_t *rng, igraph_uint_t seed);
+IGRAPH_EXPORT igraph_error_t igraph_rng_seed_stream(igraph_rng_t *rng, igraph_uint_t seed,
+                                                    igraph_uint_t stream);
+IGRAPH_EXPORT void igraph_rng_advance(igraph_rng_t *rng, igraph_uint_t delta);
 IGRAPH_EXPORT igraph_integer_t igraph_rng_bits(const igraph_rng_t* rng);
 IGRAPH_EXPORT igraph_uint_t igraph_rng_max(const igraph_rng_t *rng);
 IGRAPH_EXPORT const char *igraph_rng_name(const igraph_rng_t *rng);
@@ -131,6 +156,10 @@ IGRAPH_EXPORT igraph_real_t igraph_rng_get_unif(
     igraph_rng_t *rng, igraph_real_t l, igraph_real_t h
 );
 IGRAPH_EXPORT igraph_real_t igraph_rng_get_unif01(igraph_rng_t *rng);
+IGRAPH_EXPORT igraph_error_t igraph_rng_get_unif_vector(
+    igraph_rng_t *rng, igraph_real_t l, igraph_real_t h,
+    igraph_integer_t n, igraph_vector_t *result
+);
 IGRAPH_EXPORT igraph_real_t igraph_rng_get_geom(igraph_rng_t *rng, igraph_real_t p);
 IGRAPH_EXPORT igraph_real_t igraph_rng_get_binom(
     igraph_rng_t *rng, igraph_integer_t n, igraph_real_t p
@@ -66,6 +66,12 @@ typedef struct {
     igraph_integer_t col;
 } igraph_sparsemat_iterator_t;
 
+/* Row-compressed copy of a matrix, see igraph_sparsemat_csr_init() */
+typedef struct {
+    igraph_sparsemat_t rows;      /* the transpose, column i holds row i */
+    igraph_vector_int_t blocks;   /* row blocks of about equal non-zeros */
+} igraph_sparsemat_csr_t;
+
 IGRAPH_EXPORT igraph_error_t igraph_sparsemat_init(
     igraph_sparsemat_t *A, igraph_integer_t rows, igraph_integer_t cols,
     igraph_integer_t nzmax
@@ -272,6 +278,16 @@ IGRAPH_EXPORT igraph_error_t igraph_sparsemat_dense_multiply(const igraph_matrix
                                                   const igraph_sparsemat_t *B,
                                                   igraph_matrix_t *res);
 
+IGRAPH_EXPORT igraph_error_t igraph_sparsemat_csr_init(igraph_sparsemat_csr_t *csr,
+                                                       const igraph_sparsemat_t *A);
+IGRAPH_EXPORT void igraph_sparsemat_csr_destroy(igraph_sparsemat_csr_t *csr);
+IGRAPH_EXPORT igraph_error_t igraph_sparsemat_csr_gaxpy(const igraph_sparsemat_csr_t *csr,
+                                                        const igraph_vector_t *x,
+                                                        igraph_vector_t *res);
+IGRAPH_EXPORT igraph_error_t igraph_sparsemat_csr_multiply_by_dense(const igraph_sparsemat_csr_t *csr,
+                                                                    const igraph_matrix_t *B,
+                                                                    igraph_matrix_t *res);
+
 IGRAPH_EXPORT igraph_error_t igraph_sparsemat_view(igraph_sparsemat_t *A, igraph_integer_t nzmax, igraph_integer_t m, igraph_integer_t n,
                                         igraph_integer_t *p, igraph_integer_t *i, igraph_real_t *x, igraph_integer_t nz);
 
@@ -35,10 +35,13 @@ __BEGIN_DECLS
  * \ingroup internal
  */
 
+struct igraph_i_strpool_t;
+
 typedef struct s_igraph_strvector {
     char **stor_begin;
     char **stor_end;
     char **end;
+    struct igraph_i_strpool_t *pool; /* NULL unless interned */
 } igraph_strvector_t;
 
 /**
@@ -58,12 +61,16 @@ typedef struct s_igraph_strvector {
  */
 #define STR(sv,i) ((const char *)((sv).stor_begin[(i)]))
 
-#define IGRAPH_STRVECTOR_NULL { 0,0,0 }
+#define IGRAPH_STRVECTOR_NULL { 0,0,0,0 }
 #define IGRAPH_STRVECTOR_INIT_FINALLY(sv, size) \
     do { IGRAPH_CHECK(igraph_strvector_init(sv, size)); \
         IGRAPH_FINALLY( igraph_strvector_destroy, sv); } while (0)
 
 IGRAPH_EXPORT igraph_error_t igraph_strvector_init(igraph_strvector_t *sv, igraph_integer_t len);
+IGRAPH_EXPORT igraph_error_t igraph_strvector_init_interned(igraph_strvector_t *sv, igraph_integer_t len);
+IGRAPH_EXPORT igraph_bool_t igraph_strvector_is_interned(const igraph_strvector_t *sv);
+IGRAPH_EXPORT igraph_bool_t igraph_strvector_equal_elements(
+    const igraph_strvector_t *sv, igraph_integer_t i, igraph_integer_t j);
 IGRAPH_EXPORT void igraph_strvector_destroy(igraph_strvector_t *sv);
 IGRAPH_EXPORT igraph_integer_t igraph_strvector_size(const igraph_strvector_t *sv);
 IGRAPH_EXPORT igraph_integer_t igraph_strvector_capacity(const igraph_strvector_t *sv);
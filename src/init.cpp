@@ -6,30 +6,109 @@
 #include "igraph_constructors.h"
 #include "igraph_conversion.h"
 #include "igraph_vector_list.h"
+#include "igraph_ragged.h"
+#include "igraph_cliques.h"
+#include "igraph_paths.h"
+#include "igraph_structural.h"
+#include "igraph_csr.h"
+#include "igraph_memory.h"
+
+#include "core/name_index.h"
 
 #include "graphalt.h"
+#include "rattributes.h"
 
+#include <limits.h>
 #include <math.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <vector>
 
 #define R_IGRAPH_TYPE_VERSION "0.8.0"
 #define R_IGRAPH_VERSION_VAR ".__igraph_version__."
 
-#if IGRAPH_INTEGER_SIZE == 64
-#error "Error"
-#endif
-
 SEXP R_igraph2_warning(void)
 {
   Rf_warning("hello world");
   return R_NilValue;
 }
 
+// Native error path. The igraph error handler frees the FINALLY stack and
+// keeps the message; entry points then raise it with R_igraph_check(). R level
+// errors and interrupts are caught by R_igraph_protect(), which frees the
+// FINALLY stack before R continues unwinding. Together they replace the
+// on.exit(R_igraph_finalizer) calls in the R wrappers. R errors in attribute
+// handler callbacks are caught by the handler and resumed by R_igraph_check().
+
+static char R_igraph_errmsg[1000];
+
+static void R_igraph_error_handler(const char *reason, const char *file,
+                                   int line, igraph_error_t igraph_errno) {
+  snprintf(R_igraph_errmsg, sizeof(R_igraph_errmsg), "At %s:%d : %s, %s",
+           file, line, reason, igraph_strerror(igraph_errno));
+  IGRAPH_FINALLY_FREE();
+}
+
+static void R_igraph_error(void) {
+  error("%s", R_igraph_errmsg);
+}
+
+static void R_igraph_check(igraph_error_t err) {
+  if (err != IGRAPH_SUCCESS) {
+    R_igraph_attribute_resume();
+    R_igraph_error();
+  }
+}
+
+static void R_igraph_unwind_cleanup(void *data, Rboolean jump) {
+  if (jump) {
+    IGRAPH_FINALLY_FREE();
+  }
+}
+
+template <typename F>
+static SEXP R_igraph_protect(F &&body) {
+  SEXP token = PROTECT(R_MakeUnwindCont());
+  SEXP result = R_UnwindProtect(
+    [](void *data) -> SEXP { return (*static_cast<F*>(data))(); },
+    &body, R_igraph_unwind_cleanup, NULL, token);
+  UNPROTECT(1);
+  return result;
+}
+
+// Every graph has an environment before R can copy it, so that a graph and
+// its copies share one. List form graphs get it when they are created and
+// graph handles when they are first copied, see graph_handle_env(). The
+// graph id in it is only generated by R_igraph_graph_env(), the first time
+// something asks for it: most graphs are temporaries that never need one,
+// and generating the UUID is costly.
+static void R_igraph_env_set_id(SEXP env) {
+  uuid_t my_id;
+  char my_id_chr[40];
+  SEXP l1, l2;
+
+  l1 = PROTECT(install("myid"));
+  if (findVarInFrame(env, l1) != R_UnboundValue) {
+    UNPROTECT(1);
+    return;
+  }
+
+  uuid_generate(my_id);
+  uuid_unparse_lower(my_id, my_id_chr);
+
+  l2 = PROTECT(mkString(my_id_chr));
+  defineVar(l1, l2, env);
+
+  l1 = PROTECT(install(R_IGRAPH_VERSION_VAR));
+  l2 = PROTECT(mkString(R_IGRAPH_TYPE_VERSION));
+  defineVar(l1, l2, env);
+
+  UNPROTECT(4);
+}
+
 SEXP R_igraph_add_env(SEXP graph) {
   SEXP result = graph;
   int i;
-  uuid_t my_id;
-  char my_id_chr[40];
   int px = 0;
 
   if (GET_LENGTH(graph) != 10) {
@@ -43,52 +122,74 @@ SEXP R_igraph_add_env(SEXP graph) {
 
   SET_VECTOR_ELT(result, 9, allocSExp(ENVSXP));
 
-  uuid_generate(my_id);
-  uuid_unparse_lower(my_id, my_id_chr);
+  UNPROTECT(px);
 
-  SEXP l1 = PROTECT(install("myid")); px++;
-  SEXP l2 = PROTECT(mkString(my_id_chr)); px++;
-  defineVar(l1, l2, VECTOR_ELT(result, 9));
+  return result;
+}
 
-  l1 = PROTECT(install(R_IGRAPH_VERSION_VAR)); px++;
-  l2 = PROTECT(mkString(R_IGRAPH_TYPE_VERSION)); px++;
-  defineVar(l1, l2, VECTOR_ELT(result, 9));
+// Returns the environment of a graph, with the graph id in it.
+SEXP R_igraph_graph_env(SEXP graph) {
+  SEXP env;
 
-  UNPROTECT(px);
+  if (graph_handle(graph)) {
+    env = graph_handle_env(graph);
+  } else {
+    if (GET_LENGTH(graph) != 10) {
+      error("Graph object is too old, upgrade it first.");
+    }
+    if (isNull(VECTOR_ELT(graph, 9))) {
+      R_igraph_add_env(graph);
+    }
+    env = VECTOR_ELT(graph, 9);
+  }
+  R_igraph_env_set_id(env);
+  return env;
+}
+
+SEXP R_igraph_integer_to_SEXP(igraph_integer_t value) {
+  SEXP result = PROTECT(allocVector(R_IGRAPH_INT_SXP, 1));
+  static_cast<r_igraph_int_t*>(DATAPTR(result))[0] = value;
+  UNPROTECT(1);
+  return result;
+}
 
+igraph_integer_t R_SEXP_to_integer(SEXP value) {
+  if (TYPEOF(value) == REALSXP) {
+    return (igraph_integer_t) REAL(value)[0];
+  }
+  return INTEGER(value)[0];
+}
+
+SEXP R_igraph_vector_int_to_SEXP(const igraph_vector_int_t *v) {
+  R_xlen_t size = igraph_vector_int_size(v);
+  SEXP result = PROTECT(allocVector(R_IGRAPH_INT_SXP, size));
+#if IGRAPH_INTEGER_SIZE == 64
+  double *values = REAL(result);
+  for (R_xlen_t i = 0; i < size; i++) {
+    values[i] = VECTOR(*v)[i];
+  }
+#else
+  igraph_vector_int_copy_to(v, INTEGER(result));
+#endif
+  UNPROTECT(1);
   return result;
 }
 
 SEXP R_igraph_to_SEXP(const igraph_t *graph) {
 
   SEXP result;
-  long int no_of_nodes=igraph_vcount(graph);
-  long int no_of_edges=igraph_ecount(graph);
 
   PROTECT(result=NEW_LIST(10));
-  SET_VECTOR_ELT(result, 0, NEW_INTEGER(1));
+  SET_VECTOR_ELT(result, 0, R_igraph_integer_to_SEXP(igraph_vcount(graph)));
   SET_VECTOR_ELT(result, 1, NEW_LOGICAL(1));
-  SET_VECTOR_ELT(result, 2, NEW_INTEGER(no_of_edges));
-  SET_VECTOR_ELT(result, 3, NEW_INTEGER(no_of_edges));
-  SET_VECTOR_ELT(result, 4, NEW_INTEGER(no_of_edges));
-  SET_VECTOR_ELT(result, 5, NEW_INTEGER(no_of_edges));
-  SET_VECTOR_ELT(result, 6, NEW_INTEGER(no_of_nodes+1));
-  SET_VECTOR_ELT(result, 7, NEW_INTEGER(no_of_nodes+1));
-
-  INTEGER(VECTOR_ELT(result, 0))[0]=static_cast<uint32_t>(no_of_nodes);
+  SET_VECTOR_ELT(result, 2, R_igraph_vector_int_to_SEXP(&graph->from));
+  SET_VECTOR_ELT(result, 3, R_igraph_vector_int_to_SEXP(&graph->to));
+  SET_VECTOR_ELT(result, 4, R_igraph_vector_int_to_SEXP(&graph->oi));
+  SET_VECTOR_ELT(result, 5, R_igraph_vector_int_to_SEXP(&graph->ii));
+  SET_VECTOR_ELT(result, 6, R_igraph_vector_int_to_SEXP(&graph->os));
+  SET_VECTOR_ELT(result, 7, R_igraph_vector_int_to_SEXP(&graph->is));
+
   LOGICAL(VECTOR_ELT(result, 1))[0]=graph->directed;
-  memcpy(INTEGER(VECTOR_ELT(result, 2)), graph->from.stor_begin,
-         sizeof(igraph_integer_t)*(size_t) no_of_edges);
-  memcpy(INTEGER(VECTOR_ELT(result, 3)), graph->to.stor_begin,
-         sizeof(igraph_integer_t)*(size_t) no_of_edges);
-  memcpy(INTEGER(VECTOR_ELT(result, 4)), graph->oi.stor_begin,
-         sizeof(igraph_integer_t)*(size_t) no_of_edges);
-  memcpy(INTEGER(VECTOR_ELT(result, 5)), graph->ii.stor_begin,
-         sizeof(igraph_integer_t)*(size_t) no_of_edges);
-  memcpy(INTEGER(VECTOR_ELT(result, 6)), graph->os.stor_begin,
-         sizeof(igraph_integer_t)*(size_t) (no_of_nodes+1));
-  memcpy(INTEGER(VECTOR_ELT(result, 7)), graph->is.stor_begin,
-         sizeof(igraph_integer_t)*(size_t) (no_of_nodes+1));
 
   SET_CLASS(result, ScalarString(CREATE_STRING_VECTOR("igraph2")));
 
@@ -97,17 +198,60 @@ SEXP R_igraph_to_SEXP(const igraph_t *graph) {
   // SET_VECTOR_ELT(result, 8, reinterpret_cast<SEXP>(graph->attr));
   // REAL(VECTOR_ELT(reinterpret_cast<SEXP>(graph->attr), 0))[0] += 1;
 
-  /* Environment for vertex/edge seqs */
-  SET_VECTOR_ELT(result, 9, R_NilValue);
-  R_igraph_add_env(result);
+  /* Environment for vertex/edge seqs, the id in it is created on demand */
+  SET_VECTOR_ELT(result, 9, allocSExp(ENVSXP));
 
   UNPROTECT(1);
   return result;
 }
 
+// Takes ownership of graph. The index vectors are not copied, the list holds
+// ALTREP views over the graph instead, see create_index_view().
+SEXP R_igraph_to_SEXP_view(igraph_t *graph) {
+
+  SEXP result, xp;
+  int i;
+
+  PROTECT(xp=create_graph(graph));
+  PROTECT(result=NEW_LIST(10));
+  SET_VECTOR_ELT(result, 0, R_igraph_integer_to_SEXP(igraph_vcount(graph)));
+  SET_VECTOR_ELT(result, 1, NEW_LOGICAL(1));
+  for (i = INDEX_VIEW_FROM; i <= INDEX_VIEW_IS; i++) {
+    SET_VECTOR_ELT(result, i + 2, create_index_view(xp, i));
+  }
+
+  LOGICAL(VECTOR_ELT(result, 1))[0]=graph->directed;
+
+  SET_CLASS(result, ScalarString(CREATE_STRING_VECTOR("igraph2")));
+
+  /* Environment for vertex/edge seqs, the id in it is created on demand */
+  SET_VECTOR_ELT(result, 9, allocSExp(ENVSXP));
+
+  UNPROTECT(2);
+  return result;
+}
+
+// Read-only: goes through DATAPTR_RO so that index views are not materialized.
+// The 64-bit build cannot alias R memory and converts into a buffer that R
+// releases at the end of the .Call.
 int R_SEXP_to_vector(SEXP sv, igraph_vector_int_t *v) {
-  v->stor_begin=INTEGER(sv);
-  v->stor_end=v->stor_begin+GET_LENGTH(sv);
+#if IGRAPH_INTEGER_SIZE == 64
+  R_xlen_t size = XLENGTH(sv);
+  v->stor_begin=reinterpret_cast<igraph_integer_t*>(R_alloc(size, sizeof(igraph_integer_t)));
+  if (TYPEOF(sv) == REALSXP) {
+    for (R_xlen_t i = 0; i < size; i++) {
+      v->stor_begin[i] = (igraph_integer_t) REAL_ELT(sv, i);
+    }
+  } else {
+    for (R_xlen_t i = 0; i < size; i++) {
+      v->stor_begin[i] = INTEGER_ELT(sv, i);
+    }
+  }
+  v->stor_end=v->stor_begin+size;
+#else
+  v->stor_begin=const_cast<int*>(INTEGER_RO(sv));
+  v->stor_end=v->stor_begin+XLENGTH(sv);
+#endif
   v->end=v->stor_end;
   return 0;
 }
@@ -131,17 +275,20 @@ std::vector<igraph_integer_t> to_vector(SEXP sv)
 }
 
 SEXP R_igraph_create(SEXP edges, SEXP pn, SEXP pdirected) {
-  igraph_t g;
+  igraph_t* g;
   igraph_vector_int_t v;
-  igraph_integer_t n=(igraph_integer_t) INTEGER(pn)[0];
+  igraph_integer_t n=R_SEXP_to_integer(pn);
   igraph_bool_t directed=LOGICAL(pdirected)[0];
   SEXP result;
 
   R_SEXP_to_vector(edges, &v);
 
-  igraph_create(&g, &v, n, directed);
-  PROTECT(result=R_igraph_to_SEXP(&g));
-  igraph_destroy(&g);
+  g = new igraph_t{};
+  if (igraph_create(g, &v, n, directed) != IGRAPH_SUCCESS) {
+    delete g;
+    R_igraph_error();
+  }
+  PROTECT(result=R_igraph_to_SEXP_view(g));
 
   UNPROTECT(1);
   return result;
@@ -149,8 +296,21 @@ SEXP R_igraph_create(SEXP edges, SEXP pn, SEXP pdirected) {
 
 
 int R_SEXP_to_igraph(SEXP graph, igraph_t *res) {
+  igraph_t *owner=index_view_graph(VECTOR_ELT(graph, 2));
+  int i;
+
+  // Unmodified views over one graph: use its vectors without conversion
+  for (i = INDEX_VIEW_TO; owner && i <= INDEX_VIEW_IS; i++) {
+    if (index_view_graph(VECTOR_ELT(graph, i + 2)) != owner) {
+      owner=NULL;
+    }
+  }
+  if (owner) {
+    *res=*owner;
+    return 0;
+  }
 
-  res->n=(igraph_integer_t) INTEGER(VECTOR_ELT(graph, 0))[0];
+  res->n=R_SEXP_to_integer(VECTOR_ELT(graph, 0));
   res->directed=LOGICAL(VECTOR_ELT(graph, 1))[0];
   R_SEXP_to_vector(VECTOR_ELT(graph, 2), &res->from);
   R_SEXP_to_vector(VECTOR_ELT(graph, 3), &res->to);
@@ -159,36 +319,78 @@ int R_SEXP_to_igraph(SEXP graph, igraph_t *res) {
   R_SEXP_to_vector(VECTOR_ELT(graph, 6), &res->os);
   R_SEXP_to_vector(VECTOR_ELT(graph, 7), &res->is);
 
-  // Ignroe attributes. No logic with initialization of attributes table
-  /* attributes */
-  //REAL(VECTOR_ELT(VECTOR_ELT(graph, 8), 0))[0] = 1; /* R objects refcount */
-  //REAL(VECTOR_ELT(VECTOR_ELT(graph, 8), 0))[1] = 0; /* igraph_t objects */
-  //res->attr=VECTOR_ELT(graph, 8);
+  // List form graphs carry no attributes or cache, only graph handles do
+  res->attr=NULL;
+  res->cache=NULL;
 
   return 0;
 }
 
+// Accepts both graph handles and list form graphs. tmp receives the
+// decoded list form graph and must outlive the returned pointer.
+igraph_t *R_igraph_graph(SEXP graph, igraph_t *tmp) {
+  igraph_t *c_graph = graph_handle(graph);
+  if (!c_graph) {
+    R_SEXP_to_igraph(graph, tmp);
+    c_graph = tmp;
+  }
+  return c_graph;
+}
+
 SEXP R_igraph_finalizer(void) {
   IGRAPH_FINALLY_FREE();
   return R_NilValue;
 }
 
+// Returns the 1-based edge list. By column, graphs backed by an external
+// pointer get a lazy matrix view, see create_edgelist_view().
 SEXP R_igraph_get_edgelist(SEXP graph, SEXP pbycol) {
-
-  igraph_t g;
-  igraph_vector_int_t res;
   igraph_bool_t bycol=LOGICAL(pbycol)[0];
-  SEXP result;
+  SEXP xp=graph_handle_xp(graph);
+
+  if (isNull(xp) && !graph_handle(graph)) {
+    xp=index_view_xp(VECTOR_ELT(graph, 2));
+    for (int i = INDEX_VIEW_TO; !isNull(xp) && i <= INDEX_VIEW_IS; i++) {
+      if (index_view_xp(VECTOR_ELT(graph, i + 2)) != xp) {
+        xp=R_NilValue;
+      }
+    }
+  }
+  if (bycol && !isNull(xp)) {
+    return create_edgelist_view(xp);
+  }
 
-  R_SEXP_to_igraph(graph, &g);
-  igraph_vector_int_init(&res, 0);
-  igraph_get_edgelist(&g, &res, bycol);
-  PROTECT(result=NEW_INTEGER(igraph_vector_int_size(&res)));
-  igraph_vector_int_copy_to(&res, INTEGER(result));
-  igraph_vector_int_destroy(&res);
+  return R_igraph_protect([&]() -> SEXP {
+    igraph_t tmp;
+    igraph_t *g = R_igraph_graph(graph, &tmp);
+    igraph_vector_int_t res;
+    SEXP result;
 
-  UNPROTECT(1);
-  return result;
+    if (bycol && igraph_ecount(g) > INT_MAX) {
+      error("Cannot create an edge list matrix with more than %d rows.", INT_MAX);
+    }
+
+    igraph_vector_int_init(&res, 0);
+    IGRAPH_FINALLY(igraph_vector_int_destroy, &res);
+    R_igraph_check(igraph_get_edgelist(g, &res, bycol));
+    PROTECT(result=allocVector(R_IGRAPH_INT_SXP, igraph_vector_int_size(&res)));
+    auto *values = static_cast<r_igraph_int_t*>(DATAPTR(result));
+    for (R_xlen_t i = 0; i < XLENGTH(result); i++) {
+      values[i] = VECTOR(res)[i] + 1;
+    }
+    if (bycol) {
+      SEXP dim = PROTECT(allocVector(INTSXP, 2));
+      INTEGER(dim)[0] = (int) igraph_ecount(g);
+      INTEGER(dim)[1] = 2;
+      setAttrib(result, R_DimSymbol, dim);
+      UNPROTECT(1);
+    }
+    igraph_vector_int_destroy(&res);
+    IGRAPH_FINALLY_CLEAN(1);
+
+    UNPROTECT(1);
+    return result;
+  });
 }
 
 SEXP R_igraph_finalizer2(void) {
@@ -209,7 +411,7 @@ SEXP R_igraph_finalizer2(void) {
 
 // empty graph using vectors
 SEXP R_igraph_empty2(SEXP n, SEXP directed) {
-  igraph_t c_graph;
+  igraph_t* c_graph;
   igraph_integer_t c_n;
   igraph_bool_t c_directed;
   SEXP graph;
@@ -219,13 +421,14 @@ SEXP R_igraph_empty2(SEXP n, SEXP directed) {
   c_n=INTEGER(n)[0];
   c_directed=LOGICAL(directed)[0];
                                         /* Call igraph */
-  igraph_empty(&c_graph, c_n, c_directed);
+  c_graph = new igraph_t{};
+  if (igraph_empty(c_graph, c_n, c_directed) != IGRAPH_SUCCESS) {
+    delete c_graph;
+    R_igraph_error();
+  }
 
                                         /* Convert output */
-  IGRAPH_FINALLY(igraph_destroy, &c_graph);
-  PROTECT(graph=R_igraph_to_SEXP(&c_graph));
-  igraph_destroy(&c_graph);
-  IGRAPH_FINALLY_CLEAN(1);
+  PROTECT(graph=R_igraph_to_SEXP_view(c_graph));
   r_result = graph;
 
   UNPROTECT(1);
@@ -244,11 +447,15 @@ SEXP R_igraph_empty(SEXP n, SEXP directed) {
   c_directed=LOGICAL(directed)[0];
                                         /* Call igraph */
   c_graph = new igraph_t{};
-  igraph_empty(c_graph, c_n, c_directed);
+  if (igraph_empty(c_graph, c_n, c_directed) != IGRAPH_SUCCESS) {
+    delete c_graph;
+    R_igraph_error();
+  }
 
-  graph = create_graph(c_graph);
+  PROTECT(graph = wrap_graph(create_graph(c_graph)));
   SET_CLASS(graph, ScalarString(CREATE_STRING_VECTOR("igraph2")));
 
+  UNPROTECT(1);
   return graph;
 }
 
@@ -259,8 +466,7 @@ SEXP R_igraph_vcount(SEXP graph) {
 
   c_result = igraph_vcount(c_graph);
 
-  PROTECT(r_result=NEW_INTEGER(1));
-  INTEGER(r_result)[0]=c_result;
+  PROTECT(r_result=R_igraph_integer_to_SEXP(c_result));
 
   UNPROTECT(1);
   return(r_result);
@@ -278,13 +484,467 @@ SEXP R_igraph_vcount2(SEXP graph) {
 
                                         /* Convert output */
 
-  PROTECT(r_result=NEW_INTEGER(1));
-  INTEGER(r_result)[0]=c_result;
+  PROTECT(r_result=R_igraph_integer_to_SEXP(c_result));
 
   UNPROTECT(1);
   return(r_result);
 }
 
+// In-place modification of graph handles, see mutable_graph_handle(). The
+// entry points return the handle that was modified; it is protected here and
+// the caller must unprotect it.
+static SEXP R_igraph_mutable(SEXP graph, igraph_t **c_graph) {
+  SEXP res = PROTECT(mutable_graph_handle(graph, c_graph));
+  if (!*c_graph) {
+    error("In-place modification needs a graph handle.");
+  }
+  return res;
+}
+
+SEXP R_igraph_add_edges(SEXP graph, SEXP edges) {
+                                        /* Declarations */
+  igraph_t *c_graph;
+  igraph_vector_int_t c_edges;
+                                        /* Convert input */
+  graph=R_igraph_mutable(graph, &c_graph);
+  R_SEXP_to_vector(edges, &c_edges);
+                                        /* Call igraph */
+  R_igraph_check(igraph_add_edges(c_graph, &c_edges, 0));
+
+  UNPROTECT(1);
+  return graph;
+}
+
+SEXP R_igraph_add_vertices(SEXP graph, SEXP nv) {
+                                        /* Declarations */
+  igraph_t *c_graph;
+  igraph_integer_t c_nv;
+                                        /* Convert input */
+  graph=R_igraph_mutable(graph, &c_graph);
+  c_nv=R_SEXP_to_integer(nv);
+                                        /* Call igraph */
+  R_igraph_check(igraph_add_vertices(c_graph, c_nv, 0));
+
+  UNPROTECT(1);
+  return graph;
+}
+
+SEXP R_igraph_delete_edges(SEXP graph, SEXP edges) {
+                                        /* Declarations */
+  igraph_t *c_graph;
+  igraph_vector_int_t c_edges;
+                                        /* Convert input */
+  graph=R_igraph_mutable(graph, &c_graph);
+  R_SEXP_to_vector(edges, &c_edges);
+                                        /* Call igraph */
+  R_igraph_check(igraph_delete_edges(c_graph, igraph_ess_vector(&c_edges)));
+
+  UNPROTECT(1);
+  return graph;
+}
+
+// Batch queries: answer many lookups against one graph in a single call.
+// Vertex and edge ids are 1-based on the R side and converted here.
+
+enum batch_query_t {
+  BATCH_QUERY_DEGREE = 1,
+  BATCH_QUERY_NEIGHBORS,
+  BATCH_QUERY_EDGE_ID,
+  BATCH_QUERY_STRENGTH
+};
+
+// Validates before allocating, R errors must not leak igraph memory.
+static void R_SEXP_to_vids(SEXP ids, igraph_integer_t no_of_nodes, igraph_vector_int_t *res) {
+  R_xlen_t size = XLENGTH(ids);
+  const double *values = REAL_RO(ids);
+  R_xlen_t i;
+
+  for (i = 0; i < size; i++) {
+    if (ISNAN(values[i]) || values[i] < 1 || values[i] > no_of_nodes) {
+      error("Invalid vertex id at position %ld.", (long) i + 1);
+    }
+  }
+  igraph_vector_int_init(res, size);
+  for (i = 0; i < size; i++) {
+    VECTOR(*res)[i] = (igraph_integer_t) values[i] - 1;
+  }
+}
+
+// Vertex names are looked up in the "name" vertex attribute through a hash
+// index that is kept with the attributes. A name that several vertices share
+// refers to the first of them.
+static void R_SEXP_names_to_vids(const igraph_t *graph, SEXP ids, igraph_vector_int_t *res) {
+  SEXP names = R_igraph_attribute_get(graph, ATTRIBUTE_VERTEX, "name");
+  R_xlen_t size = XLENGTH(ids), i;
+  const R_igraph_vertex_names_t *lookup;
+  igraph_integer_t id;
+
+  if (TYPEOF(names) != STRSXP) {
+    error("Vertex names need a character \"name\" vertex attribute.");
+  }
+  R_igraph_check(R_igraph_attribute_vertex_names(graph, &lookup));
+
+  R_igraph_check(igraph_vector_int_init(res, size));
+  IGRAPH_FINALLY(igraph_vector_int_destroy, res);
+  const void *vmax = vmaxget();
+  for (i = 0; i < size; i++) {
+    id = -1;
+    if (STRING_ELT(ids, i) != NA_STRING) {
+      id = igraph_i_name_index_find(&lookup->index, translateCharUTF8(STRING_ELT(ids, i)));
+      vmaxset(vmax);
+    }
+    if (id < 0) {
+      error("Unknown vertex name at position %ld.", (long) i + 1);
+    }
+    VECTOR(*res)[i] = VECTOR(lookup->vertex)[id];
+  }
+  IGRAPH_FINALLY_CLEAN(1);
+}
+
+SEXP R_igraph_batch_query(SEXP graph, SEXP pkind, SEXP ids, SEXP pmode) {
+  return R_igraph_protect([&]() -> SEXP {
+    igraph_t tmp;
+    igraph_t *c_graph = R_igraph_graph(graph, &tmp);
+    int kind = INTEGER(pkind)[0];
+    igraph_neimode_t mode = (igraph_neimode_t) INTEGER(pmode)[0];
+    igraph_vector_int_t vids, res;
+    SEXP result = R_NilValue;
+    R_xlen_t i, j;
+
+    if (kind == BATCH_QUERY_EDGE_ID && XLENGTH(ids) % 2 != 0) {
+      error("Vertex pairs must have an even number of elements.");
+    }
+
+    if (TYPEOF(ids) == STRSXP) {
+      R_SEXP_names_to_vids(c_graph, ids, &vids);
+    } else {
+      R_SEXP_to_vids(ids, igraph_vcount(c_graph), &vids);
+    }
+    IGRAPH_FINALLY(igraph_vector_int_destroy, &vids);
+    igraph_vector_int_init(&res, 0);
+    IGRAPH_FINALLY(igraph_vector_int_destroy, &res);
+
+    switch (kind) {
+      case BATCH_QUERY_DEGREE:
+        R_igraph_check(igraph_degree(c_graph, &res, igraph_vss_vector(&vids), mode, true));
+        PROTECT(result = R_igraph_vector_int_to_SEXP(&res));
+        break;
+
+      case BATCH_QUERY_NEIGHBORS:
+        PROTECT(result = NEW_LIST(igraph_vector_int_size(&vids)));
+        for (i = 0; i < igraph_vector_int_size(&vids); i++) {
+          R_igraph_check(igraph_neighbors(c_graph, &res, VECTOR(vids)[i], mode));
+          SEXP neis = allocVector(R_IGRAPH_INT_SXP, igraph_vector_int_size(&res));
+          SET_VECTOR_ELT(result, i, neis);
+          auto *values = static_cast<r_igraph_int_t*>(DATAPTR(neis));
+          for (j = 0; j < igraph_vector_int_size(&res); j++) {
+            values[j] = VECTOR(res)[j] + 1;
+          }
+        }
+        break;
+
+      case BATCH_QUERY_EDGE_ID:
+        R_igraph_check(igraph_get_eids(c_graph, &res, &vids, mode != IGRAPH_ALL, false));
+        PROTECT(result = allocVector(R_IGRAPH_INT_SXP, igraph_vector_int_size(&res)));
+        for (i = 0; i < igraph_vector_int_size(&res); i++) {
+          static_cast<r_igraph_int_t*>(DATAPTR(result))[i] =
+            VECTOR(res)[i] < 0 ? R_IGRAPH_INT_NA : VECTOR(res)[i] + 1;
+        }
+        break;
+
+      case BATCH_QUERY_STRENGTH: {
+        // Weights come from the "weight" edge attribute without a copy
+        igraph_vector_t weights, strength;
+        bool weighted = R_igraph_attribute_weights(c_graph, "weight", &weights);
+        igraph_vector_init(&strength, 0);
+        IGRAPH_FINALLY(igraph_vector_destroy, &strength);
+        R_igraph_check(igraph_strength(c_graph, &strength, igraph_vss_vector(&vids), mode, true,
+                                       weighted ? &weights : NULL));
+        PROTECT(result = NEW_NUMERIC(igraph_vector_size(&strength)));
+        igraph_vector_copy_to(&strength, REAL(result));
+        igraph_vector_destroy(&strength);
+        IGRAPH_FINALLY_CLEAN(1);
+        break;
+      }
+
+      default:
+        error("Unknown batch query kind: %d.", kind);
+    }
+
+    igraph_vector_int_destroy(&res);
+    igraph_vector_int_destroy(&vids);
+    IGRAPH_FINALLY_CLEAN(2);
+
+    UNPROTECT(1);
+    return result;
+  });
+}
+
+// Attributes of graph handles, which is one of the attribute_list_t values.
+// List form graphs have none.
+
+static int R_igraph_attr_which(SEXP pwhich) {
+  int which = INTEGER(pwhich)[0];
+  if (which < ATTRIBUTE_GRAPH || which > ATTRIBUTE_EDGE) {
+    error("Unknown attribute kind: %d.", which);
+  }
+  return which;
+}
+
+SEXP R_igraph_get_attr(SEXP graph, SEXP pwhich, SEXP name) {
+  igraph_t *c_graph = graph_handle(graph);
+  int which = R_igraph_attr_which(pwhich);
+  return c_graph ? R_igraph_attribute_get(c_graph, which, CHAR(STRING_ELT(name, 0))) : R_NilValue;
+}
+
+SEXP R_igraph_set_attr(SEXP graph, SEXP pwhich, SEXP name, SEXP value) {
+  igraph_t *c_graph;
+  graph = R_igraph_mutable(graph, &c_graph);
+  R_igraph_attribute_set(c_graph, R_igraph_attr_which(pwhich), CHAR(STRING_ELT(name, 0)), value);
+  UNPROTECT(1);
+  return graph;
+}
+
+SEXP R_igraph_attr_names(SEXP graph, SEXP pwhich) {
+  igraph_t *c_graph = graph_handle(graph);
+  int which = R_igraph_attr_which(pwhich);
+  SEXP list = c_graph ? R_igraph_attribute_list(c_graph) : R_NilValue;
+  if (isNull(list)) {
+    return NEW_CHARACTER(0);
+  }
+  return getAttrib(VECTOR_ELT(list, which), R_NamesSymbol);
+}
+
+// Read-only CSR snapshots, see igraph_csr_init(). A snapshot is an external
+// pointer of class "igraph2_snapshot" and does not survive serialization.
+
+static void R_igraph_csr_finalizer(SEXP xp) {
+  auto *csr = static_cast<igraph_csr_t*>(R_ExternalPtrAddr(xp));
+  if (csr) {
+    igraph_csr_destroy(csr);
+    delete csr;
+    R_ClearExternalPtr(xp);
+  }
+}
+
+static void R_igraph_csr_delete(igraph_csr_t *csr) {
+  delete csr;
+}
+
+static igraph_csr_t *R_igraph_csr(SEXP snapshot) {
+  igraph_csr_t *csr = nullptr;
+  if (TYPEOF(snapshot) == EXTPTRSXP) {
+    csr = static_cast<igraph_csr_t*>(R_ExternalPtrAddr(snapshot));
+  }
+  if (!csr) {
+    error("Invalid graph snapshot, it has to be created again with freeze_graph().");
+  }
+  return csr;
+}
+
+SEXP R_igraph_freeze(SEXP graph, SEXP pweighted) {
+  return R_igraph_protect([&]() -> SEXP {
+    igraph_t tmp;
+    igraph_t *c_graph = R_igraph_graph(graph, &tmp);
+    igraph_vector_t weights;
+    bool weighted = LOGICAL(pweighted)[0] &&
+      R_igraph_attribute_weights(c_graph, "weight", &weights);
+    auto *csr = new igraph_csr_t;
+
+    IGRAPH_FINALLY(R_igraph_csr_delete, csr);
+    R_igraph_check(igraph_csr_init(c_graph, csr, weighted ? &weights : NULL));
+    IGRAPH_FINALLY_CLEAN(1);
+
+    SEXP xp = PROTECT(R_MakeExternalPtr(csr, R_NilValue, R_NilValue));
+    R_RegisterCFinalizerEx(xp, R_igraph_csr_finalizer, TRUE);
+    setAttrib(xp, R_ClassSymbol, mkString("igraph2_snapshot"));
+    setAttrib(xp, install("bytes"), ScalarReal((double) igraph_csr_size(csr)));
+
+    UNPROTECT(1);
+    return xp;
+  });
+}
+
+enum snapshot_query_t {
+  SNAPSHOT_QUERY_BFS = 1,
+  SNAPSHOT_QUERY_DIJKSTRA,
+  SNAPSHOT_QUERY_PAGERANK,
+  SNAPSHOT_QUERY_COMPONENTS
+};
+
+SEXP R_igraph_snapshot_query(SEXP snapshot, SEXP pkind, SEXP proot, SEXP pmode, SEXP pdamping) {
+  return R_igraph_protect([&]() -> SEXP {
+    igraph_csr_t *csr = R_igraph_csr(snapshot);
+    int kind = INTEGER(pkind)[0];
+    igraph_integer_t root = (igraph_integer_t) REAL(proot)[0] - 1;
+    igraph_neimode_t mode = (igraph_neimode_t) INTEGER(pmode)[0];
+    igraph_vector_int_t ires;
+    igraph_vector_t res;
+    SEXP result = R_NilValue;
+
+    igraph_vector_int_init(&ires, 0);
+    IGRAPH_FINALLY(igraph_vector_int_destroy, &ires);
+    igraph_vector_init(&res, 0);
+    IGRAPH_FINALLY(igraph_vector_destroy, &res);
+
+    switch (kind) {
+      case SNAPSHOT_QUERY_BFS:
+        R_igraph_check(igraph_csr_bfs(csr, root, mode, &ires));
+        PROTECT(result = NEW_NUMERIC(igraph_vector_int_size(&ires)));
+        for (R_xlen_t i = 0; i < XLENGTH(result); i++) {
+          REAL(result)[i] = VECTOR(ires)[i] < 0 ? R_PosInf : VECTOR(ires)[i];
+        }
+        break;
+
+      case SNAPSHOT_QUERY_DIJKSTRA:
+        R_igraph_check(igraph_csr_dijkstra(csr, root, mode, &res));
+        PROTECT(result = NEW_NUMERIC(igraph_vector_size(&res)));
+        igraph_vector_copy_to(&res, REAL(result));
+        break;
+
+      case SNAPSHOT_QUERY_PAGERANK:
+        R_igraph_check(igraph_csr_pagerank(csr, REAL(pdamping)[0], &res));
+        PROTECT(result = NEW_NUMERIC(igraph_vector_size(&res)));
+        igraph_vector_copy_to(&res, REAL(result));
+        break;
+
+      case SNAPSHOT_QUERY_COMPONENTS:
+        R_igraph_check(igraph_csr_components(csr, &ires, NULL));
+        PROTECT(result = allocVector(R_IGRAPH_INT_SXP, igraph_vector_int_size(&ires)));
+        for (R_xlen_t i = 0; i < XLENGTH(result); i++) {
+          static_cast<r_igraph_int_t*>(DATAPTR(result))[i] = VECTOR(ires)[i] + 1;
+        }
+        break;
+
+      default:
+        error("Unknown snapshot query kind: %d.", kind);
+    }
+
+    igraph_vector_destroy(&res);
+    igraph_vector_int_destroy(&ires);
+    IGRAPH_FINALLY_CLEAN(2);
+
+    UNPROTECT(1);
+    return result;
+  });
+}
+
+// Enumerations with many short results. They fill a ragged array, see
+// igraph_ragged_int_t, which becomes two vectors: the 1-based vertex ids of
+// all results and the offsets at which the results start.
+
+enum enumerate_t {
+  ENUMERATE_MAXIMAL_CLIQUES = 1,
+  ENUMERATE_SIMPLE_PATHS,
+  ENUMERATE_SHORTEST_PATHS
+};
+
+SEXP R_igraph_enumerate(SEXP graph, SEXP pkind, SEXP pfrom, SEXP pmode, SEXP pmin, SEXP pmax) {
+  return R_igraph_protect([&]() -> SEXP {
+    igraph_t tmp;
+    igraph_t *c_graph = R_igraph_graph(graph, &tmp);
+    int kind = INTEGER(pkind)[0];
+    double from = REAL(pfrom)[0];
+    igraph_neimode_t mode = (igraph_neimode_t) INTEGER(pmode)[0];
+    igraph_integer_t min_size = (igraph_integer_t) REAL(pmin)[0];
+    igraph_integer_t max_size = (igraph_integer_t) REAL(pmax)[0];
+    igraph_ragged_int_t res;
+    SEXP result, names, values;
+
+    if (kind != ENUMERATE_MAXIMAL_CLIQUES &&
+        (ISNAN(from) || from < 1 || from > igraph_vcount(c_graph))) {
+      error("Invalid vertex id: %g.", from);
+    }
+
+    R_igraph_check(igraph_ragged_int_init(&res));
+    IGRAPH_FINALLY(igraph_ragged_int_destroy, &res);
+
+    switch (kind) {
+      case ENUMERATE_MAXIMAL_CLIQUES:
+        R_igraph_check(igraph_maximal_cliques_ragged(c_graph, &res, min_size, max_size));
+        break;
+
+      case ENUMERATE_SIMPLE_PATHS:
+        R_igraph_check(igraph_get_all_simple_paths_ragged(c_graph, &res, (igraph_integer_t) from - 1,
+                                                          igraph_vss_all(),
+                                                          max_size > 0 ? max_size : -1, mode));
+        break;
+
+      case ENUMERATE_SHORTEST_PATHS:
+        R_igraph_check(igraph_get_all_shortest_paths_ragged(c_graph, &res, NULL, NULL,
+                                                            (igraph_integer_t) from - 1,
+                                                            igraph_vss_all(), mode));
+        break;
+
+      default:
+        error("Unknown enumeration kind: %d.", kind);
+    }
+
+    PROTECT(result = NEW_LIST(2));
+    PROTECT(names = NEW_CHARACTER(2));
+    values = allocVector(R_IGRAPH_INT_SXP, igraph_vector_int_size(&res.values));
+    SET_VECTOR_ELT(result, 0, values);
+    auto *v = static_cast<r_igraph_int_t*>(DATAPTR(values));
+    for (R_xlen_t i = 0; i < XLENGTH(values); i++) {
+      v[i] = VECTOR(res.values)[i] + 1;
+    }
+    SET_VECTOR_ELT(result, 1, R_igraph_vector_int_to_SEXP(&res.offsets));
+    SET_STRING_ELT(names, 0, mkChar("values"));
+    SET_STRING_ELT(names, 1, mkChar("offsets"));
+    SET_NAMES(result, names);
+
+    igraph_ragged_int_destroy(&res);
+    IGRAPH_FINALLY_CLEAN(1);
+
+    UNPROTECT(2);
+    return result;
+  });
+}
+
+// Memory budget of the derived structures each graph may cache, see
+// igraph_set_property_cache_budget(). Returns the previous budget.
+SEXP R_igraph_cache_budget(SEXP pbytes) {
+  double previous = (double) igraph_property_cache_budget();
+  if (!isNull(pbytes)) {
+    double bytes = REAL(pbytes)[0];
+    if (ISNAN(bytes) || bytes < 0) {
+      error("The cache budget must be a non-negative number of bytes.");
+    }
+    igraph_set_property_cache_budget(bytes > (double) SIZE_MAX ? SIZE_MAX : (size_t) bytes);
+  }
+  return ScalarReal(previous);
+}
+
+// Memory used by the cached derived structures of a graph, see
+// igraph_property_cache_size(). List form graphs have no cache.
+SEXP R_igraph_cache_size(SEXP graph) {
+  igraph_t *c_graph = graph_handle(graph);
+  return ScalarReal(c_graph ? (double) igraph_property_cache_size(c_graph) : 0.0);
+}
+
+// Allocation arenas, see igraph_arena_begin(). with_arena() pairs the calls.
+SEXP R_igraph_arena_begin(void) {
+  R_igraph_check(igraph_arena_begin());
+  return R_NilValue;
+}
+
+SEXP R_igraph_arena_end(void) {
+  igraph_arena_stats_t stats;
+  igraph_arena_end(&stats);
+
+  SEXP result = PROTECT(NEW_NUMERIC(5));
+  SEXP names = PROTECT(NEW_CHARACTER(5));
+  const char *fields[] = { "allocations", "frees", "bytes", "live", "peak" };
+  const size_t values[] = { stats.allocations, stats.frees, stats.bytes, stats.live, stats.peak };
+  for (int i = 0; i < 5; i++) {
+    REAL(result)[i] = (double) values[i];
+    SET_STRING_ELT(names, i, mkChar(fields[i]));
+  }
+  SET_NAMES(result, names);
+  UNPROTECT(2);
+  return result;
+}
+
 static const R_CallMethodDef CallEntries[] = {
     {"R_igraph2_warning", (DL_FUNC) &R_igraph2_warning, 0},
     {"R_igraph_empty", (DL_FUNC) &R_igraph_empty, 2},
@@ -295,6 +955,21 @@ static const R_CallMethodDef CallEntries[] = {
     {"R_igraph_vcount2", (DL_FUNC) &R_igraph_vcount2, 1},
     {"R_igraph_create", (DL_FUNC) &R_igraph_create, 3},
     {"R_igraph_get_edgelist", (DL_FUNC) &R_igraph_get_edgelist, 2},
+    {"R_igraph_batch_query", (DL_FUNC) &R_igraph_batch_query, 4},
+    {"R_igraph_graph_env", (DL_FUNC) &R_igraph_graph_env, 1},
+    {"R_igraph_add_edges", (DL_FUNC) &R_igraph_add_edges, 2},
+    {"R_igraph_add_vertices", (DL_FUNC) &R_igraph_add_vertices, 2},
+    {"R_igraph_delete_edges", (DL_FUNC) &R_igraph_delete_edges, 2},
+    {"R_igraph_get_attr", (DL_FUNC) &R_igraph_get_attr, 3},
+    {"R_igraph_set_attr", (DL_FUNC) &R_igraph_set_attr, 4},
+    {"R_igraph_attr_names", (DL_FUNC) &R_igraph_attr_names, 2},
+    {"R_igraph_freeze", (DL_FUNC) &R_igraph_freeze, 2},
+    {"R_igraph_snapshot_query", (DL_FUNC) &R_igraph_snapshot_query, 5},
+    {"R_igraph_enumerate", (DL_FUNC) &R_igraph_enumerate, 6},
+    {"R_igraph_cache_budget", (DL_FUNC) &R_igraph_cache_budget, 1},
+    {"R_igraph_cache_size", (DL_FUNC) &R_igraph_cache_size, 1},
+    {"R_igraph_arena_begin", (DL_FUNC) &R_igraph_arena_begin, 0},
+    {"R_igraph_arena_end", (DL_FUNC) &R_igraph_arena_end, 0},
 
     {NULL, NULL, 0}
 };
@@ -302,4 +977,12 @@ static const R_CallMethodDef CallEntries[] = {
 extern "C" void attribute_visible R_init_igraph2(DllInfo *dll) {
   R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
   R_useDynamicSymbols(dll, FALSE);
+
+  igraph_set_error_handler(R_igraph_error_handler);
+  igraph_set_attribute_table(&R_igraph_attribute_table);
+  R_igraph_attribute_setup();
+
+  register_graph(dll, "igraph2_graph", "igraph2");
+  register_index_view(dll, "igraph2_index", "igraph2");
+  register_edgelist_view(dll, "igraph2_edgelist", "igraph2");
 }
\ No newline at end of file
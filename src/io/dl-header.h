@@ -23,7 +23,7 @@
 #include "igraph_error.h"
 #include "igraph_types.h"
 
-#include "core/trie.h"
+#include "core/name_index.h"
 
 /* TODO: Find out maximum supported vertex count. */
 #ifdef FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION
@@ -48,6 +48,6 @@ typedef struct {
     igraph_vector_int_t edges;
     igraph_vector_t weights;
     igraph_strvector_t labels;
-    igraph_trie_t trie;
+    igraph_i_name_index_t name_index;
     igraph_i_dl_type_t type;
 } igraph_i_dl_parsedata_t;
@@ -87,7 +87,7 @@ igraph_error_t igraph_read_graph_dl(igraph_t *graph, FILE *instream,
     IGRAPH_VECTOR_INIT_FINALLY(&context.weights, 0);
     IGRAPH_CHECK(igraph_strvector_init(&context.labels, 0));
     IGRAPH_FINALLY(igraph_strvector_destroy, &context.labels);
-    IGRAPH_TRIE_INIT_FINALLY(&context.trie, /*names=*/ 1);
+    IGRAPH_I_NAME_INDEX_INIT_FINALLY(&context.name_index);
 
     igraph_dl_yylex_init_extra(&context, &context.scanner);
     IGRAPH_FINALLY(igraph_dl_yylex_destroy_wrapper, context.scanner);
@@ -148,8 +148,8 @@ igraph_error_t igraph_read_graph_dl(igraph_t *graph, FILE *instream,
     /* Labels */
     if (igraph_strvector_size(&context.labels) != 0) {
         namevec = (const igraph_strvector_t*) &context.labels;
-    } else if (igraph_trie_size(&context.trie) != 0) {
-        namevec = igraph_i_trie_borrow_keys(&context.trie);
+    } else if (igraph_i_name_index_size(&context.name_index) != 0) {
+        namevec = igraph_i_name_index_names(&context.name_index);
     }
     if (namevec) {
         IGRAPH_CHECK(igraph_vector_ptr_init(&name, 1));
@@ -191,7 +191,7 @@ igraph_error_t igraph_read_graph_dl(igraph_t *graph, FILE *instream,
     /* don't destroy the graph itself but pop it from the finally stack */
     IGRAPH_FINALLY_CLEAN(1);
 
-    igraph_trie_destroy(&context.trie);
+    igraph_i_name_index_destroy(&context.name_index);
     igraph_strvector_destroy(&context.labels);
     igraph_vector_int_destroy(&context.edges);
     igraph_vector_destroy(&context.weights);
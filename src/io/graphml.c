@@ -28,6 +28,7 @@
 #include "igraph_memory.h"
 
 #include "core/interruption.h"
+#include "core/name_index.h"
 #include "core/trie.h"
 #include "graph/attributes.h"
 #include "internal/hacks.h" /* strcasecmp & strdup */
@@ -109,7 +110,7 @@ typedef enum {
 struct igraph_i_graphml_parser_state {
     igraph_i_graphml_parser_state_index_t st;
     igraph_t *g;
-    igraph_trie_t node_trie;
+    igraph_i_name_index_t node_ids;
     igraph_strvector_t edgeids;
     igraph_vector_int_t edgelist;
     igraph_vector_int_t prev_state_stack;
@@ -270,8 +271,7 @@ static igraph_error_t igraph_i_graphml_parser_state_init(struct igraph_i_graphml
     IGRAPH_CHECK(igraph_vector_int_init(&state->edgelist, 0));
     IGRAPH_FINALLY(igraph_vector_int_destroy, &state->edgelist);
 
-    IGRAPH_CHECK(igraph_trie_init(&state->node_trie, 1));
-    IGRAPH_FINALLY(igraph_trie_destroy, &state->node_trie);
+    IGRAPH_I_NAME_INDEX_INIT_FINALLY(&state->node_ids);
 
     IGRAPH_CHECK(igraph_strvector_init(&state->edgeids, 0));
     IGRAPH_FINALLY(igraph_strvector_destroy, &state->edgeids);
@@ -290,7 +290,7 @@ static igraph_error_t igraph_i_graphml_parser_state_init(struct igraph_i_graphml
 }
 
 static void igraph_i_graphml_parser_state_destroy(struct igraph_i_graphml_parser_state* state) {
-    igraph_trie_destroy(&state->node_trie);
+    igraph_i_name_index_destroy(&state->node_ids);
     igraph_strvector_destroy(&state->edgeids);
     igraph_trie_destroy(&state->v_names);
     igraph_trie_destroy(&state->e_names);
@@ -450,7 +450,7 @@ static igraph_error_t igraph_i_graphml_parser_state_finish_parsing(struct igraph
         if (rec->type == IGRAPH_ATTRIBUTE_NUMERIC) {
             igraph_vector_t *vec = (igraph_vector_t*)rec->value;
             igraph_integer_t origsize = igraph_vector_size(vec);
-            igraph_integer_t nodes = igraph_trie_size(&state->node_trie);
+            igraph_integer_t nodes = igraph_i_name_index_size(&state->node_ids);
             IGRAPH_CHECK(igraph_vector_resize(vec, nodes));
             for (l = origsize; l < nodes; l++) {
                 VECTOR(*vec)[l] = graphmlrec->default_value.as_numeric;
@@ -458,7 +458,7 @@ static igraph_error_t igraph_i_graphml_parser_state_finish_parsing(struct igraph
         } else if (rec->type == IGRAPH_ATTRIBUTE_STRING) {
             igraph_strvector_t *strvec = (igraph_strvector_t*)rec->value;
             igraph_integer_t origsize = igraph_strvector_size(strvec);
-            igraph_integer_t nodes = igraph_trie_size(&state->node_trie);
+            igraph_integer_t nodes = igraph_i_name_index_size(&state->node_ids);
             IGRAPH_CHECK(igraph_strvector_resize(strvec, nodes));
             for (l = origsize; l < nodes; l++) {
                 IGRAPH_CHECK(igraph_strvector_set(strvec, l, graphmlrec->default_value.as_string));
@@ -466,7 +466,7 @@ static igraph_error_t igraph_i_graphml_parser_state_finish_parsing(struct igraph
         } else if (rec->type == IGRAPH_ATTRIBUTE_BOOLEAN) {
             igraph_vector_bool_t *boolvec = (igraph_vector_bool_t*)rec->value;
             igraph_integer_t origsize = igraph_vector_bool_size(boolvec);
-            igraph_integer_t nodes = igraph_trie_size(&state->node_trie);
+            igraph_integer_t nodes = igraph_i_name_index_size(&state->node_ids);
             IGRAPH_CHECK(igraph_vector_bool_resize(boolvec, nodes));
             for (l = origsize; l < nodes; l++) {
                 VECTOR(*boolvec)[l] = graphmlrec->default_value.as_boolean;
@@ -479,7 +479,7 @@ static igraph_error_t igraph_i_graphml_parser_state_finish_parsing(struct igraph
     if (!already_has_vertex_id) {
         idrec.name = idstr;
         idrec.type = IGRAPH_ATTRIBUTE_STRING;
-        idrec.value = igraph_i_trie_borrow_keys(&state->node_trie);
+        idrec.value = igraph_i_name_index_names(&state->node_ids);
         igraph_vector_ptr_push_back(&vattr, &idrec); /* reserved */
     } else {
         IGRAPH_WARNING("Could not add vertex ids, there is already an 'id' vertex attribute.");
@@ -572,7 +572,7 @@ static igraph_error_t igraph_i_graphml_parser_state_finish_parsing(struct igraph
 
     IGRAPH_CHECK(igraph_empty_attrs(state->g, 0, state->edges_directed, &gattr));
     IGRAPH_FINALLY(igraph_destroy, state->g); /* because the next two lines may fail as well */
-    IGRAPH_CHECK(igraph_add_vertices(state->g, igraph_trie_size(&state->node_trie), &vattr));
+    IGRAPH_CHECK(igraph_add_vertices(state->g, igraph_i_name_index_size(&state->node_ids), &vattr));
     IGRAPH_CHECK(igraph_add_edges(state->g, &state->edgelist, &eattr));
     IGRAPH_FINALLY_CLEAN(1); /* graph construction completed successfully */
 
@@ -809,7 +809,9 @@ static igraph_error_t igraph_i_graphml_add_attribute_key(
             IGRAPH_ERROR("Cannot allocate value vector for string attribute.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
         }
         IGRAPH_FINALLY(igraph_free, strvec);
-        IGRAPH_CHECK(igraph_strvector_init(strvec, 0));
+        /* Values of string attributes are often repeated across vertices
+         * or edges, store each one only once */
+        IGRAPH_CHECK(igraph_strvector_init_interned(strvec, 0));
         rec->record.value = strvec;
         IGRAPH_FINALLY_CLEAN(1);
         break;
@@ -1173,27 +1175,13 @@ static igraph_error_t igraph_i_graphml_sax_handler_start_element_ns_inner(
                     continue;
                 }
                 if (xmlStrEqual(*it, toXmlChar("source"))) {
-                    attr_value = xmlStrndup(XML_ATTR_VALUE(it));
-                    if (attr_value == 0) {
-                        IGRAPH_ERROR("Cannot copy value of edge source attribute.", IGRAPH_ENOMEM);
-                    }
-                    IGRAPH_FINALLY(xmlFree, attr_value);
-
-                    IGRAPH_CHECK(igraph_trie_get(&state->node_trie, fromXmlChar(attr_value), &id1));
-
-                    xmlFree(attr_value); attr_value = NULL;
-                    IGRAPH_FINALLY_CLEAN(1);
+                    IGRAPH_CHECK(igraph_i_name_index_get_len(
+                        &state->node_ids, fromXmlChar(XML_ATTR_VALUE_START(it)),
+                        XML_ATTR_VALUE_END(it) - XML_ATTR_VALUE_START(it), &id1));
                 } else if (xmlStrEqual(*it, toXmlChar("target"))) {
-                    attr_value = xmlStrndup(XML_ATTR_VALUE(it));
-                    if (attr_value == 0) {
-                        IGRAPH_ERROR("Cannot copy value of edge target attribute.", IGRAPH_ENOMEM);
-                    }
-                    IGRAPH_FINALLY(xmlFree, attr_value);
-
-                    IGRAPH_CHECK(igraph_trie_get(&state->node_trie, fromXmlChar(attr_value), &id2));
-
-                    xmlFree(attr_value); attr_value = NULL;
-                    IGRAPH_FINALLY_CLEAN(1);
+                    IGRAPH_CHECK(igraph_i_name_index_get_len(
+                        &state->node_ids, fromXmlChar(XML_ATTR_VALUE_START(it)),
+                        XML_ATTR_VALUE_END(it) - XML_ATTR_VALUE_START(it), &id2));
                 } else if (xmlStrEqual(*it, toXmlChar("id"))) {
                     igraph_integer_t edges = igraph_vector_int_size(&state->edgelist) / 2 + 1;
                     igraph_integer_t origsize = igraph_strvector_size(&state->edgeids);
@@ -1232,16 +1220,9 @@ static igraph_error_t igraph_i_graphml_sax_handler_start_element_ns_inner(
                     continue;
                 }
                 if (xmlStrEqual(XML_ATTR_LOCALNAME(it), toXmlChar("id"))) {
-                    attr_value = xmlStrndup(XML_ATTR_VALUE(it));
-                    if (attr_value == 0) {
-                        IGRAPH_ERROR("Cannot copy value of node ID attribute.", IGRAPH_ENOMEM);
-                    }
-                    IGRAPH_FINALLY(xmlFree, attr_value);
-
-                    IGRAPH_CHECK(igraph_trie_get(&state->node_trie, fromXmlChar(attr_value), &id1));
-
-                    xmlFree(attr_value); attr_value = NULL;
-                    IGRAPH_FINALLY_CLEAN(1);
+                    IGRAPH_CHECK(igraph_i_name_index_get_len(
+                        &state->node_ids, fromXmlChar(XML_ATTR_VALUE_START(it)),
+                        XML_ATTR_VALUE_END(it) - XML_ATTR_VALUE_START(it), &id1));
                     break;
                 }
             }
@@ -92,7 +92,7 @@ vertex3name [optionalWeight] \endverbatim
  *         incorrect.
  *
  * Time complexity:
- * O(|V|+|E|log(|V|)) if we neglect
+ * O(|V|+|E|) expected, if we neglect
  * the time required by the parsing. As usual
  * |V| is the number of vertices,
  * while |E| is the number of edges.
@@ -108,7 +108,7 @@ igraph_error_t igraph_read_graph_lgl(igraph_t *graph, FILE *instream,
 
     igraph_vector_int_t edges = IGRAPH_VECTOR_NULL;
     igraph_vector_t ws = IGRAPH_VECTOR_NULL;
-    igraph_trie_t trie = IGRAPH_TRIE_NULL;
+    igraph_i_name_index_t name_index;
     igraph_vector_ptr_t name, weight;
     igraph_vector_ptr_t *pname = 0, *pweight = 0;
     igraph_attribute_record_t namerec, weightrec;
@@ -117,12 +117,12 @@ igraph_error_t igraph_read_graph_lgl(igraph_t *graph, FILE *instream,
 
     IGRAPH_VECTOR_INIT_FINALLY(&ws, 0);
     IGRAPH_VECTOR_INT_INIT_FINALLY(&edges, 0);
-    IGRAPH_TRIE_INIT_FINALLY(&trie, names);
+    IGRAPH_I_NAME_INDEX_INIT_FINALLY(&name_index);
 
     context.has_weights = 0;
     context.vector = &edges;
     context.weights = &ws;
-    context.trie = &trie;
+    context.name_index = &name_index;
     context.eof = 0;
     context.errmsg[0] = '\0';
     context.igraph_errno = IGRAPH_SUCCESS;
@@ -168,7 +168,7 @@ igraph_error_t igraph_read_graph_lgl(igraph_t *graph, FILE *instream,
         pname = &name;
         namerec.name = namestr;
         namerec.type = IGRAPH_ATTRIBUTE_STRING;
-        namerec.value = igraph_i_trie_borrow_keys(&trie);
+        namerec.value = igraph_i_name_index_names(&name_index);
         VECTOR(name)[0] = &namerec;
     }
 
@@ -186,7 +186,7 @@ igraph_error_t igraph_read_graph_lgl(igraph_t *graph, FILE *instream,
     /* Create graph */
     IGRAPH_CHECK(igraph_empty(graph, 0, directed));
     IGRAPH_FINALLY(igraph_destroy, graph);
-    IGRAPH_CHECK(igraph_add_vertices(graph, igraph_trie_size(&trie), pname));
+    IGRAPH_CHECK(igraph_add_vertices(graph, igraph_i_name_index_size(&name_index), pname));
     IGRAPH_CHECK(igraph_add_edges(graph, &edges, pweight));
 
     if (pweight) {
@@ -197,7 +197,7 @@ igraph_error_t igraph_read_graph_lgl(igraph_t *graph, FILE *instream,
         igraph_vector_ptr_destroy(pname);
         IGRAPH_FINALLY_CLEAN(1);
     }
-    igraph_trie_destroy(&trie);
+    igraph_i_name_index_destroy(&name_index);
     igraph_vector_int_destroy(&edges);
     igraph_vector_destroy(&ws);
     igraph_lgl_yylex_destroy(context.scanner);
@@ -23,7 +23,7 @@
 #include "igraph_error.h"
 #include "igraph_vector.h"
 
-#include "core/trie.h"
+#include "core/name_index.h"
 
 typedef struct {
     void *scanner;
@@ -33,5 +33,5 @@ typedef struct {
     igraph_bool_t has_weights;
     igraph_vector_int_t *vector;
     igraph_vector_t *weights;
-    igraph_trie_t *trie;
+    igraph_i_name_index_t *name_index;
 } igraph_i_ncol_parsedata_t;
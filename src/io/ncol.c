@@ -96,7 +96,7 @@ void igraph_ncol_yylex_destroy_wrapper (void *scanner ) {
  *         the file, or the file is syntactically incorrect.
  *
  * Time complexity:
- * O(|V|+|E|log(|V|)) if we neglect
+ * O(|V|+|E|) expected, if we neglect
  * the time required by the parsing. As usual
  * |V| is the number of vertices,
  * while |E| is the number of edges.
@@ -111,7 +111,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
 
     igraph_vector_int_t edges;
     igraph_vector_t ws;
-    igraph_trie_t trie = IGRAPH_TRIE_NULL;
+    igraph_i_name_index_t name_index;
     igraph_integer_t no_of_nodes;
     igraph_integer_t no_predefined = 0;
     igraph_vector_ptr_t name, weight;
@@ -122,7 +122,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
 
     IGRAPH_VECTOR_INT_INIT_FINALLY(&edges, 0);
 
-    IGRAPH_TRIE_INIT_FINALLY(&trie, names);
+    IGRAPH_I_NAME_INDEX_INIT_FINALLY(&name_index);
     IGRAPH_VECTOR_INIT_FINALLY(&ws, 0);
 
     /* Add the predefined names, if any */
@@ -132,7 +132,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
         n = no_predefined = igraph_strvector_size(predefnames);
         for (i = 0; i < n; i++) {
             key = igraph_strvector_get(predefnames, i);
-            IGRAPH_CHECK(igraph_trie_get(&trie, key, &id));
+            IGRAPH_CHECK(igraph_i_name_index_get(&name_index, key, &id));
             if (id != i) {
                 IGRAPH_WARNING("Reading NCOL file, duplicate entry in predefined names.");
                 no_predefined--;
@@ -143,7 +143,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
     context.has_weights = 0;
     context.vector = &edges;
     context.weights = &ws;
-    context.trie = &trie;
+    context.name_index = &name_index;
     context.eof = 0;
     context.errmsg[0] = '\0';
     context.igraph_errno = IGRAPH_SUCCESS;
@@ -182,7 +182,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
     }
 
     if (predefnames != 0 &&
-        igraph_trie_size(&trie) != no_predefined) {
+        igraph_i_name_index_size(&name_index) != no_predefined) {
         IGRAPH_WARNING("Unknown vertex/vertices found in NCOL file, predefined names extended.");
     }
 
@@ -194,7 +194,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
         pname = &name;
         namerec.name = namestr;
         namerec.type = IGRAPH_ATTRIBUTE_STRING;
-        namerec.value = igraph_i_trie_borrow_keys(&trie);
+        namerec.value = igraph_i_name_index_names(&name_index);
         VECTOR(name)[0] = &namerec;
     }
 
@@ -231,7 +231,7 @@ igraph_error_t igraph_read_graph_ncol(igraph_t *graph, FILE *instream,
         IGRAPH_FINALLY_CLEAN(1);
     }
     igraph_vector_destroy(&ws);
-    igraph_trie_destroy(&trie);
+    igraph_i_name_index_destroy(&name_index);
     igraph_vector_int_destroy(&edges);
     igraph_ncol_yylex_destroy(context.scanner);
     IGRAPH_FINALLY_CLEAN(5); /* +1 for 'graph' */
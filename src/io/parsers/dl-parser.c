@@ -1792,20 +1792,20 @@ yyreduce:
   case 48:
 
     {
-  igraph_integer_t trie_id;
+  igraph_integer_t name_id;
 
-  /* Copy label list to trie, if needed */
+  /* Copy label list to the name index, if needed */
   if (igraph_strvector_size(&context->labels) != 0) {
     igraph_integer_t i, id, n=igraph_strvector_size(&context->labels);
     for (i=0; i<n; i++) {
-      IGRAPH_YY_CHECK(igraph_trie_get(&context->trie, STR(context->labels, i), &id));
+      IGRAPH_YY_CHECK(igraph_i_name_index_get(&context->name_index, STR(context->labels, i), &id));
     }
     igraph_strvector_clear(&context->labels);
   }
-  IGRAPH_YY_CHECK(igraph_trie_get_len(&context->trie, igraph_dl_yyget_text(scanner),
-                                   igraph_dl_yyget_leng(scanner), &trie_id));
-  IGRAPH_ASSERT(0 <= trie_id && trie_id < IGRAPH_DL_MAX_VERTEX_COUNT);
-  (yyval.integer) = trie_id;
+  IGRAPH_YY_CHECK(igraph_i_name_index_get_len(&context->name_index, igraph_dl_yyget_text(scanner),
+                                              igraph_dl_yyget_leng(scanner), &name_id));
+  IGRAPH_ASSERT(0 <= name_id && name_id < IGRAPH_DL_MAX_VERTEX_COUNT);
+  (yyval.integer) = name_id;
  ;}
     break;
 
@@ -1424,13 +1424,13 @@ yyreduce:
   case 7:
 
     {
-  igraph_integer_t trie_id;
-  IGRAPH_YY_CHECK(igraph_trie_get_len(context->trie,
+  igraph_integer_t name_id;
+  IGRAPH_YY_CHECK(igraph_i_name_index_get_len(context->name_index,
     igraph_ncol_yyget_text(scanner),
     igraph_ncol_yyget_leng(scanner),
-    &trie_id
+    &name_id
   ));
-  (yyval.edgenum) = trie_id;
+  (yyval.edgenum) = name_id;
 ;}
     break;
 
@@ -762,7 +762,7 @@ static igraph_error_t igraph_i_layout_sugiyama_order_nodes_horizontally(const ig
         for (i = 0; i < no_of_vertices; i++) {
             MATRIX(*layout, i, 0) = xs[(igraph_integer_t)MATRIX(*layout, i, 1)]++;
         }
-        free(xs);
+        IGRAPH_FREE(xs);
     }
 
     IGRAPH_VECTOR_INIT_FINALLY(&barycenters, 0);
@@ -469,6 +469,7 @@ static igraph_error_t igraph_i_eigen_matrix_symmetric_lapack(const igraph_matrix
 typedef struct igraph_i_eigen_matrix_sym_arpack_data_t {
     const igraph_matrix_t *A;
     const igraph_sparsemat_t *sA;
+    const igraph_sparsemat_csr_t *csr;  /* row-compressed sA, if not NULL */
 } igraph_i_eigen_matrix_sym_arpack_data_t;
 
 static igraph_error_t igraph_i_eigen_matrix_sym_arpack_cb(igraph_real_t *to,
@@ -481,8 +482,14 @@ static igraph_error_t igraph_i_eigen_matrix_sym_arpack_cb(igraph_real_t *to,
     if (data->A) {
         IGRAPH_CHECK(igraph_blas_dgemv_array(/*transpose=*/ 0, /*alpha=*/ 1.0,
                                                data->A, from, /*beta=*/ 0.0, to));
+    } else if (data->csr) {
+        igraph_vector_t vto = IGRAPH_VECTOR_NULL, vfrom = IGRAPH_VECTOR_NULL;
+        igraph_vector_view(&vto, to, n);
+        igraph_vector_view(&vfrom, from, n);
+        igraph_vector_null(&vto);
+        IGRAPH_CHECK(igraph_sparsemat_csr_gaxpy(data->csr, &vfrom, &vto));
     } else { /* data->sA */
-        igraph_vector_t vto, vfrom;
+        igraph_vector_t vto = IGRAPH_VECTOR_NULL, vfrom = IGRAPH_VECTOR_NULL;
         igraph_vector_view(&vto, to, n);
         igraph_vector_view(&vfrom, from, n);
         igraph_vector_null(&vto);
@@ -510,6 +517,7 @@ static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack_be(const igraph_mat
     igraph_i_eigen_matrix_sym_arpack_data_t myextra;
     myextra.A = A;
     myextra.sA = sA;
+    myextra.csr = NULL;
 
     if (low + high >= n) {
         IGRAPH_ERROR("Requested too many eigenvalues/vectors", IGRAPH_EINVAL);
@@ -566,7 +574,7 @@ static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack_be(const igraph_mat
     return IGRAPH_SUCCESS;
 }
 
-static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack(const igraph_matrix_t *A,
+static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack_run(const igraph_matrix_t *A,
         const igraph_sparsemat_t *sA,
         igraph_arpack_function_t *fun,
         int n, void *extra,
@@ -584,6 +592,7 @@ static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack(const igraph_matrix
 
     myextra.A = A;
     myextra.sA = sA;
+    myextra.csr = NULL;
 
     if (!options) {
         IGRAPH_ERROR("`options' must be given for ARPACK algorithm",
@@ -646,6 +655,45 @@ static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack(const igraph_matrix
     }
 }
 
+static igraph_error_t igraph_i_eigen_matrix_symmetric_arpack(const igraph_matrix_t *A,
+        const igraph_sparsemat_t *sA,
+        igraph_arpack_function_t *fun,
+        int n, void *extra,
+        const igraph_eigen_which_t *which,
+        igraph_arpack_options_t *options,
+        igraph_arpack_storage_t *storage,
+        igraph_vector_t *values,
+        igraph_matrix_t *vectors) {
+
+    /* ARPACK multiplies with sA many times, a row-compressed copy makes
+       that faster */
+
+    igraph_i_eigen_matrix_sym_arpack_data_t myextra;
+    igraph_sparsemat_csr_t csr;
+
+    if (!sA || fun || !igraph_sparsemat_is_cc(sA)) {
+        return igraph_i_eigen_matrix_symmetric_arpack_run(A, sA, fun, n, extra,
+                which, options, storage,
+                values, vectors);
+    }
+
+    IGRAPH_CHECK(igraph_sparsemat_csr_init(&csr, sA));
+    IGRAPH_FINALLY(igraph_sparsemat_csr_destroy, &csr);
+
+    myextra.A = NULL;
+    myextra.sA = sA;
+    myextra.csr = &csr;
+
+    IGRAPH_CHECK(igraph_i_eigen_matrix_symmetric_arpack_run(A, sA,
+                 igraph_i_eigen_matrix_sym_arpack_cb, n, (void*) &myextra,
+                 which, options, storage, values, vectors));
+
+    igraph_sparsemat_csr_destroy(&csr);
+    IGRAPH_FINALLY_CLEAN(1);
+
+    return IGRAPH_SUCCESS;
+}
+
 /* Get the eigenvalues and the eigenvectors from the compressed
    form. Order them according to the ordering criteria.
    Comparison functions for the reordering first */
@@ -31,82 +31,24 @@
 
 #include <string.h>  /* memset */
 
-/**
- * \function igraph_get_all_shortest_paths
- * \brief All shortest paths (geodesics) from a vertex.
- *
- * When there is more than one shortest path between two vertices,
- * all of them will be returned.
- *
- * \param graph The graph object.
- * \param vertices The result, the IDs of the vertices along the paths.
- *   This is a list of integer vectors where each element is an
- *   \ref igraph_vector_int_t object. Each vector object contains the vertices
- *   along a shortest path from \p from to another vertex. The vectors are
- *   ordered according to their target vertex: first the shortest paths to
- *   vertex 0, then to vertex 1, etc. No data is included for unreachable
- *   vertices. The list will be resized as needed. Supply a null pointer here
- *   if you don't need these vectors.
- * \param edges The result, the IDs of the edges along the paths.
- *   This is a list of integer vectors where each element is an
- *   \ref igraph_vector_int_t object. Each vector object contains the edges
- *   along a shortest path from \p from to another vertex. The vectors are
- *   ordered according to their target vertex: first the shortest paths to
- *   vertex 0, then to vertex 1, etc. No data is included for unreachable
- *   vertices. The list will be resized as needed. Supply a null pointer here
- *   if you don't need these vectors.
- * \param nrgeo Pointer to an initialized \ref igraph_vector_int_t object or
- *   \c NULL. If not \c NULL the number of shortest paths from \p from are
- *   stored here for every vertex in the graph. Note that the values
- *   will be accurate only for those vertices that are in the target
- *   vertex sequence (see \p to), since the search terminates as soon
- *   as all the target vertices have been found.
- * \param from The id of the vertex from/to which the geodesics are
- *        calculated.
- * \param to Vertex sequence with the IDs of the vertices to/from which the
- *        shortest paths will be calculated. A vertex might be given multiple
- *        times.
- * \param mode The type of shortest paths to be use for the
- *        calculation in directed graphs. Possible values:
- *        \clist
- *        \cli IGRAPH_OUT
- *          the lengths of the outgoing paths are calculated.
- *        \cli IGRAPH_IN
- *          the lengths of the incoming paths are calculated.
- *        \cli IGRAPH_ALL
- *          the directed graph is considered as an
- *          undirected one for the computation.
- *        \endclist
- * \return Error code:
- *        \clist
- *        \cli IGRAPH_ENOMEM
- *           not enough memory for temporary data.
- *        \cli IGRAPH_EINVVID
- *           \p from is invalid vertex ID.
- *        \cli IGRAPH_EINVMODE
- *           invalid mode argument.
- *        \endclist
- *
- * Added in version 0.2.</para><para>
- *
- * Time complexity: O(|V|+|E|) for most graphs, O(|V|^2) in the worst
- * case.
- */
-
-igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
+/* The results go to the lists, to the ragged arrays, or nowhere, if
+ * the pointers are NULL. The paths found during the search are kept in
+ * ragged arrays, so that extending a path does not allocate a vector. */
+static igraph_error_t igraph_i_get_all_shortest_paths(const igraph_t *graph,
                                   igraph_vector_int_list_t *vertices,
                                   igraph_vector_int_list_t *edges,
+                                  igraph_ragged_int_t *vertices_ragged,
+                                  igraph_ragged_int_t *edges_ragged,
                                   igraph_vector_int_t *nrgeo,
                                   igraph_integer_t from, const igraph_vs_t to,
                                   igraph_neimode_t mode) {
 
     igraph_integer_t no_of_nodes = igraph_vcount(graph);
     igraph_integer_t *geodist;
-    igraph_vector_int_list_t paths;
-    igraph_vector_int_list_t path_edge;
+    igraph_bool_t need_edges = edges || edges_ragged;
+    igraph_ragged_int_t paths;
+    igraph_ragged_int_t path_edge;
     igraph_dqueue_int_t q;
-    igraph_vector_int_t *vptr;
-    igraph_vector_int_t *vptr_e;
     igraph_vector_int_t neis;
     igraph_vector_int_t ptrlist;
     igraph_vector_int_t ptrhead;
@@ -127,9 +69,10 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
     IGRAPH_FINALLY(igraph_vit_destroy, &vit);
 
     /* paths will store the shortest paths during the search */
-    IGRAPH_VECTOR_INT_LIST_INIT_FINALLY(&paths, 0);
-    /* path_edge will store the shortest paths during the search */
-    IGRAPH_VECTOR_INT_LIST_INIT_FINALLY(&path_edge, 0);
+    IGRAPH_RAGGED_INT_INIT_FINALLY(&paths);
+    /* path_edge will store the shortest paths during the search, if
+     * edges are needed */
+    IGRAPH_RAGGED_INT_INIT_FINALLY(&path_edge);
     /* neis is a temporary vector holding the neighbors of the
      * node being examined */
     IGRAPH_VECTOR_INT_INIT_FINALLY(&neis, 0);
@@ -177,9 +120,11 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
     }
 
     /* from -> from */
-    IGRAPH_CHECK(igraph_vector_int_list_push_back_new(&paths, &vptr));
-    IGRAPH_CHECK(igraph_vector_int_push_back(vptr, from));
-    IGRAPH_CHECK(igraph_vector_int_list_push_back_new(&path_edge, &vptr_e));
+    IGRAPH_CHECK(igraph_ragged_int_push_value(&paths, from));
+    IGRAPH_CHECK(igraph_ragged_int_end_item(&paths));
+    if (need_edges) {
+        IGRAPH_CHECK(igraph_ragged_int_end_item(&path_edge));
+    }
 
     geodist[from] = 1;
     VECTOR(ptrhead)[from] = 1;
@@ -216,7 +161,7 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
          * IGRAPH_OTHER() macro in the main loop. This is going to be slower than
          * using igraph_neighbors() due to branch mispredictions in IGRAPH_OTHER(), so we
          * use igraph_incident() only if the user needs the edge-paths */
-        if (edges) {
+        if (need_edges) {
             IGRAPH_CHECK(igraph_incident(graph, &neis, actnode, mode));
         } else {
             IGRAPH_CHECK(igraph_neighbors(graph, &neis, actnode, mode));
@@ -227,7 +172,7 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
             igraph_integer_t neighbor;
             igraph_integer_t fatherptr;
 
-            if (edges) {
+            if (need_edges) {
                 /* user needs the edge-paths, so 'neis' contains edge IDs, we need to resolve
                  * the next edge ID into a vertex ID */
                 neighbor = IGRAPH_OTHER(graph, VECTOR(neis)[j], actnode);
@@ -265,17 +210,17 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
             /* copy all existing paths to the parent */
             fatherptr = VECTOR(ptrhead)[actnode];
             while (fatherptr != 0) {
-                /* allocate a new igraph_vector_int_t at the end of paths */
-                IGRAPH_CHECK(igraph_vector_int_list_push_back_new(&paths, &vptr));
-                IGRAPH_CHECK(igraph_vector_int_update(vptr, igraph_vector_int_list_get_ptr(&paths, fatherptr - 1)));
-                IGRAPH_CHECK(igraph_vector_int_push_back(vptr, neighbor));
-
-                IGRAPH_CHECK(igraph_vector_int_list_push_back_new(&path_edge, &vptr_e));
-                if (actnode != from) {
-                    /* If the previous vertex was the source then there is no edge to add*/
-                    IGRAPH_CHECK(igraph_vector_int_update(vptr_e, igraph_vector_int_list_get_ptr(&path_edge, fatherptr - 1)));
+                /* the path to the parent, extended by neighbor */
+                IGRAPH_CHECK(igraph_ragged_int_append_item(&paths, &paths, fatherptr - 1));
+                IGRAPH_CHECK(igraph_ragged_int_push_value(&paths, neighbor));
+                IGRAPH_CHECK(igraph_ragged_int_end_item(&paths));
+
+                if (need_edges) {
+                    /* the edge path of the source is empty */
+                    IGRAPH_CHECK(igraph_ragged_int_append_item(&path_edge, &path_edge, fatherptr - 1));
+                    IGRAPH_CHECK(igraph_ragged_int_push_value(&path_edge, VECTOR(neis)[j]));
+                    IGRAPH_CHECK(igraph_ragged_int_end_item(&path_edge));
                 }
-                IGRAPH_CHECK(igraph_vector_int_push_back(vptr_e, VECTOR(neis)[j]));
 
                 IGRAPH_CHECK(igraph_vector_int_push_back(&ptrlist, VECTOR(ptrhead)[neighbor]));
                 VECTOR(ptrhead)[neighbor] = igraph_vector_int_size(&ptrlist);
@@ -300,6 +245,12 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
     if (edges) {
         igraph_vector_int_list_clear(edges);
     }
+    if (vertices_ragged) {
+        igraph_ragged_int_clear(vertices_ragged);
+    }
+    if (edges_ragged) {
+        igraph_ragged_int_clear(edges_ragged);
+    }
 
     for (i = 0; i < no_of_nodes; i++) {
         igraph_integer_t fatherptr = VECTOR(ptrhead)[i];
@@ -310,16 +261,25 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
         if (geodist[i] > 0) {
             /* yes, copy them to the result vector */
             while (fatherptr != 0) {
+                igraph_vector_int_t path;
                 if (vertices) {
                     IGRAPH_CHECK(igraph_vector_int_list_push_back_copy(
-                        vertices, igraph_vector_int_list_get_ptr(&paths, fatherptr - 1)
+                        vertices, igraph_ragged_int_view(&paths, fatherptr - 1, &path)
                     ));
                 }
                 if (edges) {
                     IGRAPH_CHECK(igraph_vector_int_list_push_back_copy(
-                        edges, igraph_vector_int_list_get_ptr(&path_edge, fatherptr - 1)
+                        edges, igraph_ragged_int_view(&path_edge, fatherptr - 1, &path)
                     ));
                 }
+                if (vertices_ragged) {
+                    IGRAPH_CHECK(igraph_ragged_int_append_item(vertices_ragged, &paths, fatherptr - 1));
+                    IGRAPH_CHECK(igraph_ragged_int_end_item(vertices_ragged));
+                }
+                if (edges_ragged) {
+                    IGRAPH_CHECK(igraph_ragged_int_append_item(edges_ragged, &path_edge, fatherptr - 1));
+                    IGRAPH_CHECK(igraph_ragged_int_end_item(edges_ragged));
+                }
                 fatherptr = VECTOR(ptrlist)[fatherptr - 1];
             }
         }
@@ -329,9 +289,124 @@ igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
     igraph_vector_int_destroy(&ptrlist);
     igraph_vector_int_destroy(&ptrhead);
     igraph_vector_int_destroy(&neis);
-    igraph_vector_int_list_destroy(&paths);
-    igraph_vector_int_list_destroy(&path_edge);
+    igraph_ragged_int_destroy(&paths);
+    igraph_ragged_int_destroy(&path_edge);
     igraph_vit_destroy(&vit);
     IGRAPH_FINALLY_CLEAN(7);
     return IGRAPH_SUCCESS;
 }
+
+/**
+ * \function igraph_get_all_shortest_paths
+ * \brief All shortest paths (geodesics) from a vertex.
+ *
+ * When there is more than one shortest path between two vertices,
+ * all of them will be returned.
+ *
+ * \param graph The graph object.
+ * \param vertices The result, the IDs of the vertices along the paths.
+ *   This is a list of integer vectors where each element is an
+ *   \ref igraph_vector_int_t object. Each vector object contains the vertices
+ *   along a shortest path from \p from to another vertex. The vectors are
+ *   ordered according to their target vertex: first the shortest paths to
+ *   vertex 0, then to vertex 1, etc. No data is included for unreachable
+ *   vertices. The list will be resized as needed. Supply a null pointer here
+ *   if you don't need these vectors.
+ * \param edges The result, the IDs of the edges along the paths.
+ *   This is a list of integer vectors where each element is an
+ *   \ref igraph_vector_int_t object. Each vector object contains the edges
+ *   along a shortest path from \p from to another vertex. The vectors are
+ *   ordered according to their target vertex: first the shortest paths to
+ *   vertex 0, then to vertex 1, etc. No data is included for unreachable
+ *   vertices. The list will be resized as needed. Supply a null pointer here
+ *   if you don't need these vectors.
+ * \param nrgeo Pointer to an initialized \ref igraph_vector_int_t object or
+ *   \c NULL. If not \c NULL the number of shortest paths from \p from are
+ *   stored here for every vertex in the graph. Note that the values
+ *   will be accurate only for those vertices that are in the target
+ *   vertex sequence (see \p to), since the search terminates as soon
+ *   as all the target vertices have been found.
+ * \param from The id of the vertex from/to which the geodesics are
+ *        calculated.
+ * \param to Vertex sequence with the IDs of the vertices to/from which the
+ *        shortest paths will be calculated. A vertex might be given multiple
+ *        times.
+ * \param mode The type of shortest paths to be use for the
+ *        calculation in directed graphs. Possible values:
+ *        \clist
+ *        \cli IGRAPH_OUT
+ *          the lengths of the outgoing paths are calculated.
+ *        \cli IGRAPH_IN
+ *          the lengths of the incoming paths are calculated.
+ *        \cli IGRAPH_ALL
+ *          the directed graph is considered as an
+ *          undirected one for the computation.
+ *        \endclist
+ * \return Error code:
+ *        \clist
+ *        \cli IGRAPH_ENOMEM
+ *           not enough memory for temporary data.
+ *        \cli IGRAPH_EINVVID
+ *           \p from is invalid vertex ID.
+ *        \cli IGRAPH_EINVMODE
+ *           invalid mode argument.
+ *        \endclist
+ *
+ * Added in version 0.2.</para><para>
+ *
+ * Time complexity: O(|V|+|E|) for most graphs, O(|V|^2) in the worst
+ * case.
+ */
+
+igraph_error_t igraph_get_all_shortest_paths(const igraph_t *graph,
+                                  igraph_vector_int_list_t *vertices,
+                                  igraph_vector_int_list_t *edges,
+                                  igraph_vector_int_t *nrgeo,
+                                  igraph_integer_t from, const igraph_vs_t to,
+                                  igraph_neimode_t mode) {
+    return igraph_i_get_all_shortest_paths(graph, vertices, edges, NULL, NULL,
+                                           nrgeo, from, to, mode);
+}
+
+/**
+ * \function igraph_get_all_shortest_paths_ragged
+ * \brief All shortest paths (geodesics) from a vertex, into ragged arrays.
+ *
+ * The same as \ref igraph_get_all_shortest_paths(), but each path is an
+ * item of a ragged array, instead of a vector of its own. This is much
+ * faster when there are many short paths.
+ *
+ * \param graph The graph object.
+ * \param vertices Initialized ragged array or a null pointer. If not a null
+ *   pointer, its contents are replaced by the vertices along the paths,
+ *   ordered by their target vertex as in \ref igraph_get_all_shortest_paths().
+ * \param edges Initialized ragged array or a null pointer. If not a null
+ *   pointer, its contents are replaced by the edges along the paths, in the
+ *   same order.
+ * \param nrgeo Pointer to an initialized \ref igraph_vector_int_t object or
+ *   \c NULL. If not \c NULL the number of shortest paths from \p from are
+ *   stored here for every vertex in the graph, see \ref
+ *   igraph_get_all_shortest_paths().
+ * \param from The id of the vertex from/to which the geodesics are
+ *        calculated.
+ * \param to Vertex sequence with the IDs of the vertices to/from which the
+ *        shortest paths will be calculated. A vertex might be given multiple
+ *        times.
+ * \param mode The type of shortest paths to be use for the
+ *        calculation in directed graphs, \c IGRAPH_OUT, \c IGRAPH_IN or
+ *        \c IGRAPH_ALL.
+ * \return Error code, see \ref igraph_get_all_shortest_paths().
+ *
+ * Time complexity: O(|V|+|E|) for most graphs, O(|V|^2) in the worst
+ * case.
+ */
+
+igraph_error_t igraph_get_all_shortest_paths_ragged(const igraph_t *graph,
+                                  igraph_ragged_int_t *vertices,
+                                  igraph_ragged_int_t *edges,
+                                  igraph_vector_int_t *nrgeo,
+                                  igraph_integer_t from, const igraph_vs_t to,
+                                  igraph_neimode_t mode) {
+    return igraph_i_get_all_shortest_paths(graph, NULL, NULL, vertices, edges,
+                                           nrgeo, from, to, mode);
+}
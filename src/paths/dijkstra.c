@@ -32,7 +32,9 @@
 
 #include "core/indheap.h"
 #include "core/interruption.h"
+#include "paths/paths_internal.h"
 
+#include <math.h>     /* floor */
 #include <string.h>   /* memset */
 
 /**
@@ -86,22 +88,32 @@ igraph_error_t igraph_distances_dijkstra_cutoff(const igraph_t *graph,
                                    const igraph_vector_t *weights,
                                    igraph_neimode_t mode,
                                    igraph_real_t cutoff) {
+    return igraph_i_distances_dijkstra_cutoff(graph, res, from, to, weights, mode,
+                                              cutoff, IGRAPH_I_HEAP_AUTO);
+}
+
+/* Implements igraph_distances_dijkstra_cutoff() with the given type of queue;
+   IGRAPH_I_HEAP_AUTO chooses one based on the size of the graph. */
+igraph_error_t igraph_i_distances_dijkstra_cutoff(const igraph_t *graph,
+                                                  igraph_matrix_t *res,
+                                                  const igraph_vs_t from,
+                                                  const igraph_vs_t to,
+                                                  const igraph_vector_t *weights,
+                                                  igraph_neimode_t mode,
+                                                  igraph_real_t cutoff,
+                                                  igraph_i_heap_type_t heap_type) {
 
     /* Implementation details. This is the basic Dijkstra algorithm,
-       with a binary heap. The heap is indexed, i.e. it stores not only
+       with a heap. The heap is indexed, i.e. it stores not only
        the distances, but also which vertex they belong to.
 
-       From now on we use a 2-way heap, so the distances can be queried
-       directly from the heap.
-
-       Tricks:
-       - The opposite of the distance is stored in the heap, as it is a
-         maximum heap and we need a minimum heap.
+       From now on we use a 2-way heap or a radix heap, so the distances
+       can be queried directly from the heap.
     */
 
     igraph_integer_t no_of_nodes = igraph_vcount(graph);
     igraph_integer_t no_of_edges = igraph_ecount(graph);
-    igraph_2wheap_t Q;
+    igraph_i_dijkstra_queue_t Q;
     igraph_vit_t fromvit, tovit;
     igraph_integer_t no_of_from, no_of_to;
     igraph_lazy_inclist_t inclist;
@@ -128,12 +140,21 @@ igraph_error_t igraph_distances_dijkstra_cutoff(const igraph_t *graph,
         }
     }
 
+    if (heap_type == IGRAPH_I_HEAP_AUTO) {
+        /* Scans the weights again only for graphs large enough to use it */
+        igraph_bool_t integer_weights = igraph_i_dijkstra_heap_needs_integer_check(no_of_nodes);
+        for (i = 0; integer_weights && i < no_of_edges; i++) {
+            integer_weights = VECTOR(*weights)[i] == floor(VECTOR(*weights)[i]);
+        }
+        heap_type = igraph_i_dijkstra_heap_type(no_of_nodes, integer_weights);
+    }
+
     IGRAPH_CHECK(igraph_vit_create(graph, from, &fromvit));
     IGRAPH_FINALLY(igraph_vit_destroy, &fromvit);
     no_of_from = IGRAPH_VIT_SIZE(fromvit);
 
-    IGRAPH_CHECK(igraph_2wheap_init(&Q, no_of_nodes));
-    IGRAPH_FINALLY(igraph_2wheap_destroy, &Q);
+    IGRAPH_CHECK(igraph_i_dijkstra_queue_init(&Q, no_of_nodes, heap_type));
+    IGRAPH_FINALLY(igraph_i_dijkstra_queue_destroy, &Q);
     IGRAPH_CHECK(igraph_lazy_inclist_init(graph, &inclist, mode, IGRAPH_LOOPS));
     IGRAPH_FINALLY(igraph_lazy_inclist_destroy, &inclist);
 
@@ -172,20 +193,17 @@ igraph_error_t igraph_distances_dijkstra_cutoff(const igraph_t *graph,
         igraph_integer_t reached = 0;
         igraph_integer_t source = IGRAPH_VIT_GET(fromvit);
 
-        igraph_2wheap_clear(&Q);
+        igraph_i_dijkstra_queue_clear(&Q);
+        IGRAPH_CHECK(igraph_i_dijkstra_queue_push(&Q, source, 0.0));
 
-        /* Many systems distinguish between +0.0 and -0.0.
-         * Since we store negative distances in the heap,
-         * we must insert -0.0 in order to get +0.0 as the
-         * final distance result. */
-        igraph_2wheap_push_with_index(&Q, source, -0.0);
-
-        while (!igraph_2wheap_empty(&Q)) {
-            igraph_integer_t minnei = igraph_2wheap_max_index(&Q);
-            igraph_real_t mindist = -igraph_2wheap_deactivate_max(&Q);
+        while (!igraph_i_dijkstra_queue_empty(&Q)) {
+            igraph_integer_t minnei;
+            igraph_real_t mindist;
             igraph_vector_int_t *neis;
             igraph_integer_t nlen;
 
+            IGRAPH_CHECK(igraph_i_dijkstra_queue_deactivate_min(&Q, &minnei, &mindist));
+
             if (cutoff >= 0 && mindist > cutoff) {
                 continue;
             }
@@ -197,7 +215,7 @@ igraph_error_t igraph_distances_dijkstra_cutoff(const igraph_t *graph,
                     MATRIX(*res, i, VECTOR(indexv)[minnei] - 1) = mindist;
                     reached++;
                     if (reached == no_of_to) {
-                        igraph_2wheap_clear(&Q);
+                        igraph_i_dijkstra_queue_clear(&Q);
                         break;
                     }
                 }
@@ -217,19 +235,19 @@ igraph_error_t igraph_distances_dijkstra_cutoff(const igraph_t *graph,
                 igraph_integer_t tto = IGRAPH_OTHER(graph, edge, minnei);
                 igraph_real_t altdist = mindist + weight;
 
-                if (! igraph_2wheap_has_elem(&Q, tto)) {
+                if (! igraph_i_dijkstra_queue_has_elem(&Q, tto)) {
                     /* This is the first non-infinite distance */
-                    IGRAPH_CHECK(igraph_2wheap_push_with_index(&Q, tto, -altdist));
-                } else if (igraph_2wheap_has_active(&Q, tto)) {
-                    igraph_real_t curdist = -igraph_2wheap_get(&Q, tto);
+                    IGRAPH_CHECK(igraph_i_dijkstra_queue_push(&Q, tto, altdist));
+                } else if (igraph_i_dijkstra_queue_has_active(&Q, tto)) {
+                    igraph_real_t curdist = igraph_i_dijkstra_queue_get(&Q, tto);
                     if (altdist < curdist) {
                         /* This is a shorter path */
-                        igraph_2wheap_modify(&Q, tto, -altdist);
+                        IGRAPH_CHECK(igraph_i_dijkstra_queue_decrease(&Q, tto, altdist));
                     }
                 }
             }
 
-        } /* !igraph_2wheap_empty(&Q) */
+        } /* !igraph_i_dijkstra_queue_empty(&Q) */
 
     } /* !IGRAPH_VIT_END(fromvit) */
 
@@ -240,7 +258,7 @@ igraph_error_t igraph_distances_dijkstra_cutoff(const igraph_t *graph,
     }
 
     igraph_lazy_inclist_destroy(&inclist);
-    igraph_2wheap_destroy(&Q);
+    igraph_i_dijkstra_queue_destroy(&Q);
     igraph_vit_destroy(&fromvit);
     IGRAPH_FINALLY_CLEAN(3);
 
@@ -452,6 +470,8 @@ igraph_error_t igraph_get_shortest_paths_dijkstra(const igraph_t *graph,
         IGRAPH_CHECK(igraph_vector_int_list_resize(edges, IGRAPH_VIT_SIZE(vit)));
     }
 
+    /* The binary heap, as the order in which vertices at equal distance are
+     * removed decides which of several shortest paths is returned */
     IGRAPH_CHECK(igraph_2wheap_init(&Q, no_of_nodes));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &Q);
     IGRAPH_CHECK(igraph_lazy_inclist_init(graph, &inclist, mode, IGRAPH_LOOPS));
@@ -852,7 +872,9 @@ igraph_error_t igraph_get_all_shortest_paths_dijkstra(const igraph_t *graph,
     IGRAPH_CHECK_OOM(is_target, "Cannot calculate shortest paths.");
     IGRAPH_FINALLY(igraph_free, is_target);
 
-    /* two-way heap storing vertices and distances */
+    /* two-way heap storing vertices and distances; binary, as the order in
+     * which vertices at equal distance are removed decides the order of the
+     * returned paths */
     IGRAPH_CHECK(igraph_2wheap_init(&Q, no_of_nodes));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &Q);
 
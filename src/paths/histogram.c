@@ -65,9 +65,9 @@ igraph_error_t igraph_path_length_hist(const igraph_t *graph, igraph_vector_t *r
     igraph_integer_t nodes_reached;
 
     igraph_dqueue_int_t q = IGRAPH_DQUEUE_NULL;
-    igraph_vector_int_t *neis;
+    const igraph_vector_int_t *neis;
     igraph_neimode_t dirmode;
-    igraph_adjlist_t allneis;
+    igraph_flat_adjlist_t allneis;
     igraph_real_t unconn = 0;
     igraph_integer_t ressize;
 
@@ -80,8 +80,8 @@ igraph_error_t igraph_path_length_hist(const igraph_t *graph, igraph_vector_t *r
     IGRAPH_CHECK(igraph_vector_int_init(&already_added, no_of_nodes));
     IGRAPH_FINALLY(igraph_vector_int_destroy, &already_added);
     IGRAPH_DQUEUE_INT_INIT_FINALLY(&q, 100);
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &allneis, dirmode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &allneis);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &allneis, dirmode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &allneis);
 
     igraph_vector_clear(res);
     ressize = 0;
@@ -100,7 +100,7 @@ igraph_error_t igraph_path_length_hist(const igraph_t *graph, igraph_vector_t *r
             igraph_integer_t actnode = igraph_dqueue_int_pop(&q);
             igraph_integer_t actdist = igraph_dqueue_int_pop(&q);
 
-            neis = igraph_adjlist_get(&allneis, actnode);
+            neis = igraph_flat_adjlist_get(&allneis, actnode);
             n = igraph_vector_int_size(neis);
             for (j = 0; j < n; j++) {
                 igraph_integer_t neighbor = VECTOR(*neis)[j];
@@ -138,7 +138,7 @@ igraph_error_t igraph_path_length_hist(const igraph_t *graph, igraph_vector_t *r
 
     igraph_vector_int_destroy(&already_added);
     igraph_dqueue_int_destroy(&q);
-    igraph_adjlist_destroy(&allneis);
+    igraph_flat_adjlist_destroy(&allneis);
     IGRAPH_FINALLY_CLEAN(3);
 
     if (unconnected) {
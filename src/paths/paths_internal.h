@@ -0,0 +1,44 @@
+/* -*- mode: C -*-  */
+/*
+   IGraph library.
+   Copyright (C) 2021 The igraph development team
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc.,  51 Franklin Street, Fifth Floor, Boston, MA
+   02110-1301 USA
+
+*/
+
+#ifndef IGRAPH_PATHS_INTERNAL_H
+#define IGRAPH_PATHS_INTERNAL_H
+
+#include "igraph_datatype.h"
+#include "igraph_decls.h"
+#include "igraph_iterators.h"
+#include "igraph_matrix.h"
+#include "igraph_types.h"
+#include "igraph_vector.h"
+
+#include "core/indheap.h"
+
+__BEGIN_DECLS
+
+IGRAPH_PRIVATE_EXPORT igraph_error_t igraph_i_distances_dijkstra_cutoff(
+   const igraph_t *graph, igraph_matrix_t *res, const igraph_vs_t from,
+   const igraph_vs_t to, const igraph_vector_t *weights, igraph_neimode_t mode,
+   igraph_real_t cutoff, igraph_i_heap_type_t heap_type);
+
+__END_DECLS
+
+#endif
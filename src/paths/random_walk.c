@@ -24,6 +24,7 @@
 #include "igraph_paths.h"
 
 #include "igraph_adjlist.h"
+#include "igraph_alias.h"
 #include "igraph_interface.h"
 #include "igraph_random.h"
 #include "igraph_memory.h"
@@ -92,10 +93,10 @@ static igraph_error_t igraph_i_random_walk_adjlist(const igraph_t *graph,
 }
 
 
-/* Used as item destructor for 'cdfs' in igraph_i_random_walk_inclist(). */
-static void vec_destr(igraph_vector_t *vec) {
-    if (vec != NULL) {
-        igraph_vector_destroy(vec);
+/* Used as item destructor for 'aliases' in igraph_i_random_walk_inclist(). */
+static void alias_destr(igraph_alias_t *alias) {
+    if (alias != NULL) {
+        igraph_alias_destroy(alias);
     }
 }
 
@@ -106,11 +107,9 @@ static void vec_destr(igraph_vector_t *vec) {
  * It's used for igraph_random_walk:
  *  - when weights are used or when edge IDs of the traversed edges
  *    and/or vertex IDs of the visited vertices are requested.
- * \param weights A vector of non-negative edge weights. It is assumed
- *   that at least one strictly positive weight is found among the
- *   outgoing edges of each vertex. Additionally, no edge weight may
- *   be NaN. If either case does not hold, an error is returned. If it
- *   is a NULL pointer, all edges are considered to have equal weight.
+ * \param weights A vector of non-negative, finite edge weights, as for
+ *   \ref igraph_random_walk(). If it is a NULL pointer, all edges are
+ *   considered to have equal weight.
  * \param vertices An allocated vector, the result is stored here as
  *   a list of vertex IDs. It will be resized as needed.
  *   It includes the starting vertex id as well.
@@ -131,7 +130,8 @@ static igraph_error_t igraph_i_random_walk_inclist(
     igraph_integer_t i, next;
     igraph_vector_t weight_temp;
     igraph_lazy_inclist_t il;
-    igraph_vector_ptr_t cdfs; /* cumulative distribution vectors for each node, used for weighted choice */
+    igraph_vector_ptr_t aliases; /* alias tables of the out-edges of each node, used for weighted choice */
+    igraph_rng_t *rng = igraph_rng_default();
 
     if (vertices) {
         IGRAPH_CHECK(igraph_vector_int_resize(vertices, steps + 1)); /* size: steps + 1 because vertices includes start vertex */
@@ -145,14 +145,14 @@ static igraph_error_t igraph_i_random_walk_inclist(
 
     IGRAPH_VECTOR_INIT_FINALLY(&weight_temp, 0);
 
-    /* cdf vectors will be computed lazily; that's why we are still using
+    /* alias tables will be computed lazily; that's why we are using
      * igraph_vector_ptr_t as it does not require us to pre-initialize all
-     * the vectors in the vector list */
-    IGRAPH_CHECK(igraph_vector_ptr_init(&cdfs, vc));
-    IGRAPH_FINALLY(igraph_vector_ptr_destroy_all, &cdfs);
-    IGRAPH_VECTOR_PTR_SET_ITEM_DESTRUCTOR(&cdfs, vec_destr);
+     * the tables */
+    IGRAPH_CHECK(igraph_vector_ptr_init(&aliases, vc));
+    IGRAPH_FINALLY(igraph_vector_ptr_destroy_all, &aliases);
+    IGRAPH_VECTOR_PTR_SET_ITEM_DESTRUCTOR(&aliases, alias_destr);
     for (i = 0; i < vc; ++i) {
-        VECTOR(cdfs)[i] = NULL;
+        VECTOR(aliases)[i] = NULL;
     }
 
     RNG_BEGIN();
@@ -184,29 +184,26 @@ static igraph_error_t igraph_i_random_walk_inclist(
         }
 
         if (weights) { /* weighted: choose an out-edge with probability proportional to its weight */
-            igraph_real_t r;
-            igraph_vector_t **cd = (igraph_vector_t**) &(VECTOR(cdfs)[start]);
+            igraph_alias_t *alias = (igraph_alias_t *) VECTOR(aliases)[start];
 
-            /* compute out-edge cdf for this node if not already done */
-            if (IGRAPH_UNLIKELY(! *cd)) {
+            /* build the out-edge alias table for this node if not already done */
+            if (IGRAPH_UNLIKELY(! alias)) {
                 igraph_integer_t j;
 
-                *cd = IGRAPH_CALLOC(1, igraph_vector_t);
-                if (*cd == NULL) {
-                    IGRAPH_ERROR("Random walk failed.", IGRAPH_ENOMEM); /* LCOV_EXCL_LINE */
-                }
-                IGRAPH_CHECK(igraph_vector_init(*cd, degree));
-
                 IGRAPH_CHECK(igraph_vector_resize(&weight_temp, degree));
                 for (j = 0; j < degree; ++j) {
                     VECTOR(weight_temp)[j] = VECTOR(*weights)[VECTOR(*inc_edges)[j]];
                 }
 
-                IGRAPH_CHECK(igraph_vector_cumsum(*cd, &weight_temp));
+                alias = IGRAPH_CALLOC(1, igraph_alias_t);
+                IGRAPH_CHECK_OOM(alias, "Random walk failed.");
+                IGRAPH_FINALLY(igraph_free, alias);
+                IGRAPH_CHECK(igraph_alias_init(alias, &weight_temp));
+                VECTOR(aliases)[start] = alias;
+                IGRAPH_FINALLY_CLEAN(1);
             }
 
-            r = RNG_UNIF(0, VECTOR(**cd)[degree - 1]);
-            igraph_vector_binsearch(*cd, r, &idx);
+            idx = igraph_alias_draw(alias, rng);
         }
         else {
             idx = RNG_INTEGER(0, degree - 1);
@@ -241,7 +238,7 @@ static igraph_error_t igraph_i_random_walk_inclist(
 
     RNG_END();
 
-    igraph_vector_ptr_destroy_all(&cdfs);
+    igraph_vector_ptr_destroy_all(&aliases);
     igraph_vector_destroy(&weight_temp);
     igraph_lazy_inclist_destroy(&il);
     IGRAPH_FINALLY_CLEAN(3);
@@ -260,11 +257,15 @@ static igraph_error_t igraph_i_random_walk_inclist(
  *
  * \param graph The input graph, it can be directed or undirected.
  *   Multiple edges are respected, so are loop edges.
- * \param weights A vector of non-negative edge weights. It is assumed
- *   that at least one strictly positive weight is found among the
- *   outgoing edges of each vertex. Additionally, no edge weight may
- *   be NaN. If either case does not hold, an error is returned. If it
- *   is \c NULL, all edges are considered to have equal weight.
+ * \param weights A vector of non-negative, finite edge weights. At least
+ *   one strictly positive weight must be found among the outgoing edges
+ *   of each vertex the walk reaches, otherwise \c IGRAPH_EINVAL is
+ *   returned when the walk gets there. Infinite or NaN weights are
+ *   errors too. If it is \c NULL, all edges are considered to have equal
+ *   weight. Weighted steps are drawn from alias tables, see
+ *   \ref igraph_alias_t. Earlier versions searched cumulative weight
+ *   sums, so for a given random seed a weighted walk differs from theirs,
+ *   although it follows the same distribution.
  * \param vertices An allocated vector, the result is stored here as
  *   a list of vertex IDs. It will be resized as needed.
  *   It includes the vertex IDs of starting and ending vertices.
@@ -288,11 +289,9 @@ static igraph_error_t igraph_i_random_walk_inclist(
  *   the actual interrupted walk.
  * \return Error code: \c IGRAPH_ERWSTUCK if the walk got stuck.
  *
- * Time complexity:
- *   O(l + d) for unweighted graphs and
- *   O(l * log(k) + d) for weighted graphs,
- *   where \c l is the length of the walk, \c d is the total degree of the visited nodes
- *   and \c k is the average degree of vertices of the given graph.
+ * Time complexity: O(l + d), where \c l is the length of the walk and
+ *   \c d is the total degree of the visited nodes. Weighted walks draw
+ *   each step from an alias table built on the first visit of a node.
  */
 
 
@@ -361,11 +360,9 @@ igraph_error_t igraph_random_walk(const igraph_t *graph,
  *
  * \param graph The input graph, it can be directed or undirected.
  *   Multiple edges are respected, so are loop edges.
- * \param weights A vector of non-negative edge weights. It is assumed
- *   that at least one strictly positive weight is found among the
- *   outgoing edges of each vertex. Additionally, no edge weight may
- *   be NaN. If either case does not hold, an error is returned. If it
- *   is a NULL pointer, all edges are considered to have equal weight.
+ * \param weights A vector of non-negative, finite edge weights, as for
+ *   \ref igraph_random_walk(). If it is a NULL pointer, all edges are
+ *   considered to have equal weight.
  * \param edgewalk An initialized vector; the indices of traversed
  *   edges are stored here. It will be resized as needed.
  * \param start The start vertex for the walk.
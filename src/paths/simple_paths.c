@@ -29,41 +29,11 @@
 
 #include "core/interruption.h"
 
-/**
- * \function igraph_get_all_simple_paths
- * \brief List all simple paths from one source.
- *
- * A path is simple if its vertices are unique, i.e. no vertex
- * is visited more than once.
- *
- * </para><para>
- * Note that potentially there are exponentially many
- * paths between two vertices of a graph, and you may
- * run out of memory when using this function when the
- * graph has many cycles. Consider using the \p cutoff
- * parameter when you do not need long paths.
- *
- * \param graph The input graph.
- * \param res Initialized integer vector. The paths are
- *        returned here in terms of their vertices, separated
- *        by -1 markers. The paths are included in arbitrary
- *        order, as they are found.
- * \param from The start vertex.
- * \param to The target vertices.
- * \param cutoff Maximum length of path that is considered. If
- *        negative, paths of all lengths are considered.
- * \param mode The type of the paths to consider, it is ignored
- *        for undirected graphs.
- * \return Error code.
- *
- * \sa \ref igraph_get_k_shortest_paths()
- *
- * Time complexity: O(n!) in the worst case, n is the number of
- * vertices.
- */
-
-igraph_error_t igraph_get_all_simple_paths(const igraph_t *graph,
+/* Appends the paths to res. They are separated by -1 markers, or, if
+ * offsets is not NULL, the end of each path is appended to offsets. */
+static igraph_error_t igraph_i_get_all_simple_paths(const igraph_t *graph,
                                 igraph_vector_int_t *res,
+                                igraph_vector_int_t *offsets,
                                 igraph_integer_t from,
                                 const igraph_vs_t to,
                                 igraph_integer_t cutoff,
@@ -107,8 +77,6 @@ igraph_error_t igraph_get_all_simple_paths(const igraph_t *graph,
     IGRAPH_CHECK(igraph_vector_int_init(&nptr, no_nodes));
     IGRAPH_FINALLY(igraph_vector_int_destroy, &nptr);
 
-    igraph_vector_int_clear(res);
-
     igraph_vector_int_clear(&stack);
     igraph_vector_int_clear(&dist);
     igraph_vector_int_push_back(&stack, from);
@@ -150,7 +118,11 @@ igraph_error_t igraph_get_all_simple_paths(const igraph_t *graph,
             /* Add to results */
             if (toall || VECTOR(markto)[nei]) {
                 IGRAPH_CHECK(igraph_vector_int_append(res, &stack));
-                IGRAPH_CHECK(igraph_vector_int_push_back(res, -1));
+                if (offsets) {
+                    IGRAPH_CHECK(igraph_vector_int_push_back(offsets, igraph_vector_int_size(res)));
+                } else {
+                    IGRAPH_CHECK(igraph_vector_int_push_back(res, -1));
+                }
             }
         } else {
             /* There is no such neighbor, finished with the subtree */
@@ -180,3 +152,79 @@ igraph_error_t igraph_get_all_simple_paths(const igraph_t *graph,
 
     return IGRAPH_SUCCESS;
 }
+
+/**
+ * \function igraph_get_all_simple_paths
+ * \brief List all simple paths from one source.
+ *
+ * A path is simple if its vertices are unique, i.e. no vertex
+ * is visited more than once.
+ *
+ * </para><para>
+ * Note that potentially there are exponentially many
+ * paths between two vertices of a graph, and you may
+ * run out of memory when using this function when the
+ * graph has many cycles. Consider using the \p cutoff
+ * parameter when you do not need long paths.
+ *
+ * \param graph The input graph.
+ * \param res Initialized integer vector. The paths are
+ *        returned here in terms of their vertices, separated
+ *        by -1 markers. The paths are included in arbitrary
+ *        order, as they are found.
+ * \param from The start vertex.
+ * \param to The target vertices.
+ * \param cutoff Maximum length of path that is considered. If
+ *        negative, paths of all lengths are considered.
+ * \param mode The type of the paths to consider, it is ignored
+ *        for undirected graphs.
+ * \return Error code.
+ *
+ * \sa \ref igraph_get_k_shortest_paths()
+ *
+ * Time complexity: O(n!) in the worst case, n is the number of
+ * vertices.
+ */
+
+igraph_error_t igraph_get_all_simple_paths(const igraph_t *graph,
+                                igraph_vector_int_t *res,
+                                igraph_integer_t from,
+                                const igraph_vs_t to,
+                                igraph_integer_t cutoff,
+                                igraph_neimode_t mode) {
+    igraph_vector_int_clear(res);
+    return igraph_i_get_all_simple_paths(graph, res, NULL, from, to, cutoff, mode);
+}
+
+/**
+ * \function igraph_get_all_simple_paths_ragged
+ * \brief List all simple paths from one source, into a ragged array.
+ *
+ * The same as \ref igraph_get_all_simple_paths(), but each path is an
+ * item of a ragged array, instead of being followed by a -1 marker.
+ *
+ * \param graph The input graph.
+ * \param res Initialized ragged array. Its contents are replaced by the
+ *        paths, in terms of their vertices, in the order they are found.
+ * \param from The start vertex.
+ * \param to The target vertices.
+ * \param cutoff Maximum length of path that is considered. If
+ *        negative, paths of all lengths are considered.
+ * \param mode The type of the paths to consider, it is ignored
+ *        for undirected graphs.
+ * \return Error code.
+ *
+ * Time complexity: O(n!) in the worst case, n is the number of
+ * vertices.
+ */
+
+igraph_error_t igraph_get_all_simple_paths_ragged(const igraph_t *graph,
+                                igraph_ragged_int_t *res,
+                                igraph_integer_t from,
+                                const igraph_vs_t to,
+                                igraph_integer_t cutoff,
+                                igraph_neimode_t mode) {
+    igraph_ragged_int_clear(res);
+    return igraph_i_get_all_simple_paths(graph, &res->values, &res->offsets,
+                                         from, to, cutoff, mode);
+}
@@ -90,9 +90,9 @@ igraph_error_t igraph_distances_cutoff(const igraph_t *graph, igraph_matrix_t *r
     igraph_integer_t no_of_nodes = igraph_vcount(graph);
     igraph_integer_t no_of_from, no_of_to;
     igraph_integer_t *already_counted;
-    igraph_adjlist_t adjlist;
+    igraph_flat_adjlist_t adjlist;
     igraph_dqueue_int_t q = IGRAPH_DQUEUE_NULL;
-    igraph_vector_int_t *neis;
+    const igraph_vector_int_t *neis;
     igraph_bool_t all_to;
 
     igraph_integer_t i, j;
@@ -108,8 +108,8 @@ igraph_error_t igraph_distances_cutoff(const igraph_t *graph, igraph_matrix_t *r
     IGRAPH_FINALLY(igraph_vit_destroy, &fromvit);
     no_of_from = IGRAPH_VIT_SIZE(fromvit);
 
-    IGRAPH_CHECK(igraph_adjlist_init(graph, &adjlist, mode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
-    IGRAPH_FINALLY(igraph_adjlist_destroy, &adjlist);
+    IGRAPH_CHECK(igraph_flat_adjlist_init(graph, &adjlist, mode, IGRAPH_LOOPS, IGRAPH_MULTIPLE));
+    IGRAPH_FINALLY(igraph_flat_adjlist_destroy, &adjlist);
 
     already_counted = IGRAPH_CALLOC(no_of_nodes, igraph_integer_t);
     IGRAPH_CHECK_OOM(already_counted, "Insufficient memory for graph distance calculation.");
@@ -169,7 +169,7 @@ igraph_error_t igraph_distances_cutoff(const igraph_t *graph, igraph_matrix_t *r
                 }
             }
 
-            neis = igraph_adjlist_get(&adjlist, act);
+            neis = igraph_flat_adjlist_get(&adjlist, act);
             igraph_integer_t nei_count = igraph_vector_int_size(neis);
             for (j = 0; j < nei_count; j++) {
                 igraph_integer_t neighbor = VECTOR(*neis)[j];
@@ -193,7 +193,7 @@ igraph_error_t igraph_distances_cutoff(const igraph_t *graph, igraph_matrix_t *r
     IGRAPH_FREE(already_counted);
     igraph_dqueue_int_destroy(&q);
     igraph_vit_destroy(&fromvit);
-    igraph_adjlist_destroy(&adjlist);
+    igraph_flat_adjlist_destroy(&adjlist);
     IGRAPH_FINALLY_CLEAN(4);
 
     return IGRAPH_SUCCESS;
@@ -194,7 +194,11 @@ static igraph_error_t igraph_i_voronoi_dijkstra(
     IGRAPH_CHECK(igraph_inclist_init(graph, &il, mode, IGRAPH_LOOPS));
     IGRAPH_FINALLY(igraph_inclist_destroy, &il);
 
-    IGRAPH_CHECK(igraph_2wheap_init(&q, no_of_nodes));
+    /* Random tie breaking draws in the order vertices are removed, which
+     * only the binary heap keeps as it was */
+    IGRAPH_CHECK(igraph_2wheap_init_arity(&q, no_of_nodes,
+                                          tiebreaker == IGRAPH_VORONOI_RANDOM ?
+                                          2 : igraph_2wheap_auto_arity(no_of_nodes)));
     IGRAPH_FINALLY(igraph_2wheap_destroy, &q);
 
     if (tiebreaker == IGRAPH_VORONOI_RANDOM) {
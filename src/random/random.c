@@ -42,6 +42,7 @@
 #include <assert.h>
 #include <math.h>
 #include <float.h> /* DBL_MANT_DIG */
+#include <string.h> /* memcpy() */
 
 /**
  * \section about_rngs
@@ -232,6 +233,34 @@ igraph_error_t igraph_rng_init(igraph_rng_t *rng, const igraph_rng_type_t *type)
     return IGRAPH_SUCCESS;
 }
 
+/**
+ * \function igraph_rng_init_stream
+ * \brief Initializes a random number generator on a given stream.
+ *
+ * This is the same as \ref igraph_rng_init() followed by
+ * \ref igraph_rng_seed_stream(). Use it to create one generator per
+ * task of a parallel computation: give every task its own stream, numbered
+ * by the task and not by the thread that runs it, and the results will not
+ * depend on the number of threads.
+ *
+ * \param rng Pointer to an uninitialized RNG.
+ * \param type The type of the RNG. It must support streams, like
+ *    \ref igraph_rngtype_pcg32 and \ref igraph_rngtype_pcg64 do.
+ * \param seed The seed, shared by all streams.
+ * \param stream The stream of this generator.
+ * \return Error code, \c IGRAPH_UNIMPLEMENTED if the RNG type does not
+ *    support streams.
+ */
+
+igraph_error_t igraph_rng_init_stream(igraph_rng_t *rng, const igraph_rng_type_t *type,
+                                      igraph_uint_t seed, igraph_uint_t stream) {
+    IGRAPH_CHECK(igraph_rng_init(rng, type));
+    IGRAPH_FINALLY(igraph_rng_destroy, rng);
+    IGRAPH_CHECK(igraph_rng_seed_stream(rng, seed, stream));
+    IGRAPH_FINALLY_CLEAN(1);
+    return IGRAPH_SUCCESS;
+}
+
 /**
  * \function igraph_rng_destroy
  * \brief Deallocates memory associated with a random number generator.
@@ -264,6 +293,67 @@ igraph_error_t igraph_rng_seed(igraph_rng_t *rng, igraph_uint_t seed) {
     return IGRAPH_SUCCESS;
 }
 
+/**
+ * \function igraph_rng_seed_stream
+ * \brief Seeds a random number generator and selects one of its streams.
+ *
+ * Generators seeded with the same seed but different streams produce
+ * different sequences, while the same seed and stream always reproduce
+ * the same sequence. Only the lowest 63 bits of the stream are used by
+ * the PCG generators.
+ *
+ * </para><para>
+ * Streams of the PCG generators differ only in their increment, and such
+ * streams are not guaranteed to be statistically independent: their
+ * outputs can be correlated. When the sequences of several tasks must
+ * not overlap, seed a single stream and give each task its own block
+ * with \ref igraph_rng_advance().
+ *
+ * \param rng The RNG.
+ * \param seed The new seed.
+ * \param stream The stream to use.
+ * \return Error code, \c IGRAPH_UNIMPLEMENTED if the RNG type does not
+ *    support streams.
+ *
+ * Time complexity: O(1) for the PCG generators.
+ */
+igraph_error_t igraph_rng_seed_stream(igraph_rng_t *rng, igraph_uint_t seed,
+                                      igraph_uint_t stream) {
+    const igraph_rng_type_t *type = rng->type;
+    if (!type->seed_stream) {
+        IGRAPH_ERRORF("The %s random number generator does not support streams.",
+                      IGRAPH_UNIMPLEMENTED, type->name);
+    }
+    IGRAPH_CHECK(type->seed_stream(rng->state, seed, stream));
+    rng->is_seeded = 1;
+    return IGRAPH_SUCCESS;
+}
+
+/**
+ * \function igraph_rng_advance
+ * \brief Skips ahead in the sequence of a random number generator.
+ *
+ * Leaves the RNG in the same state as \p delta rounds of generation
+ * would, see \ref igraph_rng_bits(). This can be used to split one
+ * stream into non-overlapping blocks, one per task.
+ *
+ * \param rng The RNG.
+ * \param delta The number of rounds to skip.
+ *
+ * Time complexity: O(log(delta)) for the PCG generators, O(delta) for
+ * the others.
+ */
+void igraph_rng_advance(igraph_rng_t *rng, igraph_uint_t delta) {
+    const igraph_rng_type_t *type = rng->type;
+    if (type->advance) {
+        type->advance(rng->state, delta);
+    } else {
+        for (; delta > 0; delta--) {
+            type->get(rng->state);
+        }
+    }
+}
+
 /**
  * \function igraph_rng_bits
  * \brief The number of random bits that a random number generator can produces in a single round.
@@ -685,6 +775,108 @@ igraph_real_t igraph_rng_get_unif01(igraph_rng_t *rng) {
     }
 }
 
+/**
+ * Builds 52 random bits from consecutive outputs of the generator, in the
+ * same way as igraph_i_rng_get_random_bits_uint64() does when it calls
+ * get() itself.
+ */
+static uint64_t igraph_i_rng_bits52_from_block(const igraph_uint_t *words, uint8_t rng_bitwidth) {
+    uint8_t bits = 52;
+    uint64_t result;
+
+    if (rng_bitwidth >= bits) {
+        result = words[0] >> (rng_bitwidth - bits);
+    } else {
+        result = 0;
+        do {
+            result = (result << rng_bitwidth) + *words++;
+            bits -= rng_bitwidth;
+        } while (bits > rng_bitwidth);
+        result = (result << bits) + (*words >> (rng_bitwidth - bits));
+    }
+
+    return result;
+}
+
+#define IGRAPH_I_RNG_BLOCK_SIZE 256
+
+/**
+ * \function igraph_rng_get_unif_vector
+ * \brief Samples many numbers uniformly from an interval.
+ *
+ * Fills \p result with the same numbers as \p n consecutive calls to
+ * \ref igraph_rng_get_unif() would return, and leaves the RNG in the
+ * same state. RNGs that can generate many values at once, such as the
+ * PCG generators, are called once per block of numbers instead of once per
+ * number.
+ *
+ * \param rng Pointer to the RNG to use. Use \ref igraph_rng_default()
+ *        here to use the default igraph RNG.
+ * \param l The lower bound, it can be negative.
+ * \param h The upper bound, it can be negative, but it has to be
+ *        larger than the lower bound.
+ * \param n The number of samples.
+ * \param result An initialized vector, it will be resized to \p n and
+ *        the samples are stored here.
+ * \return Error code.
+ *
+ * Time complexity: O(n).
+ */
+
+igraph_error_t igraph_rng_get_unif_vector(igraph_rng_t *rng,
+                                          igraph_real_t l, igraph_real_t h,
+                                          igraph_integer_t n, igraph_vector_t *result) {
+    const igraph_rng_type_t *type = rng->type;
+
+    if (n < 0) {
+        IGRAPH_ERRORF("Number of samples must not be negative, got %" IGRAPH_PRId ".",
+                      IGRAPH_EINVAL, n);
+    }
+    if (!(h >= l)) {
+        IGRAPH_ERROR("Upper bound must not be smaller than the lower bound.", IGRAPH_EINVAL);
+    }
+
+    IGRAPH_CHECK(igraph_vector_resize(result, n));
+
+    if (l == h) {
+        igraph_vector_fill(result, h);
+    } else if (type->get_block && !type->get_real) {
+        const uint8_t bitwidth = type->bits;
+        const igraph_integer_t words = (52 + bitwidth - 1) / bitwidth;
+        const igraph_integer_t per_block = IGRAPH_I_RNG_BLOCK_SIZE / words;
+        igraph_uint_t block[IGRAPH_I_RNG_BLOCK_SIZE];
+        igraph_integer_t pos = 0, avail = 0;
+
+        for (igraph_integer_t i = 0; i < n; i++) {
+            igraph_real_t r;
+            double d;
+            do {
+                if (pos == avail) {
+                    /* Never generate more than is still needed, so that the
+                     * RNG ends up where single draws would have left it. */
+                    avail = (n - i < per_block ? n - i : per_block) * words;
+                    type->get_block(rng->state, block, avail);
+                    pos = 0;
+                }
+                /* Same conversion as in igraph_rng_get_unif01() */
+                uint64_t u = (igraph_i_rng_bits52_from_block(block + pos, bitwidth) & 0xFFFFFFFFFFFFFull) | 0x3FF0000000000000ull;
+                pos += words;
+                memcpy(&d, &u, sizeof(d));
+                r = (d - 1.0) * (h - l) + l;
+            } while (IGRAPH_UNLIKELY(r == h));
+            VECTOR(*result)[i] = r;
+        }
+    } else {
+        for (igraph_integer_t i = 0; i < n; i++) {
+            VECTOR(*result)[i] = igraph_rng_get_unif(rng, l, h);
+        }
+    }
+
+    return IGRAPH_SUCCESS;
+}
+
+#undef IGRAPH_I_RNG_BLOCK_SIZE
+
 /**
  * \function igraph_rng_get_geom
  * \brief Samples from a geometric distribution.
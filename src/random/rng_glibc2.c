@@ -140,5 +140,8 @@ const igraph_rng_type_t igraph_rngtype_glibc2 = {
     /* get_binom= */ 0,
     /* get_exp= */   0,
     /* get_gamma= */ 0,
-    /* get_pois= */  0
+    /* get_pois= */  0,
+    /* get_block= */ 0,
+    /* seed_stream= */ 0,
+    /* advance= */   0
 };
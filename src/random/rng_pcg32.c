@@ -62,6 +62,31 @@ static igraph_error_t igraph_rng_pcg32_seed(void *vstate, igraph_uint_t seed) {
     return IGRAPH_SUCCESS;
 }
 
+static void igraph_rng_pcg32_get_block(void *vstate, igraph_uint_t *out, igraph_integer_t n) {
+    pcg32_random_t *state = (pcg32_random_t*) vstate;
+    for (igraph_integer_t i = 0; i < n; i++) {
+        out[i] = pcg32_random_r(state);
+    }
+}
+
+static igraph_error_t igraph_rng_pcg32_seed_stream(void *vstate, igraph_uint_t seed, igraph_uint_t stream) {
+    pcg32_random_t *state = (pcg32_random_t*) vstate;
+
+    /* Here the seed goes into the state and the stream into the sequence
+     * number. Generators on different sequences never share a cycle, but
+     * PCG streams that differ only in their increment can still produce
+     * correlated output. Use igraph_rng_advance() on a single stream where
+     * non-overlapping blocks are needed. */
+    pcg32_srandom_r(state, seed, stream);
+
+    return IGRAPH_SUCCESS;
+}
+
+static void igraph_rng_pcg32_advance(void *vstate, igraph_uint_t delta) {
+    pcg32_random_t *state = (pcg32_random_t*) vstate;
+    pcg32_advance_r(state, delta);
+}
+
 static igraph_error_t igraph_rng_pcg32_init(void **state) {
     pcg32_random_t *st;
 
@@ -85,7 +110,8 @@ static void igraph_rng_pcg32_destroy(void *vstate) {
  *
  * This is an implementation of the PCG random number generator; see
  * https://www.pcg-random.org for more details. This implementation returns
- * 32 random bits in a single iteration.
+ * 32 random bits in a single iteration. It supports 2^63 streams, see
+ * \ref igraph_rng_seed_stream().
  *
  * </para><para>
  * The generator was ported from the original source code published by the
@@ -106,7 +132,10 @@ const igraph_rng_type_t igraph_rngtype_pcg32 = {
     /* get_binom= */ 0,
     /* get_exp= */   0,
     /* get_gamma= */ 0,
-    /* get_pois= */  0
+    /* get_pois= */  0,
+    /* get_block= */ igraph_rng_pcg32_get_block,
+    /* seed_stream= */ igraph_rng_pcg32_seed_stream,
+    /* advance= */   igraph_rng_pcg32_advance
 };
 
 /***** Default RNG, used upon igraph startup *****/
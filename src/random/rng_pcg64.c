@@ -59,6 +59,28 @@ static igraph_error_t igraph_rng_pcg64_seed(void *vstate, igraph_uint_t seed) {
     return IGRAPH_SUCCESS;
 }
 
+static void igraph_rng_pcg64_get_block(void *vstate, igraph_uint_t *out, igraph_integer_t n) {
+    pcg64_random_t *state = (pcg64_random_t*) vstate;
+    for (igraph_integer_t i = 0; i < n; i++) {
+        out[i] = pcg64_random_r(state);
+    }
+}
+
+static igraph_error_t igraph_rng_pcg64_seed_stream(void *vstate, igraph_uint_t seed, igraph_uint_t stream) {
+    pcg64_random_t *state = (pcg64_random_t*) vstate;
+
+    /* As in PCG32, the seed goes into the state and the stream into the
+     * sequence number. */
+    pcg64_srandom_r(state, seed, stream);
+
+    return IGRAPH_SUCCESS;
+}
+
+static void igraph_rng_pcg64_advance(void *vstate, igraph_uint_t delta) {
+    pcg64_random_t *state = (pcg64_random_t*) vstate;
+    pcg64_advance_r(state, delta);
+}
+
 static igraph_error_t igraph_rng_pcg64_init(void **state) {
     pcg64_random_t *st;
 
@@ -90,6 +112,19 @@ static igraph_error_t igraph_rng_pcg64_seed(void *vstate, igraph_uint_t seed) {
     IGRAPH_ERROR("64-bit PCG generator needs __uint128_t.", IGRAPH_UNIMPLEMENTED);
 }
 
+static void igraph_rng_pcg64_get_block(void *vstate, igraph_uint_t *out, igraph_integer_t n) {
+    IGRAPH_UNUSED(vstate); IGRAPH_UNUSED(out); IGRAPH_UNUSED(n);
+}
+
+static igraph_error_t igraph_rng_pcg64_seed_stream(void *vstate, igraph_uint_t seed, igraph_uint_t stream) {
+    IGRAPH_UNUSED(vstate); IGRAPH_UNUSED(seed); IGRAPH_UNUSED(stream);
+    IGRAPH_ERROR("64-bit PCG generator needs __uint128_t.", IGRAPH_UNIMPLEMENTED);
+}
+
+static void igraph_rng_pcg64_advance(void *vstate, igraph_uint_t delta) {
+    IGRAPH_UNUSED(vstate); IGRAPH_UNUSED(delta);
+}
+
 static igraph_error_t igraph_rng_pcg64_init(void **state) {
     IGRAPH_UNUSED(state);
     IGRAPH_ERROR("64-bit PCG generator needs __uint128_t.", IGRAPH_UNIMPLEMENTED);
@@ -113,7 +148,8 @@ static void igraph_rng_pcg64_destroy(void *vstate) {
  * </para><para>
  * PCG64 typically provides better performance than PCG32 when sampling floating
  * point numbers or very large integers, as it can provide twice as many random
- * bits in a single generation round.
+ * bits in a single generation round. Like PCG32, it supports 2^63
+ * streams.
  *
  * </para><para>
  * The generator was ported from the original source code published by the
@@ -134,5 +170,8 @@ const igraph_rng_type_t igraph_rngtype_pcg64 = {
     /* get_binom= */ 0,
     /* get_exp= */   0,
     /* get_gamma= */ 0,
-    /* get_pois= */  0
+    /* get_pois= */  0,
+    /* get_block= */ igraph_rng_pcg64_get_block,
+    /* seed_stream= */ igraph_rng_pcg64_seed_stream,
+    /* advance= */   igraph_rng_pcg64_advance
 };
@@ -0,0 +1,962 @@
+#include "rattributes.h"
+
+#include <string.h>
+#include <algorithm>
+#include <csetjmp>
+#include <new>
+#include <vector>
+
+// Attribute roots. graph->attr points to a holder for every graph, but the
+// root list is only created with the first attribute: most graphs igraph
+// creates are temporaries that never get one. Roots are kept alive by a cell
+// of attr_cells, a doubly linked list (CDR is the next cell, TAG the
+// previous one) between two sentinels, which unlike R_PreserveObject()
+// releases them in O(1).
+
+struct attr_holder_t {
+  SEXP cell;  // NULL until the graph has a root
+  bool has_names;
+  R_igraph_vertex_names_t names;  // valid if has_names
+};
+
+static SEXP attr_cells = NULL;
+
+static SEXP attr_keep(SEXP root) {
+  SEXP next = CDR(attr_cells);
+  SEXP cell = PROTECT(CONS(root, next));
+  SET_TAG(cell, attr_cells);
+  SETCDR(attr_cells, cell);
+  SET_TAG(next, cell);
+  UNPROTECT(1);
+  return cell;
+}
+
+static void attr_release(SEXP cell) {
+  SEXP prev = TAG(cell), next = CDR(cell);
+  SETCDR(prev, next);
+  SET_TAG(next, prev);
+}
+
+static SEXP attr_root(const igraph_t* graph) {
+  auto* holder = static_cast<const attr_holder_t*>(graph->attr);
+  return holder && holder->cell ? CAR(holder->cell) : R_NilValue;
+}
+
+// Drops the index of the vertex names, see R_igraph_attribute_vertex_names().
+static void attr_drop_names(const igraph_t* graph) {
+  auto* holder = static_cast<attr_holder_t*>(graph->attr);
+  if (holder && holder->has_names) {
+    igraph_i_name_index_destroy(&holder->names.index);
+    igraph_vector_int_destroy(&holder->names.vertex);
+    holder->has_names = false;
+  }
+}
+
+static void attr_set_root(igraph_t* graph, SEXP root) {
+  auto* holder = static_cast<attr_holder_t*>(graph->attr);
+  SEXP cell = attr_keep(root);
+  if (holder->cell) {
+    attr_release(holder->cell);
+  }
+  holder->cell = cell;
+  attr_drop_names(graph);
+}
+
+// Callbacks run inside igraph functions, an R error raised while they
+// allocate must not jump over those. attr_protect() catches it and makes the
+// callback fail instead; R_igraph_attribute_resume() continues unwinding
+// once the igraph function has returned.
+
+static SEXP attr_unwind_token = NULL;
+static bool attr_unwind_pending = false;
+
+template <typename F>
+static igraph_error_t attr_protect(F&& body) {
+  struct call_t {
+    F* body;
+    igraph_error_t err;
+  } call = { &body, IGRAPH_SUCCESS };
+  std::jmp_buf jmpbuf;
+
+  attr_unwind_pending = false;
+  if (setjmp(jmpbuf)) {
+    attr_unwind_pending = true;
+    IGRAPH_ERROR("Cannot update attributes, an R error occurred.", IGRAPH_EATTRIBUTES);
+  }
+  R_UnwindProtect(
+    [](void* data) -> SEXP {
+      auto* c = static_cast<call_t*>(data);
+      c->err = (*c->body)();
+      return R_NilValue;
+    },
+    &call,
+    [](void* data, Rboolean jump) {
+      if (jump) {
+        std::longjmp(*static_cast<std::jmp_buf*>(data), 1);
+      }
+    },
+    &jmpbuf, attr_unwind_token);
+
+  return call.err;
+}
+
+// Attribute lists
+
+static SEXP attr_list(const igraph_t* graph, int which) {
+  SEXP root = attr_root(graph);
+  return isNull(root) ? R_NilValue : VECTOR_ELT(root, which);
+}
+
+static R_xlen_t attr_find(SEXP list, const char* name) {
+  if (isNull(list)) {
+    return -1;
+  }
+  SEXP names = getAttrib(list, R_NamesSymbol);
+  for (R_xlen_t i = 0; i < XLENGTH(list); i++) {
+    if (!strcmp(CHAR(STRING_ELT(names, i)), name)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static SEXP attr_new_root(void) {
+  SEXP root = PROTECT(NEW_LIST(3));
+  for (int i = ATTRIBUTE_GRAPH; i <= ATTRIBUTE_EDGE; i++) {
+    SET_VECTOR_ELT(root, i, NEW_LIST(0));
+    setAttrib(VECTOR_ELT(root, i), R_NamesSymbol, NEW_CHARACTER(0));
+  }
+  UNPROTECT(1);
+  return root;
+}
+
+static SEXP attr_ensure_root(igraph_t* graph) {
+  SEXP root = attr_root(graph);
+  if (isNull(root)) {
+    root = PROTECT(attr_new_root());
+    attr_set_root(graph, root);
+    UNPROTECT(1);
+  }
+  return root;
+}
+
+// Sets, adds or, if value is NULL, removes an attribute. Only the list of
+// the given graph is modified, the columns themselves are left alone.
+static void attr_put(SEXP root, int which, const char* name, SEXP value) {
+  SEXP list = VECTOR_ELT(root, which);
+  SEXP names = getAttrib(list, R_NamesSymbol);
+  R_xlen_t pos = attr_find(list, name);
+  R_xlen_t size = XLENGTH(list);
+  R_xlen_t new_size, i, k;
+
+  if (pos >= 0 && !isNull(value)) {
+    SET_VECTOR_ELT(list, pos, value);
+    return;
+  }
+  if (pos < 0 && isNull(value)) {
+    return;
+  }
+
+  new_size = isNull(value) ? size - 1 : size + 1;
+  SEXP new_list = PROTECT(NEW_LIST(new_size));
+  SEXP new_names = PROTECT(NEW_CHARACTER(new_size));
+  for (i = 0, k = 0; i < size; i++) {
+    if (i != pos) {
+      SET_VECTOR_ELT(new_list, k, VECTOR_ELT(list, i));
+      SET_STRING_ELT(new_names, k, STRING_ELT(names, i));
+      k++;
+    }
+  }
+  if (!isNull(value)) {
+    SET_VECTOR_ELT(new_list, k, value);
+    SET_STRING_ELT(new_names, k, mkChar(name));
+  }
+  setAttrib(new_list, R_NamesSymbol, new_names);
+  SET_VECTOR_ELT(root, which, new_list);
+  UNPROTECT(2);
+}
+
+static SEXP attr_list_copy(SEXP list) {
+  R_xlen_t size = isNull(list) ? 0 : XLENGTH(list);
+  SEXP copy = PROTECT(NEW_LIST(size));
+  for (R_xlen_t i = 0; i < size; i++) {
+    SET_VECTOR_ELT(copy, i, VECTOR_ELT(list, i));
+  }
+  setAttrib(copy, R_NamesSymbol,
+            size > 0 ? getAttrib(list, R_NamesSymbol) : NEW_CHARACTER(0));
+  UNPROTECT(1);
+  return copy;
+}
+
+// Columns
+
+static SEXPTYPE attr_sexptype(igraph_attribute_type_t type) {
+  switch (type) {
+    case IGRAPH_ATTRIBUTE_NUMERIC: return REALSXP;
+    case IGRAPH_ATTRIBUTE_BOOLEAN: return LGLSXP;
+    case IGRAPH_ATTRIBUTE_STRING: return STRSXP;
+    default: return NILSXP;
+  }
+}
+
+static igraph_attribute_type_t attr_type(SEXP col) {
+  switch (TYPEOF(col)) {
+    case REALSXP: return IGRAPH_ATTRIBUTE_NUMERIC;
+    case LGLSXP: return IGRAPH_ATTRIBUTE_BOOLEAN;
+    case STRSXP: return IGRAPH_ATTRIBUTE_STRING;
+    default: return IGRAPH_ATTRIBUTE_OBJECT;
+  }
+}
+
+static void column_set_na(SEXP col, R_xlen_t from, R_xlen_t to) {
+  for (R_xlen_t i = from; i < to; i++) {
+    switch (TYPEOF(col)) {
+      case REALSXP: REAL(col)[i] = NA_REAL; break;
+      case LGLSXP: LOGICAL(col)[i] = NA_LOGICAL; break;
+      default: SET_STRING_ELT(col, i, NA_STRING); break;
+    }
+  }
+}
+
+// Copies the first size elements of col into a new column of length
+// new_size, filling the rest from rec or with NA.
+static SEXP column_resize(SEXP col, SEXPTYPE type, R_xlen_t size, R_xlen_t new_size,
+                          const igraph_attribute_record_t* rec) {
+  SEXP res = PROTECT(allocVector(type, new_size));
+  R_xlen_t keep = std::min(size, new_size);
+  R_xlen_t i;
+
+  if (isNull(col)) {
+    column_set_na(res, 0, keep);
+  } else if (type == STRSXP) {
+    for (i = 0; i < keep; i++) {
+      SET_STRING_ELT(res, i, STRING_ELT(col, i));
+    }
+  } else if (keep > 0) {
+    memcpy(DATAPTR(res), DATAPTR(col),
+           (size_t) keep * (type == REALSXP ? sizeof(double) : sizeof(int)));
+  }
+
+  if (!rec) {
+    column_set_na(res, keep, new_size);
+  } else if (type == REALSXP) {
+    const auto* values = static_cast<const igraph_vector_t*>(rec->value);
+    for (i = keep; i < new_size; i++) {
+      REAL(res)[i] = VECTOR(*values)[i - keep];
+    }
+  } else if (type == LGLSXP) {
+    const auto* values = static_cast<const igraph_vector_bool_t*>(rec->value);
+    for (i = keep; i < new_size; i++) {
+      LOGICAL(res)[i] = VECTOR(*values)[i - keep];
+    }
+  } else {
+    const auto* values = static_cast<const igraph_strvector_t*>(rec->value);
+    for (i = keep; i < new_size; i++) {
+      SET_STRING_ELT(res, i, mkChar(igraph_strvector_get(values, i - keep)));
+    }
+  }
+
+  UNPROTECT(1);
+  return res;
+}
+
+static SEXP column_index(SEXP col, const igraph_vector_int_t* idx) {
+  R_xlen_t size = igraph_vector_int_size(idx);
+  SEXP res = PROTECT(allocVector(TYPEOF(col), size));
+  R_xlen_t i;
+
+  switch (TYPEOF(col)) {
+    case REALSXP:
+      for (i = 0; i < size; i++) {
+        REAL(res)[i] = REAL(col)[VECTOR(*idx)[i]];
+      }
+      break;
+    case LGLSXP:
+      for (i = 0; i < size; i++) {
+        LOGICAL(res)[i] = LOGICAL(col)[VECTOR(*idx)[i]];
+      }
+      break;
+    default:
+      for (i = 0; i < size; i++) {
+        SET_STRING_ELT(res, i, STRING_ELT(col, VECTOR(*idx)[i]));
+      }
+      break;
+  }
+
+  UNPROTECT(1);
+  return res;
+}
+
+static igraph_integer_t merge_pick(const igraph_vector_int_t* group,
+                                   igraph_attribute_combination_type_t type) {
+  igraph_integer_t size = igraph_vector_int_size(group);
+  if (type == IGRAPH_ATTRIBUTE_COMBINE_LAST) {
+    return VECTOR(*group)[size - 1];
+  }
+  if (type == IGRAPH_ATTRIBUTE_COMBINE_RANDOM) {
+    return VECTOR(*group)[RNG_INTEGER(0, size - 1)];
+  }
+  return VECTOR(*group)[0];
+}
+
+static double combine_real(const double* values, const igraph_vector_int_t* group,
+                           igraph_attribute_combination_type_t type) {
+  igraph_integer_t size = igraph_vector_int_size(group);
+  igraph_integer_t i;
+  double res;
+
+  switch (type) {
+    case IGRAPH_ATTRIBUTE_COMBINE_SUM:
+      res = 0;
+      for (i = 0; i < size; i++) res += values[VECTOR(*group)[i]];
+      return res;
+    case IGRAPH_ATTRIBUTE_COMBINE_PROD:
+      res = 1;
+      for (i = 0; i < size; i++) res *= values[VECTOR(*group)[i]];
+      return res;
+    case IGRAPH_ATTRIBUTE_COMBINE_MEAN:
+      if (size == 0) return NA_REAL;
+      res = 0;
+      for (i = 0; i < size; i++) res += values[VECTOR(*group)[i]];
+      return res / size;
+    default:
+      break;
+  }
+
+  if (size == 0) {
+    return NA_REAL;
+  }
+
+  switch (type) {
+    case IGRAPH_ATTRIBUTE_COMBINE_MIN:
+      res = values[VECTOR(*group)[0]];
+      for (i = 1; i < size; i++) res = std::min(res, values[VECTOR(*group)[i]]);
+      return res;
+    case IGRAPH_ATTRIBUTE_COMBINE_MAX:
+      res = values[VECTOR(*group)[0]];
+      for (i = 1; i < size; i++) res = std::max(res, values[VECTOR(*group)[i]]);
+      return res;
+    case IGRAPH_ATTRIBUTE_COMBINE_MEDIAN: {
+      std::vector<double> sorted(size);
+      for (i = 0; i < size; i++) sorted[i] = values[VECTOR(*group)[i]];
+      std::sort(sorted.begin(), sorted.end());
+      return size % 2 ? sorted[size / 2] : (sorted[size / 2 - 1] + sorted[size / 2]) / 2;
+    }
+    default:
+      return values[merge_pick(group, type)];
+  }
+}
+
+static int combine_logical(const int* values, const igraph_vector_int_t* group,
+                           igraph_attribute_combination_type_t type) {
+  igraph_integer_t size = igraph_vector_int_size(group);
+  igraph_integer_t i;
+
+  switch (type) {
+    case IGRAPH_ATTRIBUTE_COMBINE_SUM:
+    case IGRAPH_ATTRIBUTE_COMBINE_MAX:
+      for (i = 0; i < size; i++) if (values[VECTOR(*group)[i]] == 1) return 1;
+      return 0;
+    case IGRAPH_ATTRIBUTE_COMBINE_PROD:
+    case IGRAPH_ATTRIBUTE_COMBINE_MIN:
+      for (i = 0; i < size; i++) if (values[VECTOR(*group)[i]] == 0) return 0;
+      return 1;
+    default:
+      return size == 0 ? NA_LOGICAL : values[merge_pick(group, type)];
+  }
+}
+
+static SEXP combine_string(SEXP col, const igraph_vector_int_t* group,
+                           igraph_attribute_combination_type_t type) {
+  igraph_integer_t size = igraph_vector_int_size(group);
+  igraph_integer_t i;
+
+  if (type != IGRAPH_ATTRIBUTE_COMBINE_CONCAT) {
+    return size == 0 ? NA_STRING : STRING_ELT(col, merge_pick(group, type));
+  }
+
+  // The buffer is allocated by R, so that an error in mkChar() leaks nothing
+  const void* vmax = vmaxget();
+  size_t len = 0;
+  for (i = 0; i < size; i++) {
+    len += strlen(CHAR(STRING_ELT(col, VECTOR(*group)[i])));
+  }
+  char* res = R_alloc(len + 1, 1);
+  len = 0;
+  for (i = 0; i < size; i++) {
+    const char* str = CHAR(STRING_ELT(col, VECTOR(*group)[i]));
+    strcpy(res + len, str);
+    len += strlen(str);
+  }
+  SEXP elt = mkChar(res);
+  vmaxset(vmax);
+  return elt;
+}
+
+static bool combine_supported(SEXPTYPE sexptype, igraph_attribute_combination_type_t type) {
+  switch (type) {
+    case IGRAPH_ATTRIBUTE_COMBINE_FIRST:
+    case IGRAPH_ATTRIBUTE_COMBINE_LAST:
+    case IGRAPH_ATTRIBUTE_COMBINE_RANDOM:
+      return true;
+    case IGRAPH_ATTRIBUTE_COMBINE_SUM:
+    case IGRAPH_ATTRIBUTE_COMBINE_PROD:
+    case IGRAPH_ATTRIBUTE_COMBINE_MIN:
+    case IGRAPH_ATTRIBUTE_COMBINE_MAX:
+      return sexptype != STRSXP;
+    case IGRAPH_ATTRIBUTE_COMBINE_MEAN:
+    case IGRAPH_ATTRIBUTE_COMBINE_MEDIAN:
+      return sexptype == REALSXP;
+    case IGRAPH_ATTRIBUTE_COMBINE_CONCAT:
+      return sexptype == STRSXP;
+    default:
+      return false;
+  }
+}
+
+static SEXP column_combine(SEXP col, const igraph_vector_int_list_t* merges,
+                           igraph_attribute_combination_type_t type) {
+  igraph_integer_t size = igraph_vector_int_list_size(merges);
+  SEXP res = PROTECT(allocVector(TYPEOF(col), size));
+  igraph_integer_t i;
+
+  RNG_BEGIN();
+  for (i = 0; i < size; i++) {
+    const igraph_vector_int_t* group = igraph_vector_int_list_get_ptr(merges, i);
+    switch (TYPEOF(col)) {
+      case REALSXP: REAL(res)[i] = combine_real(REAL(col), group, type); break;
+      case LGLSXP: LOGICAL(res)[i] = combine_logical(LOGICAL(col), group, type); break;
+      default: SET_STRING_ELT(res, i, combine_string(col, group, type)); break;
+    }
+  }
+  RNG_END();
+
+  UNPROTECT(1);
+  return res;
+}
+
+// Attribute table
+
+static void R_igraph_attribute_destroy(igraph_t* graph) {
+  auto* holder = static_cast<attr_holder_t*>(graph->attr);
+  if (holder) {
+    if (holder->cell) {
+      attr_release(holder->cell);
+    }
+    attr_drop_names(graph);
+    delete holder;
+    graph->attr = NULL;
+  }
+}
+
+static igraph_error_t R_igraph_attribute_init(igraph_t* graph, igraph_vector_ptr_t* attr) {
+  igraph_integer_t nattr = attr ? igraph_vector_ptr_size(attr) : 0;
+  igraph_integer_t i;
+  igraph_error_t err;
+
+  for (i = 0; i < nattr; i++) {
+    auto* rec = static_cast<const igraph_attribute_record_t*>(VECTOR(*attr)[i]);
+    if (attr_sexptype(rec->type) == NILSXP) {
+      IGRAPH_ERROR("Unsupported graph attribute type.", IGRAPH_EATTRIBUTES);
+    }
+  }
+
+  graph->attr = new (std::nothrow) attr_holder_t{};
+  IGRAPH_CHECK_OOM(graph->attr, "Cannot initialize attributes.");
+  if (nattr == 0) {
+    return IGRAPH_SUCCESS;
+  }
+
+  err = attr_protect([&]() -> igraph_error_t {
+    SEXP root = attr_ensure_root(graph);
+    for (igraph_integer_t j = 0; j < nattr; j++) {
+      auto* rec = static_cast<const igraph_attribute_record_t*>(VECTOR(*attr)[j]);
+      SEXP col = PROTECT(column_resize(R_NilValue, attr_sexptype(rec->type), 0, 1, rec));
+      attr_put(root, ATTRIBUTE_GRAPH, rec->name, col);
+      UNPROTECT(1);
+    }
+    return IGRAPH_SUCCESS;
+  });
+  if (err != IGRAPH_SUCCESS) {
+    R_igraph_attribute_destroy(graph);
+  }
+  return err;
+}
+
+static igraph_error_t R_igraph_attribute_copy(igraph_t* to, const igraph_t* from,
+                                              igraph_bool_t ga, igraph_bool_t va,
+                                              igraph_bool_t ea) {
+  SEXP from_root = attr_root(from);
+  igraph_bool_t keep[] = { ga, va, ea };
+  bool empty = true;
+  igraph_error_t err;
+
+  to->attr = new (std::nothrow) attr_holder_t{};
+  IGRAPH_CHECK_OOM(to->attr, "Cannot copy attributes.");
+
+  for (int i = ATTRIBUTE_GRAPH; i <= ATTRIBUTE_EDGE && !isNull(from_root); i++) {
+    if (keep[i] && XLENGTH(VECTOR_ELT(from_root, i)) > 0) {
+      empty = false;
+    }
+  }
+  if (empty) {
+    return IGRAPH_SUCCESS;
+  }
+
+  err = attr_protect([&]() -> igraph_error_t {
+    SEXP root = PROTECT(attr_new_root());
+    for (int i = ATTRIBUTE_GRAPH; i <= ATTRIBUTE_EDGE; i++) {
+      if (keep[i]) {
+        SET_VECTOR_ELT(root, i, attr_list_copy(VECTOR_ELT(from_root, i)));
+      }
+    }
+    attr_set_root(to, root);
+    UNPROTECT(1);
+    return IGRAPH_SUCCESS;
+  });
+  if (err != IGRAPH_SUCCESS) {
+    R_igraph_attribute_destroy(to);
+  }
+  return err;
+}
+
+// Called after the vertices or edges have been added to the graph.
+static igraph_error_t attr_add(igraph_t* graph, int which, igraph_integer_t added,
+                               igraph_vector_ptr_t* attr) {
+  igraph_integer_t new_size = which == ATTRIBUTE_VERTEX ? igraph_vcount(graph) : igraph_ecount(graph);
+  igraph_integer_t size = new_size - added;
+  igraph_integer_t nattr = attr ? igraph_vector_ptr_size(attr) : 0;
+  std::vector<bool> used(nattr, false);
+  igraph_integer_t j;
+
+  for (j = 0; j < nattr; j++) {
+    auto* rec = static_cast<const igraph_attribute_record_t*>(VECTOR(*attr)[j]);
+    if (attr_sexptype(rec->type) == NILSXP) {
+      IGRAPH_ERROR("Unsupported attribute type.", IGRAPH_EATTRIBUTES);
+    }
+  }
+
+  if (which == ATTRIBUTE_VERTEX) {
+    attr_drop_names(graph);
+  }
+  if (isNull(attr_root(graph)) && nattr == 0) {
+    return IGRAPH_SUCCESS;
+  }
+
+  return attr_protect([&]() -> igraph_error_t {
+    SEXP root = attr_ensure_root(graph);
+    SEXP list = VECTOR_ELT(root, which);
+    SEXP names = getAttrib(list, R_NamesSymbol);
+    igraph_integer_t i, j;
+
+    for (i = 0; i < XLENGTH(list); i++) {
+      SEXP col = VECTOR_ELT(list, i);
+      const igraph_attribute_record_t* found = NULL;
+      for (j = 0; j < nattr; j++) {
+        auto* rec = static_cast<const igraph_attribute_record_t*>(VECTOR(*attr)[j]);
+        if (!strcmp(rec->name, CHAR(STRING_ELT(names, i)))) {
+          if (attr_sexptype(rec->type) != TYPEOF(col)) {
+            IGRAPH_ERROR("Attribute type does not match existing attribute.", IGRAPH_EATTRIBUTES);
+          }
+          found = rec;
+          used[j] = true;
+        }
+      }
+      SET_VECTOR_ELT(list, i, column_resize(col, TYPEOF(col), size, new_size, found));
+    }
+
+    for (j = 0; j < nattr; j++) {
+      auto* rec = static_cast<const igraph_attribute_record_t*>(VECTOR(*attr)[j]);
+      if (!used[j]) {
+        SEXP col = PROTECT(column_resize(R_NilValue, attr_sexptype(rec->type), size, new_size, rec));
+        attr_put(root, which, rec->name, col);
+        UNPROTECT(1);
+      }
+    }
+
+    return IGRAPH_SUCCESS;
+  });
+}
+
+static igraph_error_t attr_permute(const igraph_t* graph, igraph_t* newgraph, int which,
+                                   const igraph_vector_int_t* idx) {
+  SEXP list = attr_list(graph, which);
+
+  if (graph == newgraph && which == ATTRIBUTE_VERTEX) {
+    attr_drop_names(graph);
+  }
+  if (isNull(list) || XLENGTH(list) == 0) {
+    return IGRAPH_SUCCESS;
+  }
+
+  return attr_protect([&]() -> igraph_error_t {
+    SEXP names = getAttrib(list, R_NamesSymbol);
+    SEXP new_root = graph == newgraph ? R_NilValue : attr_ensure_root(newgraph);
+
+    for (R_xlen_t i = 0; i < XLENGTH(list); i++) {
+      SEXP col = PROTECT(column_index(VECTOR_ELT(list, i), idx));
+      if (graph == newgraph) {
+        SET_VECTOR_ELT(list, i, col);
+      } else {
+        attr_put(new_root, which, CHAR(STRING_ELT(names, i)), col);
+      }
+      UNPROTECT(1);
+    }
+
+    return IGRAPH_SUCCESS;
+  });
+}
+
+static igraph_error_t attr_combine(const igraph_t* graph, igraph_t* newgraph, int which,
+                                   const igraph_vector_int_list_t* merges,
+                                   const igraph_attribute_combination_t* comb) {
+  SEXP list = attr_list(graph, which);
+
+  if (isNull(list) || XLENGTH(list) == 0) {
+    return IGRAPH_SUCCESS;
+  }
+
+  return attr_protect([&]() -> igraph_error_t {
+    SEXP names = getAttrib(list, R_NamesSymbol);
+    SEXP new_root = attr_ensure_root(newgraph);
+    igraph_attribute_combination_type_t type;
+    igraph_function_pointer_t func;
+
+    for (R_xlen_t i = 0; i < XLENGTH(list); i++) {
+      const char* name = CHAR(STRING_ELT(names, i));
+      SEXP col = VECTOR_ELT(list, i);
+      IGRAPH_CHECK(igraph_attribute_combination_query(comb, name, &type, &func));
+      if (type == IGRAPH_ATTRIBUTE_COMBINE_DEFAULT || type == IGRAPH_ATTRIBUTE_COMBINE_IGNORE) {
+        continue;
+      }
+      if (!combine_supported(TYPEOF(col), type)) {
+        IGRAPH_ERRORF("Unsupported combination for attribute '%s'.", IGRAPH_EATTRCOMBINE, name);
+      }
+      SEXP new_col = PROTECT(column_combine(col, merges, type));
+      attr_put(new_root, which, name, new_col);
+      UNPROTECT(1);
+    }
+
+    return IGRAPH_SUCCESS;
+  });
+}
+
+static igraph_error_t R_igraph_attribute_add_vertices(igraph_t* graph, igraph_integer_t nv,
+                                                      igraph_vector_ptr_t* attr) {
+  return attr_add(graph, ATTRIBUTE_VERTEX, nv, attr);
+}
+
+static igraph_error_t R_igraph_attribute_permute_vertices(const igraph_t* graph, igraph_t* newgraph,
+                                                          const igraph_vector_int_t* idx) {
+  return attr_permute(graph, newgraph, ATTRIBUTE_VERTEX, idx);
+}
+
+static igraph_error_t R_igraph_attribute_combine_vertices(const igraph_t* graph, igraph_t* newgraph,
+                                                          const igraph_vector_int_list_t* merges,
+                                                          const igraph_attribute_combination_t* comb) {
+  return attr_combine(graph, newgraph, ATTRIBUTE_VERTEX, merges, comb);
+}
+
+static igraph_error_t R_igraph_attribute_add_edges(igraph_t* graph, const igraph_vector_int_t* edges,
+                                                   igraph_vector_ptr_t* attr) {
+  return attr_add(graph, ATTRIBUTE_EDGE, igraph_vector_int_size(edges) / 2, attr);
+}
+
+static igraph_error_t R_igraph_attribute_permute_edges(const igraph_t* graph, igraph_t* newgraph,
+                                                       const igraph_vector_int_t* idx) {
+  return attr_permute(graph, newgraph, ATTRIBUTE_EDGE, idx);
+}
+
+static igraph_error_t R_igraph_attribute_combine_edges(const igraph_t* graph, igraph_t* newgraph,
+                                                       const igraph_vector_int_list_t* merges,
+                                                       const igraph_attribute_combination_t* comb) {
+  return attr_combine(graph, newgraph, ATTRIBUTE_EDGE, merges, comb);
+}
+
+static igraph_error_t R_igraph_attribute_get_info(const igraph_t* graph,
+                                                  igraph_strvector_t* gnames, igraph_vector_int_t* gtypes,
+                                                  igraph_strvector_t* vnames, igraph_vector_int_t* vtypes,
+                                                  igraph_strvector_t* enames, igraph_vector_int_t* etypes) {
+  igraph_strvector_t* all_names[] = { gnames, vnames, enames };
+  igraph_vector_int_t* all_types[] = { gtypes, vtypes, etypes };
+
+  for (int i = ATTRIBUTE_GRAPH; i <= ATTRIBUTE_EDGE; i++) {
+    SEXP list = attr_list(graph, i);
+    R_xlen_t size = isNull(list) ? 0 : XLENGTH(list);
+    if (all_names[i]) {
+      IGRAPH_CHECK(igraph_strvector_resize(all_names[i], size));
+      for (R_xlen_t j = 0; j < size; j++) {
+        IGRAPH_CHECK(igraph_strvector_set(all_names[i], j,
+                                          CHAR(STRING_ELT(getAttrib(list, R_NamesSymbol), j))));
+      }
+    }
+    if (all_types[i]) {
+      IGRAPH_CHECK(igraph_vector_int_resize(all_types[i], size));
+      for (R_xlen_t j = 0; j < size; j++) {
+        VECTOR(*all_types[i])[j] = attr_type(VECTOR_ELT(list, j));
+      }
+    }
+  }
+
+  return IGRAPH_SUCCESS;
+}
+
+static igraph_bool_t R_igraph_attribute_has_attr(const igraph_t* graph,
+                                                 igraph_attribute_elemtype_t type,
+                                                 const char* name) {
+  return attr_find(attr_list(graph, type), name) >= 0;
+}
+
+static igraph_error_t R_igraph_attribute_gettype(const igraph_t* graph, igraph_attribute_type_t* type,
+                                                 igraph_attribute_elemtype_t elemtype, const char* name) {
+  SEXP list = attr_list(graph, elemtype);
+  R_xlen_t pos = attr_find(list, name);
+  if (pos < 0) {
+    IGRAPH_ERRORF("Unknown attribute: '%s'.", IGRAPH_EINVAL, name);
+  }
+  *type = attr_type(VECTOR_ELT(list, pos));
+  return IGRAPH_SUCCESS;
+}
+
+// Looks up a column of the requested type for the getters.
+static SEXP attr_column(const igraph_t* graph, int which, const char* name, SEXPTYPE type) {
+  SEXP list = attr_list(graph, which);
+  R_xlen_t pos = attr_find(list, name);
+  if (pos < 0 || TYPEOF(VECTOR_ELT(list, pos)) != type) {
+    return R_NilValue;
+  }
+  return VECTOR_ELT(list, pos);
+}
+
+#define ATTR_COLUMN(col, graph, which, name, type) \
+  do { \
+    col = attr_column(graph, which, name, type); \
+    if (isNull(col)) { \
+      IGRAPH_ERRORF("Attribute '%s' does not exist or has a different type.", IGRAPH_EINVAL, name); \
+    } \
+  } while (0)
+
+static igraph_error_t R_igraph_attribute_get_numeric_graph_attr(const igraph_t* graph, const char* name,
+                                                                igraph_vector_t* value) {
+  SEXP col;
+  ATTR_COLUMN(col, graph, ATTRIBUTE_GRAPH, name, REALSXP);
+  IGRAPH_CHECK(igraph_vector_resize(value, 1));
+  VECTOR(*value)[0] = XLENGTH(col) > 0 ? REAL(col)[0] : NA_REAL;
+  return IGRAPH_SUCCESS;
+}
+
+static igraph_error_t R_igraph_attribute_get_string_graph_attr(const igraph_t* graph, const char* name,
+                                                               igraph_strvector_t* value) {
+  SEXP col;
+  ATTR_COLUMN(col, graph, ATTRIBUTE_GRAPH, name, STRSXP);
+  IGRAPH_CHECK(igraph_strvector_resize(value, 1));
+  IGRAPH_CHECK(igraph_strvector_set(value, 0, XLENGTH(col) > 0 ? CHAR(STRING_ELT(col, 0)) : ""));
+  return IGRAPH_SUCCESS;
+}
+
+static igraph_error_t R_igraph_attribute_get_bool_graph_attr(const igraph_t* graph, const char* name,
+                                                             igraph_vector_bool_t* value) {
+  SEXP col;
+  ATTR_COLUMN(col, graph, ATTRIBUTE_GRAPH, name, LGLSXP);
+  IGRAPH_CHECK(igraph_vector_bool_resize(value, 1));
+  VECTOR(*value)[0] = XLENGTH(col) > 0 && LOGICAL(col)[0] == 1;
+  return IGRAPH_SUCCESS;
+}
+
+// Vertex and edge getters share one implementation; positions come from a
+// vertex or edge iterator.
+template <typename It>
+static igraph_error_t attr_get_real(SEXP col, It* it, igraph_vector_t* value) {
+  IGRAPH_CHECK(igraph_vector_resize(value, it->end - it->start));
+  for (igraph_integer_t i = 0; i < igraph_vector_size(value); i++) {
+    VECTOR(*value)[i] = REAL(col)[it->vec ? VECTOR(*it->vec)[it->start + i] : it->start + i];
+  }
+  return IGRAPH_SUCCESS;
+}
+
+template <typename It>
+static igraph_error_t attr_get_bool(SEXP col, It* it, igraph_vector_bool_t* value) {
+  IGRAPH_CHECK(igraph_vector_bool_resize(value, it->end - it->start));
+  for (igraph_integer_t i = 0; i < igraph_vector_bool_size(value); i++) {
+    VECTOR(*value)[i] = LOGICAL(col)[it->vec ? VECTOR(*it->vec)[it->start + i] : it->start + i] == 1;
+  }
+  return IGRAPH_SUCCESS;
+}
+
+template <typename It>
+static igraph_error_t attr_get_string(SEXP col, It* it, igraph_strvector_t* value) {
+  IGRAPH_CHECK(igraph_strvector_resize(value, it->end - it->start));
+  for (igraph_integer_t i = 0; i < igraph_strvector_size(value); i++) {
+    SEXP elt = STRING_ELT(col, it->vec ? VECTOR(*it->vec)[it->start + i] : it->start + i);
+    IGRAPH_CHECK(igraph_strvector_set(value, i, elt == NA_STRING ? "" : CHAR(elt)));
+  }
+  return IGRAPH_SUCCESS;
+}
+
+#define ATTR_GETTER(name, which, sel_t, it_t, sexptype, value_t, getter) \
+  static igraph_error_t name(const igraph_t* graph, const char* attr, sel_t sel, value_t* value) { \
+    SEXP col; \
+    igraph_##it_t##_t it; \
+    ATTR_COLUMN(col, graph, which, attr, sexptype); \
+    IGRAPH_CHECK(igraph_##it_t##_create(graph, sel, &it)); \
+    IGRAPH_FINALLY(igraph_##it_t##_destroy, &it); \
+    IGRAPH_CHECK(getter(col, &it, value)); \
+    igraph_##it_t##_destroy(&it); \
+    IGRAPH_FINALLY_CLEAN(1); \
+    return IGRAPH_SUCCESS; \
+  }
+
+ATTR_GETTER(R_igraph_attribute_get_numeric_vertex_attr, ATTRIBUTE_VERTEX, igraph_vs_t, vit,
+            REALSXP, igraph_vector_t, attr_get_real)
+ATTR_GETTER(R_igraph_attribute_get_string_vertex_attr, ATTRIBUTE_VERTEX, igraph_vs_t, vit,
+            STRSXP, igraph_strvector_t, attr_get_string)
+ATTR_GETTER(R_igraph_attribute_get_bool_vertex_attr, ATTRIBUTE_VERTEX, igraph_vs_t, vit,
+            LGLSXP, igraph_vector_bool_t, attr_get_bool)
+ATTR_GETTER(R_igraph_attribute_get_numeric_edge_attr, ATTRIBUTE_EDGE, igraph_es_t, eit,
+            REALSXP, igraph_vector_t, attr_get_real)
+ATTR_GETTER(R_igraph_attribute_get_string_edge_attr, ATTRIBUTE_EDGE, igraph_es_t, eit,
+            STRSXP, igraph_strvector_t, attr_get_string)
+ATTR_GETTER(R_igraph_attribute_get_bool_edge_attr, ATTRIBUTE_EDGE, igraph_es_t, eit,
+            LGLSXP, igraph_vector_bool_t, attr_get_bool)
+
+const igraph_attribute_table_t R_igraph_attribute_table = {
+  &R_igraph_attribute_init,
+  &R_igraph_attribute_destroy,
+  &R_igraph_attribute_copy,
+  &R_igraph_attribute_add_vertices,
+  &R_igraph_attribute_permute_vertices,
+  &R_igraph_attribute_combine_vertices,
+  &R_igraph_attribute_add_edges,
+  &R_igraph_attribute_permute_edges,
+  &R_igraph_attribute_combine_edges,
+  &R_igraph_attribute_get_info,
+  &R_igraph_attribute_has_attr,
+  &R_igraph_attribute_gettype,
+  &R_igraph_attribute_get_numeric_graph_attr,
+  &R_igraph_attribute_get_string_graph_attr,
+  &R_igraph_attribute_get_bool_graph_attr,
+  &R_igraph_attribute_get_numeric_vertex_attr,
+  &R_igraph_attribute_get_string_vertex_attr,
+  &R_igraph_attribute_get_bool_vertex_attr,
+  &R_igraph_attribute_get_numeric_edge_attr,
+  &R_igraph_attribute_get_string_edge_attr,
+  &R_igraph_attribute_get_bool_edge_attr,
+};
+
+// Access from R
+
+void R_igraph_attribute_setup(void) {
+  attr_cells = CONS(R_NilValue, CONS(R_NilValue, R_NilValue));
+  R_PreserveObject(attr_cells);
+  attr_unwind_token = R_MakeUnwindCont();
+  R_PreserveObject(attr_unwind_token);
+}
+
+void R_igraph_attribute_resume(void) {
+  if (attr_unwind_pending) {
+    attr_unwind_pending = false;
+    R_ContinueUnwind(attr_unwind_token);
+  }
+}
+
+SEXP R_igraph_attribute_list(const igraph_t* graph) {
+  return attr_root(graph);
+}
+
+void R_igraph_attribute_restore(igraph_t* graph, SEXP attr) {
+  if (isNull(attr)) {
+    return;
+  }
+  if (TYPEOF(attr) != VECSXP || XLENGTH(attr) != 3) {
+    error("Invalid attribute list.");
+  }
+
+  SEXP root = PROTECT(NEW_LIST(3));
+  for (int i = ATTRIBUTE_GRAPH; i <= ATTRIBUTE_EDGE; i++) {
+    SET_VECTOR_ELT(root, i, attr_list_copy(VECTOR_ELT(attr, i)));
+  }
+  attr_set_root(graph, root);
+  UNPROTECT(1);
+}
+
+SEXP R_igraph_attribute_get(const igraph_t* graph, int which, const char* name) {
+  SEXP list = attr_list(graph, which);
+  R_xlen_t pos = attr_find(list, name);
+  return pos < 0 ? R_NilValue : VECTOR_ELT(list, pos);
+}
+
+void R_igraph_attribute_set(igraph_t* graph, int which, const char* name, SEXP value) {
+  R_xlen_t size = which == ATTRIBUTE_VERTEX ? igraph_vcount(graph) :
+                  which == ATTRIBUTE_EDGE ? igraph_ecount(graph) : 1;
+
+  if (!isNull(value)) {
+    if (TYPEOF(value) == INTSXP && !isFactor(value)) {
+      value = coerceVector(value, REALSXP);
+    } else if (TYPEOF(value) != REALSXP && TYPEOF(value) != LGLSXP && TYPEOF(value) != STRSXP) {
+      error("Attribute '%s' must be numeric, logical or character.", name);
+    }
+    if (XLENGTH(value) != size) {
+      error("Attribute '%s' must have length %ld.", name, (long) size);
+    }
+  }
+  PROTECT(value);
+
+  if (!isNull(value)) {
+    // Columns are shared with R code and other graphs
+    MARK_NOT_MUTABLE(value);
+  }
+  attr_put(attr_ensure_root(graph), which, name, value);
+  if (which == ATTRIBUTE_VERTEX && !strcmp(name, "name")) {
+    attr_drop_names(graph);
+  }
+  UNPROTECT(1);
+}
+
+igraph_error_t R_igraph_attribute_vertex_names(const igraph_t* graph,
+                                               const R_igraph_vertex_names_t** names) {
+  // Like the property cache, the index is not part of the graph's state
+  auto* holder = static_cast<attr_holder_t*>(graph->attr);
+  R_igraph_vertex_names_t res;
+  igraph_integer_t id;
+  SEXP col;
+
+  if (holder->has_names) {
+    *names = &holder->names;
+    return IGRAPH_SUCCESS;
+  }
+
+  ATTR_COLUMN(col, graph, ATTRIBUTE_VERTEX, "name", STRSXP);
+  R_xlen_t n = XLENGTH(col);
+
+  IGRAPH_CHECK(igraph_i_name_index_init(&res.index));
+  IGRAPH_FINALLY(igraph_i_name_index_destroy, &res.index);
+  IGRAPH_CHECK(igraph_i_name_index_reserve(&res.index, n));
+  IGRAPH_VECTOR_INT_INIT_FINALLY(&res.vertex, 0);
+  IGRAPH_CHECK(igraph_vector_int_reserve(&res.vertex, n));
+
+  const void* vmax = vmaxget();
+  for (R_xlen_t i = 0; i < n; i++) {
+    if (STRING_ELT(col, i) != NA_STRING) {
+      IGRAPH_CHECK(igraph_i_name_index_get(&res.index, translateCharUTF8(STRING_ELT(col, i)), &id));
+      if (id == igraph_vector_int_size(&res.vertex)) {
+        igraph_vector_int_push_back(&res.vertex, i); /* reserved */
+      }
+      vmaxset(vmax);
+    }
+  }
+
+  IGRAPH_FINALLY_CLEAN(2);
+  holder->names = res;
+  holder->has_names = true;
+  *names = &holder->names;
+  return IGRAPH_SUCCESS;
+}
+
+bool R_igraph_attribute_weights(const igraph_t* graph, const char* name, igraph_vector_t* weights) {
+  SEXP col = attr_column(graph, ATTRIBUTE_EDGE, name, REALSXP);
+  if (isNull(col)) {
+    return false;
+  }
+  igraph_vector_view(weights, REAL(col), XLENGTH(col));
+  return true;
+}
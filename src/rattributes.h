@@ -0,0 +1,53 @@
+#pragma once
+
+#include <R.h>
+#include <Rinternals.h>
+#include <Rdefines.h>
+
+#include "igraph.h"
+
+#include "core/name_index.h"
+
+// Columnar attribute handler. The attributes of a graph are an R list of three
+// named lists (graph, vertex and edge attributes) holding one R vector per
+// attribute, created when the graph gets its first attribute. Columns are
+// never modified in place, so copies of a graph and R code share them without
+// copying.
+
+enum attribute_list_t {
+  ATTRIBUTE_GRAPH = 0,
+  ATTRIBUTE_VERTEX,
+  ATTRIBUTE_EDGE
+};
+
+extern const igraph_attribute_table_t R_igraph_attribute_table;
+
+// Called once when the package is loaded.
+void R_igraph_attribute_setup(void);
+
+// Continues unwinding an R error that the attribute handler caught while an
+// igraph function was running. Call it when an igraph function failed.
+void R_igraph_attribute_resume(void);
+
+SEXP R_igraph_attribute_list(const igraph_t* graph);
+
+void R_igraph_attribute_restore(igraph_t* graph, SEXP attr);
+
+SEXP R_igraph_attribute_get(const igraph_t* graph, int which, const char* name);
+
+void R_igraph_attribute_set(igraph_t* graph, int which, const char* name, SEXP value);
+
+// Index of the "name" vertex attribute, which must be a character vector.
+// vertex[id] is the first vertex with the name that has the given id in the
+// index; NA names are left out.
+struct R_igraph_vertex_names_t {
+  igraph_i_name_index_t index;
+  igraph_vector_int_t vertex;
+};
+
+// The index is built on first use and kept until the names or the vertices
+// of the graph change.
+igraph_error_t R_igraph_attribute_vertex_names(const igraph_t* graph,
+                                               const R_igraph_vertex_names_t** names);
+
+bool R_igraph_attribute_weights(const igraph_t* graph, const char* name, igraph_vector_t* weights);
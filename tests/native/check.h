@@ -0,0 +1,16 @@
+#ifndef NATIVE_CHECK_H
+#define NATIVE_CHECK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Exits with a failure, naming the condition, if it does not hold */
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            exit(1); \
+        } \
+    } while (0)
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ * Rows of the concurrent adjacency and incidence lists built by several
+ * threads at once must equal the rows of the lazy lists, and every thread
+ * must get the same row for a vertex.
+ */
+
+#include <igraph.h>
+
+#include "check.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define THREADS 8
+
+static void check_adjlist(const igraph_t *graph, igraph_neimode_t mode,
+                          igraph_loops_t loops, igraph_multiple_t multiple) {
+    igraph_integer_t n = igraph_vcount(graph);
+    igraph_concurrent_adjlist_t al;
+    igraph_lazy_adjlist_t lazy;
+    const igraph_vector_int_t **rows = calloc(THREADS * n, sizeof(*rows));
+    int failed = 0;
+
+    CHECK(rows != NULL);
+    igraph_concurrent_adjlist_init(graph, &al, mode, loops, multiple);
+    igraph_lazy_adjlist_init(graph, &lazy, mode, loops, multiple);
+
+    /* Each thread starts at its own vertex, so the threads race to build
+     * the same rows */
+#ifdef _OPENMP
+#pragma omp parallel num_threads(THREADS)
+#endif
+    {
+#ifdef _OPENMP
+        int t = omp_get_thread_num();
+#else
+        int t = 0;
+#endif
+        for (igraph_integer_t i = 0; i < n; i++) {
+            igraph_integer_t v = (i + t * n / THREADS) % n;
+            rows[t * n + v] = igraph_concurrent_adjlist_get(&al, v);
+        }
+    }
+
+    for (igraph_integer_t v = 0; v < n; v++) {
+        failed |= rows[v] == NULL;
+        failed |= !igraph_vector_int_all_e(rows[v], igraph_lazy_adjlist_get(&lazy, v));
+#ifdef _OPENMP
+        for (int t = 1; t < THREADS; t++) {
+            failed |= rows[t * n + v] != rows[v];
+        }
+#endif
+    }
+    CHECK(!failed);
+
+    igraph_lazy_adjlist_destroy(&lazy);
+    igraph_concurrent_adjlist_destroy(&al);
+    free(rows);
+}
+
+static void check_inclist(const igraph_t *graph, igraph_neimode_t mode,
+                          igraph_loops_t loops) {
+    igraph_integer_t n = igraph_vcount(graph);
+    igraph_concurrent_inclist_t il;
+    igraph_lazy_inclist_t lazy;
+    const igraph_vector_int_t **rows = calloc(THREADS * n, sizeof(*rows));
+    int failed = 0;
+
+    CHECK(rows != NULL);
+    igraph_concurrent_inclist_init(graph, &il, mode, loops);
+    igraph_lazy_inclist_init(graph, &lazy, mode, loops);
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(THREADS)
+#endif
+    {
+#ifdef _OPENMP
+        int t = omp_get_thread_num();
+#else
+        int t = 0;
+#endif
+        for (igraph_integer_t i = 0; i < n; i++) {
+            igraph_integer_t v = (i + t * n / THREADS) % n;
+            rows[t * n + v] = igraph_concurrent_inclist_get(&il, v);
+        }
+    }
+
+    for (igraph_integer_t v = 0; v < n; v++) {
+        failed |= rows[v] == NULL;
+        failed |= !igraph_vector_int_all_e(rows[v], igraph_lazy_inclist_get(&lazy, v));
+#ifdef _OPENMP
+        for (int t = 1; t < THREADS; t++) {
+            failed |= rows[t * n + v] != rows[v];
+        }
+#endif
+    }
+    CHECK(!failed);
+
+    igraph_lazy_inclist_destroy(&lazy);
+    igraph_concurrent_inclist_destroy(&il);
+    free(rows);
+}
+
+int main(void) {
+    igraph_integer_t n = 2000, m = 20000;
+    igraph_vector_int_t edges;
+    igraph_t graph;
+
+    /* Random edges, with loops and multi-edges */
+    igraph_rng_seed(igraph_rng_default(), 42);
+    igraph_vector_int_init(&edges, 2 * m);
+    for (igraph_integer_t i = 0; i < 2 * m; i++) {
+        VECTOR(edges)[i] = RNG_INTEGER(0, n - 1);
+    }
+    for (igraph_integer_t i = 0; i < 200; i += 2) {
+        /* Edge i is a loop, edge i + 1 a copy of edge i + 2 */
+        VECTOR(edges)[2 * i + 1] = VECTOR(edges)[2 * i];
+        VECTOR(edges)[2 * i + 2] = VECTOR(edges)[2 * i + 4];
+        VECTOR(edges)[2 * i + 3] = VECTOR(edges)[2 * i + 5];
+    }
+    igraph_create(&graph, &edges, n, IGRAPH_DIRECTED);
+    igraph_vector_int_destroy(&edges);
+
+    for (int round = 0; round < 10; round++) {
+        check_adjlist(&graph, IGRAPH_OUT, IGRAPH_LOOPS_ONCE, IGRAPH_MULTIPLE);
+        check_adjlist(&graph, IGRAPH_IN, IGRAPH_NO_LOOPS, IGRAPH_NO_MULTIPLE);
+        check_adjlist(&graph, IGRAPH_ALL, IGRAPH_LOOPS_TWICE, IGRAPH_MULTIPLE);
+        check_inclist(&graph, IGRAPH_OUT, IGRAPH_LOOPS_ONCE);
+        check_inclist(&graph, IGRAPH_ALL, IGRAPH_LOOPS_TWICE);
+    }
+
+    igraph_destroy(&graph);
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * Degrees cached before reversing all edges of a graph must not be served
+ * afterwards: the in- and out-degrees swap.
+ */
+
+#include <igraph.h>
+
+#include "check.h"
+
+int main(void) {
+    igraph_t graph;
+    igraph_vector_int_t out, in, res;
+    size_t budget = igraph_set_property_cache_budget(1 << 20);
+
+    igraph_small(&graph, 4, IGRAPH_DIRECTED, 0, 1, 0, 2, 0, 3, 1, 2, 2, 2, -1);
+    igraph_vector_int_init(&out, 0);
+    igraph_vector_int_init(&in, 0);
+    igraph_vector_int_init(&res, 0);
+
+    igraph_degree(&graph, &out, igraph_vss_all(), IGRAPH_OUT, IGRAPH_NO_LOOPS);
+    igraph_degree(&graph, &in, igraph_vss_all(), IGRAPH_IN, IGRAPH_NO_LOOPS);
+    CHECK(igraph_property_cache_size(&graph) > 0);
+
+    igraph_reverse_edges(&graph, igraph_ess_all(IGRAPH_EDGEORDER_ID));
+    CHECK(igraph_property_cache_size(&graph) == 0);
+
+    igraph_degree(&graph, &res, igraph_vss_all(), IGRAPH_OUT, IGRAPH_NO_LOOPS);
+    CHECK(igraph_vector_int_all_e(&res, &in));
+    igraph_degree(&graph, &res, igraph_vss_all(), IGRAPH_IN, IGRAPH_NO_LOOPS);
+    CHECK(igraph_vector_int_all_e(&res, &out));
+
+    /* Served from the cache again */
+    CHECK(igraph_property_cache_size(&graph) > 0);
+    igraph_degree(&graph, &res, igraph_vss_all(), IGRAPH_OUT, IGRAPH_NO_LOOPS);
+    CHECK(igraph_vector_int_all_e(&res, &in));
+
+    igraph_vector_int_destroy(&res);
+    igraph_vector_int_destroy(&in);
+    igraph_vector_int_destroy(&out);
+    igraph_destroy(&graph);
+    igraph_set_property_cache_budget(budget);
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * igraph_rng_get_unif_vector() must return exactly the numbers that as many
+ * igraph_rng_get_unif() calls would, and leave the RNG in the same state,
+ * for every RNG type and for lengths on both sides of its internal blocks.
+ */
+
+#include <igraph.h>
+
+#include "check.h"
+
+static void check_type(const igraph_rng_type_t *type, igraph_integer_t n,
+                       igraph_real_t l, igraph_real_t h) {
+    igraph_rng_t bulk, single;
+    igraph_vector_t result;
+
+    /* PCG64 is not available without __uint128_t */
+    igraph_error_handler_t *handler = igraph_set_error_handler(igraph_error_handler_ignore);
+    igraph_error_t err = igraph_rng_init(&bulk, type);
+    igraph_set_error_handler(handler);
+    if (err != IGRAPH_SUCCESS) {
+        return;
+    }
+    igraph_rng_init(&single, type);
+    igraph_rng_seed(&bulk, 42);
+    igraph_rng_seed(&single, 42);
+
+    igraph_vector_init(&result, 0);
+    CHECK(igraph_rng_get_unif_vector(&bulk, l, h, n, &result) == IGRAPH_SUCCESS);
+    CHECK(igraph_vector_size(&result) == n);
+    for (igraph_integer_t i = 0; i < n; i++) {
+        CHECK(VECTOR(result)[i] == igraph_rng_get_unif(&single, l, h));
+    }
+
+    /* Both generators continue from the same state */
+    for (igraph_integer_t i = 0; i < 10; i++) {
+        CHECK(igraph_rng_get_integer(&bulk, 0, 1000000) ==
+              igraph_rng_get_integer(&single, 0, 1000000));
+    }
+
+    igraph_vector_destroy(&result);
+    igraph_rng_destroy(&single);
+    igraph_rng_destroy(&bulk);
+}
+
+int main(void) {
+    const igraph_rng_type_t *types[] = {
+        &igraph_rngtype_glibc2, &igraph_rngtype_mt19937,
+        &igraph_rngtype_pcg32, &igraph_rngtype_pcg64
+    };
+    const igraph_integer_t lengths[] = { 0, 1, 127, 128, 129, 256, 257, 10000 };
+
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++) {
+        for (size_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); k++) {
+            check_type(types[t], lengths[k], 0, 1);
+            check_type(types[t], lengths[k], -2.5, 7);
+            check_type(types[t], lengths[k], 3, 3);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+/*
+ * Every string vector entry point on interned vectors, and between interned
+ * and plain ones. Equal elements of an interned vector must share a pointer.
+ */
+
+#include <igraph.h>
+
+#include <string.h>
+
+#include "check.h"
+
+/* Checks the contents of a vector, and that equal elements of an interned
+ * vector are the same pointer */
+static void check_contents(const igraph_strvector_t *sv, const char **expected,
+                           igraph_integer_t n) {
+    CHECK(igraph_strvector_size(sv) == n);
+    for (igraph_integer_t i = 0; i < n; i++) {
+        CHECK(strcmp(igraph_strvector_get(sv, i), expected[i]) == 0);
+        for (igraph_integer_t j = 0; j < n; j++) {
+            igraph_bool_t equal = strcmp(expected[i], expected[j]) == 0;
+            CHECK(igraph_strvector_equal_elements(sv, i, j) == equal);
+            if (igraph_strvector_is_interned(sv)) {
+                CHECK((igraph_strvector_get(sv, i) == igraph_strvector_get(sv, j)) == equal);
+            }
+        }
+    }
+}
+
+static void fill(igraph_strvector_t *sv, const char **values, igraph_integer_t n) {
+    for (igraph_integer_t i = 0; i < n; i++) {
+        CHECK(igraph_strvector_push_back(sv, values[i]) == IGRAPH_SUCCESS);
+    }
+}
+
+static void test_init_and_set(void) {
+    igraph_strvector_t sv;
+    const char *empty[] = { "", "", "" };
+    const char *set[] = { "a", "bc", "a" };
+    const char *set_len[] = { "a", "bc", "ab" };
+    const char *pushed[] = { "a", "bc", "ab", "bc", "b", "a" };
+
+    CHECK(igraph_strvector_init_interned(&sv, 3) == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_is_interned(&sv));
+    check_contents(&sv, empty, 3);
+
+    CHECK(igraph_strvector_set(&sv, 0, "a") == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_set(&sv, 1, "bc") == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_set(&sv, 2, "a") == IGRAPH_SUCCESS);
+    check_contents(&sv, set, 3);
+
+    /* Only the first len characters, and nothing after a null character */
+    CHECK(igraph_strvector_set_len(&sv, 2, "abc", 2) == IGRAPH_SUCCESS);
+    check_contents(&sv, set_len, 3);
+    CHECK(igraph_strvector_set_len(&sv, 2, "a\0c", 3) == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_get(&sv, 2) == igraph_strvector_get(&sv, 0));
+    CHECK(igraph_strvector_set_len(&sv, 2, "abc", 2) == IGRAPH_SUCCESS);
+
+    CHECK(igraph_strvector_push_back(&sv, "bc") == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_push_back_len(&sv, "bcd", 1) == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_push_back_len(&sv, "a", 5) == IGRAPH_SUCCESS);
+    check_contents(&sv, pushed, 6);
+
+    CHECK(igraph_strvector_reserve(&sv, 100) == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_capacity(&sv) >= 100);
+    check_contents(&sv, pushed, 6);
+
+    igraph_strvector_destroy(&sv);
+}
+
+static void test_resize_and_remove(void) {
+    igraph_strvector_t sv;
+    const char *values[] = { "x", "y", "x", "z" };
+    const char *grown[] = { "x", "y", "x", "z", "", "", "" };
+    const char *shrunk[] = { "x", "y" };
+    const char *removed[] = { "x", "", "", "" };
+    const char *refilled[] = { "x", "", "", "y" };
+
+    CHECK(igraph_strvector_init_interned(&sv, 0) == IGRAPH_SUCCESS);
+    fill(&sv, values, 4);
+
+    /* Growth adds empty strings, all the same pooled one */
+    CHECK(igraph_strvector_resize(&sv, 7) == IGRAPH_SUCCESS);
+    check_contents(&sv, grown, 7);
+
+    /* Removing the only "y" must not invalidate other elements */
+    igraph_strvector_remove_section(&sv, 1, 4);
+    check_contents(&sv, removed, 4);
+    CHECK(igraph_strvector_push_back(&sv, "y") == IGRAPH_SUCCESS);
+    igraph_strvector_remove(&sv, 1);
+    check_contents(&sv, refilled, 4);
+    igraph_strvector_remove(&sv, 3);
+    check_contents(&sv, removed, 3);
+
+    CHECK(igraph_strvector_resize(&sv, 0) == IGRAPH_SUCCESS);
+    fill(&sv, values, 4);
+    CHECK(igraph_strvector_resize(&sv, 2) == IGRAPH_SUCCESS);
+    check_contents(&sv, shrunk, 2);
+
+    igraph_strvector_clear(&sv);
+    CHECK(igraph_strvector_size(&sv) == 0);
+    CHECK(igraph_strvector_is_interned(&sv));
+    fill(&sv, values, 4);
+    check_contents(&sv, values, 4);
+
+    igraph_strvector_destroy(&sv);
+}
+
+static void test_copy_and_index(void) {
+    igraph_strvector_t sv, copy, indexed;
+    igraph_vector_int_t idx;
+    const char *values[] = { "p", "q", "p", "r" };
+    const char *picked[] = { "r", "p", "p" };
+
+    CHECK(igraph_strvector_init_interned(&sv, 0) == IGRAPH_SUCCESS);
+    fill(&sv, values, 4);
+
+    /* The copy is interned in a pool of its own */
+    CHECK(igraph_strvector_init_copy(&copy, &sv) == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_is_interned(&copy));
+    check_contents(&copy, values, 4);
+    CHECK(igraph_strvector_get(&copy, 0) != igraph_strvector_get(&sv, 0));
+    igraph_strvector_destroy(&sv);
+    check_contents(&copy, values, 4);
+
+    igraph_vector_int_init_int(&idx, 3, 3, 0, 2);
+    CHECK(igraph_strvector_init_interned(&indexed, 5) == IGRAPH_SUCCESS);
+    CHECK(igraph_strvector_index(&copy, &indexed, &idx) == IGRAPH_SUCCESS);
+    check_contents(&indexed, picked, 3);
+
+    igraph_vector_int_destroy(&idx);
+    igraph_strvector_destroy(&indexed);
+    igraph_strvector_destroy(&copy);
+}
+
+/* append() and merge() with each combination of interned and plain vectors */
+static void test_append_and_merge(void) {
+    const char *first[] = { "a", "b", "a" };
+    const char *second[] = { "b", "c", "c" };
+    const char *both[] = { "a", "b", "a", "b", "c", "c" };
+
+    for (int mode = 0; mode < 4; mode++) {
+        igraph_bool_t to_interned = mode & 1, from_interned = mode & 2;
+        igraph_strvector_t to, from;
+
+        for (int merge = 0; merge < 2; merge++) {
+            if (to_interned) {
+                CHECK(igraph_strvector_init_interned(&to, 0) == IGRAPH_SUCCESS);
+            } else {
+                CHECK(igraph_strvector_init(&to, 0) == IGRAPH_SUCCESS);
+            }
+            if (from_interned) {
+                CHECK(igraph_strvector_init_interned(&from, 0) == IGRAPH_SUCCESS);
+            } else {
+                CHECK(igraph_strvector_init(&from, 0) == IGRAPH_SUCCESS);
+            }
+            fill(&to, first, 3);
+            fill(&from, second, 3);
+
+            if (merge) {
+                CHECK(igraph_strvector_merge(&to, &from) == IGRAPH_SUCCESS);
+                CHECK(igraph_strvector_size(&from) == 0);
+                /* The emptied vector keeps its mode and stays usable */
+                CHECK(igraph_strvector_is_interned(&from) == from_interned);
+                fill(&from, second, 3);
+                check_contents(&from, second, 3);
+            } else {
+                CHECK(igraph_strvector_append(&to, &from) == IGRAPH_SUCCESS);
+                check_contents(&from, second, 3);
+            }
+            CHECK(igraph_strvector_is_interned(&to) == to_interned);
+            check_contents(&to, both, 6);
+
+            /* The strings of to do not depend on from */
+            igraph_strvector_destroy(&from);
+            check_contents(&to, both, 6);
+            igraph_strvector_destroy(&to);
+        }
+    }
+}
+
+int main(void) {
+    test_init_and_set();
+    test_resize_and_remove();
+    test_copy_and_index();
+    test_append_and_merge();
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Items drawn from an alias table and from a prefix sum tree must follow
+ * their weights: zero-weight items never come up, and the frequencies of
+ * the others stay within a few standard deviations of their expectation.
+ * Invalid weights are rejected with IGRAPH_EINVAL.
+ */
+
+#include <igraph.h>
+
+#include <math.h>
+
+#include "check.h"
+
+#define DRAWS 1000000
+
+static const igraph_real_t weights[] = { 0, 1, 2, 0, 3.5, 0.5, 0, 3, 0 };
+#define ITEMS ((igraph_integer_t) (sizeof(weights) / sizeof(weights[0])))
+
+/* Binomial counts of every item lie within five standard deviations */
+static void check_frequencies(const igraph_vector_int_t *drawn) {
+    igraph_integer_t counts[ITEMS] = { 0 };
+    igraph_real_t sum = 0;
+
+    CHECK(igraph_vector_int_size(drawn) == DRAWS);
+    for (igraph_integer_t i = 0; i < DRAWS; i++) {
+        igraph_integer_t item = VECTOR(*drawn)[i];
+        CHECK(item >= 0 && item < ITEMS);
+        counts[item]++;
+    }
+
+    for (igraph_integer_t i = 0; i < ITEMS; i++) {
+        sum += weights[i];
+    }
+    for (igraph_integer_t i = 0; i < ITEMS; i++) {
+        igraph_real_t p = weights[i] / sum;
+        if (p == 0) {
+            CHECK(counts[i] == 0);
+        } else {
+            CHECK(fabs(counts[i] - DRAWS * p) <= 5 * sqrt(DRAWS * p * (1 - p)));
+        }
+    }
+}
+
+static void check_alias(void) {
+    igraph_vector_t w;
+    igraph_vector_int_t drawn;
+    igraph_alias_t alias;
+
+    igraph_vector_view(&w, weights, ITEMS);
+    igraph_vector_int_init(&drawn, 0);
+    CHECK(igraph_alias_init(&alias, &w) == IGRAPH_SUCCESS);
+    CHECK(igraph_alias_size(&alias) == ITEMS);
+
+    CHECK(igraph_alias_sample(&alias, igraph_rng_default(), &drawn, DRAWS) == IGRAPH_SUCCESS);
+    check_frequencies(&drawn);
+
+    for (igraph_integer_t i = 0; i < DRAWS; i++) {
+        VECTOR(drawn)[i] = igraph_alias_draw(&alias, igraph_rng_default());
+    }
+    check_frequencies(&drawn);
+
+    igraph_alias_destroy(&alias);
+    igraph_vector_int_destroy(&drawn);
+}
+
+static void check_psumtree(void) {
+    igraph_vector_int_t drawn;
+    igraph_psumtree_t tree;
+
+    igraph_vector_int_init(&drawn, 0);
+    igraph_psumtree_init(&tree, ITEMS);
+    for (igraph_integer_t i = 0; i < ITEMS; i++) {
+        CHECK(igraph_psumtree_update(&tree, i, weights[i]) == IGRAPH_SUCCESS);
+    }
+
+    CHECK(igraph_psumtree_sample(&tree, igraph_rng_default(), &drawn, DRAWS) == IGRAPH_SUCCESS);
+    check_frequencies(&drawn);
+
+    igraph_psumtree_destroy(&tree);
+    igraph_vector_int_destroy(&drawn);
+}
+
+static void check_invalid(void) {
+    igraph_real_t infinite[] = { 1, IGRAPH_INFINITY, 2 };
+    igraph_real_t negative[] = { 1, -1, 2 };
+    igraph_real_t zero[] = { 0, 0, 0 };
+    igraph_vector_t w;
+    igraph_vector_int_t drawn;
+    igraph_alias_t alias;
+    igraph_psumtree_t tree;
+    igraph_error_handler_t *handler = igraph_set_error_handler(igraph_error_handler_ignore);
+
+    igraph_vector_view(&w, infinite, 3);
+    CHECK(igraph_alias_init(&alias, &w) == IGRAPH_EINVAL);
+    igraph_vector_view(&w, negative, 3);
+    CHECK(igraph_alias_init(&alias, &w) == IGRAPH_EINVAL);
+    igraph_vector_view(&w, zero, 3);
+    CHECK(igraph_alias_init(&alias, &w) == IGRAPH_EINVAL);
+
+    igraph_vector_int_init(&drawn, 0);
+    igraph_psumtree_init(&tree, 3);
+    CHECK(igraph_psumtree_update(&tree, 0, IGRAPH_INFINITY) == IGRAPH_EINVAL);
+    CHECK(igraph_psumtree_update(&tree, 0, -1) == IGRAPH_EINVAL);
+    CHECK(igraph_psumtree_sample(&tree, igraph_rng_default(), &drawn, 1) == IGRAPH_EINVAL);
+    igraph_psumtree_destroy(&tree);
+    igraph_vector_int_destroy(&drawn);
+
+    igraph_set_error_handler(handler);
+}
+
+int main(void) {
+    igraph_rng_seed(igraph_rng_default(), 42);
+
+    check_alias();
+    check_psumtree();
+    check_invalid();
+
+    return 0;
+}